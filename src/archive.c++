@@ -3,6 +3,7 @@
 #include "exception.h"
 #include "catalogue.h"
 #include "file_content_creator.h"
+#include "chunker.h"
 
 using namespace std;
 using namespace coformat;
@@ -10,71 +11,167 @@ namespace fs = std::filesystem;
 
 namespace archi{
 
-void Archive_action::recursive_add_from_dir(const fs::path &dir_path)
-try {
-	// adding files first helps compression
-	std::vector<fs::path> dirs;
-	for (auto &e : fs::directory_iterator(dir_path)){
-		auto p = e.path();
-		if (files_to_exclude.find(p) != files_to_exclude.end())
-			continue;
-		add(p);
-		if (e.is_directory() and !e.is_symlink())
-			dirs.push_back(p);
+const File_content_ref *Archive_action::find_content(u64 size, const Content_id &id)
+{
+	if (auto it = new_content_.find({size, id}); it != new_content_.end())
+		return &it->second;
+	return catalog_->content(size, id);
+}
+
+const File_content_ref *Archive_action::find_new_content(const File_content_ref &ref)
+{
+	if (!ref.content_id)
+		return nullptr;
+	auto it = new_content_.find({ref.to - ref.from, *ref.content_id});
+	return it != new_content_.end() ? &it->second : nullptr;
+}
+
+bool Archive_action::compacted(const Filesystem_state::File &file)
+{
+	if (file.content_ref and compacted_files_.contains(file.content_ref->fname))
+		return true;
+	for (auto &chunk : file.chunks)
+		if (compacted_files_.contains(chunk.fname))
+			return true;
+	return false;
+}
+
+void Archive_action::remember_content(const File_content_ref &ref)
+{
+	ASSERT(ref.content_id);
+	new_content_.emplace(pair(ref.to - ref.from, *ref.content_id), ref);
+}
+
+File_content_ref Archive_action::add_content(File_content_creator *fcc, Dir_walker::Item &item)
+{
+	auto src = item.open();
+	Pipe_csum_in id_pipe(catalog_->content_id_csumer());
+	id_pipe << src;
+	File_content_ref ref;
+	// long term content stays apart from fresh one, even if it's incompressible
+	if (probe_ and fcc != long_term_content_){
+		*probe_ << id_pipe;
+		if (probe_->incompressible())
+			fcc = incompressible_content_;
+		ref = fcc->add(*probe_, item.path);
 	}
-	for (auto &dir : dirs)
-		recursive_add_from_dir(dir);
+	else
+		ref = fcc->add(id_pipe, item.path);
+	ref.content_id = get<Content_id>(id_pipe.csumer()->checksum());
+	// the content is identified while it's stored, so it's read once. if it was stored before,
+	// that copy is referenced, and this one is left to the GC. unless the other one is being compacted
+	auto stored = find_content(ref.to - ref.from, *ref.content_id);
+	if (stored and !compacted_files_.contains(stored->fname))
+		return *stored;
+	remember_content(ref);
+	return ref;
 }
-catch(std::exception &exp){
-	if (has_tag(exp, File_content_creator::unrecoverable_output_problem))
-		throw;
-	warning(cformat(tr_txt("Can't get directory contents for {b}{0}{nb}:"), dir_path), message(exp));
+
+std::vector<File_content_ref> Archive_action::add_chunks(File_content_creator *fcc, Dir_walker::Item &item)
+{
+	auto src = item.open();
+	Stream_in in(item.path);
+	if (probe_ and fcc != long_term_content_){
+		*probe_ << src;
+		if (probe_->incompressible())
+			fcc = incompressible_content_;
+		in << *probe_;
+	}
+	else
+		in << src;
+	vector<File_content_ref> ret;
+	// chunks are cut from the buffer. it's refilled, when less than the biggest chunk is left
+	buf_.resize(4*Chunker::max_size);
+	u8 *buf = buf_.raw();
+	size_t begin = 0, end = 0;
+	bool eof = false;
+	while (true){
+		while (!eof and end - begin < Chunker::max_size){
+			memmove(buf, buf + begin, end - begin);
+			end -= begin;
+			begin = 0;
+			auto res = in.pump(buf + end, buf_.size() - end);
+			end += res.pumped_size;
+			eof = res.eof;
+		}
+		if (begin == end)
+			break;
+		auto size = Chunker::cut(buf + begin, end - begin);
+		auto id = catalog_->content_id(buf + begin, size);
+		// chunks of the content files being compacted are stored again, once
+		auto stored = find_content(size, id);
+		if (stored and !compacted_files_.contains(stored->fname))
+			ret.push_back(*stored);
+		else{
+			Memory_source chunk(buf + begin, size);
+			auto &ref = ret.emplace_back(fcc->add(chunk, item.path));
+			ref.content_id = id;
+			remember_content(ref);
+		}
+		begin += size;
+	}
+	return ret;
 }
 
-void Archive_action::add(const fs::path &file_path)
+void Archive_action::add(Dir_walker::Item &item)
 {
+	if (!item.error.empty()){
+		warning(cformat(tr_txt("Skipping {b}{0}{nb}:"), item.path), move(item.error));
+		return;
+	}
+	if (!item.file)
+		return;
 	try{
-		Filesystem_state::File file;
-		auto path_for_archive = root.empty() ? file_path : file_path.lexically_relative(root);
-		file.path = move(path_for_archive);
-		auto sts = symlink_status(file_path);
-		auto type = sts.type();
-		if (type == fs::file_type::regular)
-			file.type = Filesystem_state::FILE;
-		else if (type == fs::file_type::directory)
-			file.type = Filesystem_state::DIR;
-		else if (type == fs::file_type::symlink){
-			file.type = Filesystem_state::SYMLINK;
-			file.symlink_target = fs::read_symlink(file_path);
-		} else
-			return;
-		if (file.type != Filesystem_state::SYMLINK){
-			file.unix_permissions = to_int(sts.permissions());
-			file.mod_time = to_posix_time(last_write_time(file_path));
-			if (process_acls){
-				file.acl = get_acl(file_path);
-				if (file.type == Filesystem_state::DIR)
-					file.default_acl = get_default_acl(file_path);
+		auto &file = *item.file;
+		auto first_link = file.inode ? next_->get_if_same_inode(*file.inode, *file.mod_time) : nullptr;
+		if (first_link){
+			// the content is already there. it is stored once for all the links
+			file.hard_link = first_link->path;
+			file.content_ref = first_link->content_ref;
+			file.chunks = first_link->chunks;
+			file.holes = first_link->holes;
+		}
+		else if (file.type == Filesystem_state::FILE and item.size != 0){
+			ASSERT(file.mod_time);
+			auto was = prev_->get_if_unchanged(file.path, *file.mod_time);
+			if (!was and file.inode)
+				was = prev_->get_if_same_inode(*file.inode, *file.mod_time); // renamed, or moved
+			// a renamed file isn't under the path the GC saw, so it's checked by its refs too
+			if (force_to_archive_.contains(file.path) or (was and compacted(*was))){
+				// content shared by several files is stored again once
+				auto stored = was and was->content_ref ? find_new_content(*was->content_ref) : nullptr;
+				if (stored){
+					file.content_ref = *stored;
+					file.holes = was->holes;
+				}
+				else{
+					item.find_holes();
+					if (chunking_min_file_size and item.size >= *chunking_min_file_size)
+						file.chunks = add_chunks(long_term_content_, item);
+					else
+						file.content_ref = add_content(long_term_content_, item);
+				}
 			}
-			if (file.type == Filesystem_state::FILE){
-				auto sz = fs::file_size(file_path);
-				if (sz != 0){
-					if (force_to_archive_.contains(file.path))
-						file.content_ref = long_term_content_->add(file_path);
-					else {
-						ASSERT(file.mod_time);
-						file.content_ref = prev_->get_ref_if_exist(file.path, *file.mod_time);
-						if (!file.content_ref){
-							if (is_colorized()){
-								println("{}", file.path.string().substr(0,100));
-								clear_previous_line();
-							}
-							if (sz >= min_content_file_size)
-								file.content_ref = big_content_->add(file_path);
-							else
-								file.content_ref = normal_content_->add(file_path);
-						}
+			else {
+				if (was){
+					file.content_ref = was->content_ref;
+					file.chunks = was->chunks;
+					file.holes = was->holes;
+				}
+				if (!file.content_ref and file.chunks.empty())
+					item.find_holes();
+				// a file of nothing but holes has no content
+				if (!file.content_ref and file.chunks.empty() and item.content_size() != 0){
+					if (is_colorized()){
+						println("{}", file.path.string().substr(0,100));
+						clear_previous_line();
 					}
+					if (chunking_min_file_size and item.size >= *chunking_min_file_size)
+						file.chunks = add_chunks(chunk_content_, item);
+					else if (item.size >= min_content_file_size)
+						file.content_ref = add_content(big_content_, item);
+					else
+						file.content_ref = add_content(normal_content_, item);
 				}
 			}
 		}
@@ -83,7 +180,7 @@ void Archive_action::add(const fs::path &file_path)
 	catch(std::exception &exp){
 		if (has_tag(exp, File_content_creator::unrecoverable_output_problem))
 			throw;
-		warning(cformat(tr_txt("Skipping {b}{0}{nb}:"), file_path), message(exp));
+		warning(cformat(tr_txt("Skipping {b}{0}{nb}:"), item.path), message(exp));
 	}
 }
 
@@ -91,6 +188,7 @@ void Archive_action::archive()
 {
 	try{
 		Catalogue cat(archive_path, password, true);
+		cat.cipher(cipher);
 		catalog_ = &cat;
 		auto prev = catalog_->latest_fs_state();
 		auto next = catalog_->empty_fs_state();
@@ -98,33 +196,27 @@ void Archive_action::archive()
 		next_ = &next;
 		// -=- GC -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-
 		force_to_archive_.clear();
+		compacted_files_.clear();
 		if (max_storage_time){
 			auto max_ref = cat.num_states();
 			if (max_ref != 0){
-				struct Old_files{
-					fs::path *path;
-					string_view content_fn;
-					u64 space_taken;
-				};
-				vector<Old_files> old_enough_to_compact;
-				for (Filesystem_state::File &file: prev.files()){
-					if ( file.content_ref.has_value() && file.content_ref.value().ref_count_ == max_ref){
-						auto &a = old_enough_to_compact.emplace_back();
-						a.path = &file.path;
-						a.content_fn = file.content_ref->fname;
-						a.space_taken = file.content_ref->space_taken;
-					}
-				}
+				// refs of the latest state, each once. links, files with the same content, and repeated chunks share them
+				vector<const File_content_ref*> live;
+				prev.for_each_ref([&](File_content_ref &ref){
+					live.push_back(&ref);
+				});
 				unordered_map<string_view, u64> content_file_waste;
-				for (auto &f : old_enough_to_compact){
-					if (content_file_waste.contains(f.content_fn))
+				for (auto ref : live){
+					if (ref->ref_count_ != max_ref or content_file_waste.contains(ref->fname))
 						continue;
-					auto size = file_size(archive_path / f.content_fn);
-					content_file_waste[f.content_fn] = max(size, min_content_file_size);
+					auto size = file_size(archive_path / ref->fname);
+					content_file_waste[ref->fname] = max(size, min_content_file_size);
 				}
-				for (auto &f :old_enough_to_compact){
-					auto &size = content_file_waste[f.content_fn];
-					size -= min(f.space_taken, size); // underflow protection
+				// everything still used takes its space, old enough or not
+				for (auto ref : live){
+					auto it = content_file_waste.find(ref->fname);
+					if (it != content_file_waste.end())
+						it->second -= min(ref->space_taken, it->second); // underflow protection
 				}
 				// now content_file_waste contains wasted space for each file
 				u64 total_waste=0;
@@ -136,19 +228,26 @@ void Archive_action::archive()
 					total_waste += cz.second;
 				}
 				u64 total_size = 0;
-				for (auto &f : old_enough_to_compact ){
-					if (not content_files_to_compact.contains(f.content_fn))
-						continue;
-					force_to_archive_.insert(*f.path);
-					total_size += f.space_taken;
+				for (auto ref : live){
+					if (content_files_to_compact.contains(ref->fname))
+						total_size += ref->space_taken;
 				}
-				if (total_size < min_content_file_size and total_waste < 10*min_content_file_size){
-					//not enough even for one new content file, and less then 10 content files are wasted
-					force_to_archive_.clear();
+				//not enough even for one new content file, and less then 10 content files are wasted
+				if (total_size >= min_content_file_size or total_waste >= 10*min_content_file_size){
+					for (Filesystem_state::File &file: prev.files()){
+						bool compact = file.content_ref and content_files_to_compact.contains(file.content_ref->fname);
+						for (auto &chunk : file.chunks)
+							compact = compact or content_files_to_compact.contains(chunk.fname);
+						if (compact)
+							force_to_archive_.insert(file.path);
+					}
+					for (auto fn : content_files_to_compact)
+						compacted_files_.emplace(fn);
 				}
 			}
 		}
 
+		new_content_.clear();
 		auto fccn = File_content_creator(archive_path);
 		normal_content_ = &fccn;
 		normal_content_->min_file_size(min_content_file_size);
@@ -158,15 +257,34 @@ void Archive_action::archive()
 		auto fccb = File_content_creator(archive_path);
 		big_content_ = &fccb;
 		big_content_->min_file_size(min_content_file_size);
+		auto fcci = File_content_creator(archive_path);
+		incompressible_content_ = &fcci;
+		incompressible_content_->min_file_size(min_content_file_size);
+		auto fccc = File_content_creator(archive_path);
+		chunk_content_ = &fccc;
+		chunk_content_->min_file_size(min_content_file_size);
 		if (!password.empty()){
-			long_term_content_->enable_encryption();
-			normal_content_->enable_encryption();
-			big_content_->enable_encryption();
+			long_term_content_->enable_encryption(cipher);
+			normal_content_->enable_encryption(cipher);
+			big_content_->enable_encryption(cipher);
+			incompressible_content_->enable_encryption(cipher);
+			chunk_content_->enable_encryption(cipher);
 		}
 		if (zstd){
-			long_term_content_->enable_compression(*zstd);
-			normal_content_->enable_compression(*zstd);
+			auto small_zstd = *zstd;
+			// only big files are worth zstd workers. the others get flushed per file, which keeps workers idle
+			small_zstd.threads = 0;
+			long_term_content_->enable_compression(small_zstd);
+			normal_content_->enable_compression(small_zstd);
 			big_content_->enable_compression(*zstd);
+			chunk_content_->enable_compression(*zstd);
+			if (auto dict = cat.zstd_dictionary()){
+				long_term_content_->use_dictionary(dict);
+				normal_content_->use_dictionary(dict);
+			}
+			else
+				normal_content_->train_dictionary();
+			probe_.emplace();
 		}
 		if (!root.empty()){
 			for (auto &file : files_to_archive)
@@ -176,8 +294,18 @@ void Archive_action::archive()
 				tmp.insert(root / file);
 			files_to_exclude = tmp;
 		}
+		Dir_walker walker(scan_threads);
+		walker.root = root;
+		walker.files_to_exclude = &files_to_exclude;
+		walker.process_acls = process_acls;
+		auto add_item = [this](Dir_walker::Item &item){
+			add(item);
+		};
+		auto dir_error = [this](const fs::path &dir_path, string &&error){
+			warning(cformat(tr_txt("Can't get directory contents for {b}{0}{nb}:"), dir_path), move(error));
+		};
 		if (files_to_archive.empty()){
-			recursive_add_from_dir(root);
+			walker.walk(root, add_item, dir_error);
 		}
 		else{
 			for (auto &file : files_to_archive){
@@ -185,21 +313,30 @@ void Archive_action::archive()
 					warning(cformat(tr_txt("Path {b}{0}{nb} does not exist"), file), "");
 					continue;
 				}
-				add(file);
+				auto item = walker.scan(file);
+				add(item);
 				if (fs::is_directory(file))
-					recursive_add_from_dir(file);
+					walker.walk(file, add_item, dir_error);
 			}
 		}
 		long_term_content_->finish();
 		normal_content_->finish();
 		big_content_->finish();
+		incompressible_content_->finish();
+		chunk_content_->finish();
+		for (auto fcc : {normal_content_, long_term_content_, big_content_, incompressible_content_, chunk_content_}){
+			for (auto &[fname, csums] : fcc->take_finished_files())
+				catalog_->storage_csums(fname, move(csums));
+		}
 		// TODO: get rid of
 		if (zstd){
 			auto cs = normal_content_->compression_statistic();
 			auto csl = long_term_content_->compression_statistic();
 			auto csb = big_content_->compression_statistic();
-			cs.original += csl.original + csb.original;
-			cs.compressed += csl.compressed + csb.compressed;
+			auto csi = incompressible_content_->compression_statistic();
+			auto csc = chunk_content_->compression_statistic();
+			cs.original += csl.original + csb.original + csi.original + csc.original;
+			cs.compressed += csl.compressed + csb.compressed + csi.compressed + csc.compressed;
 			if (cs.original){
 				auto percent = cs.compressed *100 / cs.original;
 				cprint(tr_txt("Archive compressed to {}% of original size\n"), percent);
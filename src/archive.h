@@ -2,6 +2,8 @@
 #include "precomp.h"
 #include "file_content_creator.h"
 #include "catalogue.h"
+#include "dir_walker.h"
+#include "piping_probe.h"
 
 namespace archi{
 
@@ -13,22 +15,38 @@ public:
 	std::vector<std::filesystem::path> files_to_archive; // if not set, then archive all from root (not including the root)
 	std::unordered_set<std::filesystem::path> files_to_exclude;
 	u64 min_content_file_size;
+	std::optional<u64> chunking_min_file_size; // files at least that big are split to chunks, and only new chunks are stored
 	std::optional<Time> max_storage_time;
 	std::string password;
+	Cipher cipher = Cipher::CHACHA20;
 	std::optional<Zstd_out> zstd;
 	std::function<void(std::string &&header, std::string &&warning_message)> warning;
 	bool process_acls;
+	unsigned scan_threads = 1;
 
 	void archive();
 private:
-	void add(const std::filesystem::path &file_path);
-	void recursive_add_from_dir(const std::filesystem::path &dir_path);
+	void add(Dir_walker::Item &item);
+	File_content_ref add_content(File_content_creator *fcc, Dir_walker::Item &item);
+	std::vector<File_content_ref> add_chunks(File_content_creator *fcc, Dir_walker::Item &item);
+	const File_content_ref *find_content(u64 size, const Content_id &id);
+	/// the same content as of the ref, if this run has stored it already
+	const File_content_ref *find_new_content(const File_content_ref &ref);
+	void remember_content(const File_content_ref &ref);
+	/// true if some content of the file is in the content files, which are compacted
+	bool compacted(const Filesystem_state::File &file);
 
 	std::unordered_set<std::filesystem::path> force_to_archive_;// relative to archive_path. list of files to 'compact'
+	std::unordered_set<std::string> compacted_files_; // content files, which are compacted. the chunks in them are stored again
 	Catalogue *catalog_;
 	File_content_creator *normal_content_;
 	File_content_creator *long_term_content_;
 	File_content_creator *big_content_;
+	File_content_creator *incompressible_content_; // not compressed
+	File_content_creator *chunk_content_; // chunks of big files, apart from whole files
+	std::optional<Pipe_probe_in> probe_; // only if compression is on
+	std::map<std::pair<u64, Content_id>, File_content_ref> new_content_; // stored by this run, the catalogue doesn't know it yet
+	Buffer buf_;
 	Filesystem_state *prev_;
 	Filesystem_state *next_;
 	friend void archive(Archive_action a);
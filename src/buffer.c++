@@ -13,8 +13,8 @@ Buffer::Buffer()
 void Buffer::resize(size_t new_size)
 {
 	if (new_size > max_size_){
-		buff_.reset(new u8[new_size]);
-		max_size_ = new_size;
+		buff_ = pool::memory(new_size);
+		max_size_ = buff_.get_deleter().size;
 	}
 	size_ = new_size;
 }
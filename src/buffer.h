@@ -1,8 +1,10 @@
 #pragma once
 #include "precomp.h"
+#include "pool.h"
 
 namespace archi{
 
+/// its memory comes from the process-wide pool, and goes back there
 class Buffer
 {
 public:
@@ -15,7 +17,7 @@ public:
 		return buff_.get();
 	}
 private:
-	std::unique_ptr<u8[]> buff_{};
+	pool::Memory buff_{};
 	size_t size_{};
 	size_t max_size_{};
 };
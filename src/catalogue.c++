@@ -1,4 +1,5 @@
 #include "checksumer_xxhash.h"
+#include "checksumer_blake3.h"
 #include "piping_csum.h"
 #include "precomp.h"
 #include "catalogue.h"
@@ -9,19 +10,35 @@
 
 #include "format.pb.h"
 
-static const uint current_version = 0;
+// 1: catalogue and states are encrypted chunk by chunk
+// 2: big files can be split to chunks
+static const uint current_version = 2;
 
 using namespace std;
 namespace fs = std::filesystem;
 
 static const char * cat_filename = "catalog";
+// times of the last successful 'test' of content files, one "<time> <file name>" per line.
+// it's apart from the catalogue, so testing doesn't rewrite the catalogue
+static const char * verified_filename = "verified";
 
 namespace archi{
 
 
+template<class PB_ENC_FILTER>
+void add_enc_params(PB_ENC_FILTER *fm, Encryption_params &ep){
+	fm->set_iv(ep.iv(), ep.iv_size());
+	fm->set_key(ep.key(), ep.key_size());
+}
+
 void add_filters(proto::Filters *pf, Filters_in &f){
-	if (f.cmp_in)
-		pf->mutable_zstd_compression();
+	if (f.cmp_in){
+		auto cmp = pf->mutable_zstd_compression();
+		if (f.cmp_in->window_log)
+			cmp->set_window_log(f.cmp_in->window_log);
+		if (f.cmp_in->dictionary)
+			cmp->set_dictionary_id(f.cmp_in->dictionary->id);
+	}
 	if (f.enc_chapo_in){
 		auto enc = pf->mutable_chapoly_encryption();
 		enc->set_iv(f.enc_chapo_in->iv(), f.enc_chapo_in->iv_size());
@@ -32,6 +49,14 @@ void add_filters(proto::Filters *pf, Filters_in &f){
 		enc->set_iv(f.enc_chacha_in->iv(), f.enc_chacha_in->iv_size());
 		enc->set_key(f.enc_chacha_in->key(), f.enc_chacha_in->key_size());
 	}
+	if (f.enc_stream_in){
+		if (f.enc_stream_in->algorithm == Aead_stream::AES_256_GCM)
+			add_enc_params(pf->mutable_aes_gcm_stream_encryption(), *f.enc_stream_in);
+		else
+			add_enc_params(pf->mutable_chapoly_stream_encryption(), *f.enc_stream_in);
+	}
+	if (f.enc_aes_ctr_in)
+		add_enc_params(pf->mutable_aes_ctr_encryption(), *f.enc_aes_ctr_in);
 }
 
 template<class PB_ENC_FILTER>
@@ -44,10 +69,26 @@ void fill_enc_params(PB_ENC_FILTER &fm, Encryption_params &ep){
 	ep.iv(fm.iv());
 }
 
-Filters_in get_filters(const proto::Filters &pf){
+template<size_t N>
+void fill_hash(std::array<u8, N> &to, const string &from, const char *name){
+	if (from.size() != N)
+		throw Exception("Wrong {0} size. Likely corrupt file.")(name);
+	copy_n(from.begin(), N, to.begin());
+}
+
+Filters_in get_filters(const proto::Filters &pf, const vector<shared_ptr<const Zstd_dictionary>> &dicts){
 	Filters_in ret;
-	if (pf.has_zstd_compression())
-		ret.cmp_in.emplace();
+	if (pf.has_zstd_compression()){
+		auto &pcmp = pf.zstd_compression();
+		auto &cmp = ret.cmp_in.emplace();
+		cmp.window_log = pcmp.window_log();
+		if (pcmp.has_dictionary_id()){
+			auto it = find_if(dicts.begin(), dicts.end(), [&](auto &d){ return d->id == pcmp.dictionary_id(); });
+			if (it == dicts.end())
+				throw Exception("Unknown zstd dictionary {0}. Likely corrupt file.")(pcmp.dictionary_id());
+			cmp.dictionary = *it;
+		}
+	}
 	if (pf.has_chapoly_encryption()){
 		auto &enc = ret.enc_chapo_in.emplace();
 		auto penc = pf.chapoly_encryption();
@@ -58,6 +99,22 @@ Filters_in get_filters(const proto::Filters &pf){
 		auto penc = pf.chacha_encryption();
 		fill_enc_params(penc, enc);
 	}
+	if (pf.has_chapoly_stream_encryption()){
+		auto &enc = ret.enc_stream_in.emplace();
+		auto penc = pf.chapoly_stream_encryption();
+		fill_enc_params(penc, enc);
+	}
+	if (pf.has_aes_gcm_stream_encryption()){
+		auto &enc = ret.enc_stream_in.emplace();
+		enc.algorithm = Aead_stream::AES_256_GCM;
+		auto penc = pf.aes_gcm_stream_encryption();
+		fill_enc_params(penc, enc);
+	}
+	if (pf.has_aes_ctr_encryption()){
+		auto &enc = ret.enc_aes_ctr_in.emplace();
+		auto penc = pf.aes_ctr_encryption();
+		fill_enc_params(penc, enc);
+	}
 	return ret;
 }
 
@@ -84,28 +141,36 @@ Catalogue::Catalogue(std::filesystem::path &arc_path, std::string_view key, bool
 
 	try {
 		File_source src(cat_file_);
-		auto csumer_tmp = make_unique<Checksumer_xxhash>();
-		auto &csumer_xxhash = *csumer_tmp.get();
-		Pipe_csum_in cs_pipe(move(csumer_tmp));
-		Stream_in in(cat_file_);
-
-		in << cs_pipe << src;
+		Checksumer_xxhash csumer_xxhash;
+		Stream_in raw(cat_file_);
+		raw << src;
 
-		if (auto version = in.get_uint(); version > current_version)
+		if (auto version = raw.get_uint(); version > current_version)
 			throw Exception("Unsupported file version {0}. Max supported is {1}")(version, current_version);
 		Buffer buf;
 		google::protobuf::Arena arena;
-		auto header = get_message<proto::Catalog_header>(buf, in, csumer_xxhash, arena);
+		auto header = get_message<proto::Catalog_header>(buf, raw, csumer_xxhash, arena);
 		Filters_in filters;
 		if (header->has_filters()){
 			auto &f = header->filters();
-			if (f.has_chapoly_encryption()){
+			if (f.has_chapoly_encryption()){ // written before version 1
 				Chapoly &ein = filters.enc_chapo_in.emplace();
 				auto &iv = f.chapoly_encryption().iv();
 				if (iv.size() != ein.iv_size())
 					throw Exception("Wrong encryption IV size. Likely corrupt file.");
 				ein.iv(iv);
 				ein.set_password(key);
+				enc_.emplace(ein);
+			}
+			if (f.has_chapoly_stream_encryption() or f.has_aes_gcm_stream_encryption()){
+				Aead_stream &ein = filters.enc_stream_in.emplace();
+				auto &iv = f.has_chapoly_stream_encryption() ? f.chapoly_stream_encryption().iv() : f.aes_gcm_stream_encryption().iv();
+				if (f.has_aes_gcm_stream_encryption())
+					ein.algorithm = Aead_stream::AES_256_GCM;
+				if (iv.size() != ein.iv_size())
+					throw Exception("Wrong encryption IV size. Likely corrupt file.");
+				ein.iv(iv);
+				ein.set_password(key);
 				enc_ = ein;
 			}
 			if (f.has_zstd_compression())
@@ -114,31 +179,55 @@ Catalogue::Catalogue(std::filesystem::path &arc_path, std::string_view key, bool
 		if (!enc_ and !key.empty())
 			throw Exception("Archive was not encrypted before. You have to recreate it.");
 		Filtrator_in fltr(filters);
-		in << cs_pipe << fltr << src;
+		// the raw stream has read ahead past the header, so the filters pull from it
+		Stream_in in(cat_file_);
+		in << fltr << raw;
 
 		auto catalog = get_message<proto::Catalogue>(buf, in, csumer_xxhash, arena);
 		// TODO: add more checks?
+		for (auto &d: catalog->dictionaries()){
+			auto dict = make_shared<Zstd_dictionary>();
+			dict->id = d.id();
+			dict->data = d.data();
+			dictionaries_.push_back(move(dict));
+		}
 		for (auto &file: catalog->state_files()){
 			Fs_state_file state;
 			state.name = file.name();
 			state.time_created = file.time_created();
 			ASSERT(state.time_created);
 			if (file.has_filters())
-				state.filters = get_filters(file.filters());
+				state.filters = get_filters(file.filters(), dictionaries_);
 			fs_state_files_.push_back(move(state));
 		}
 
 		for (auto &file: catalog->content_files()){
 			File_content_ref ref;
 			if (file.has_filters())
-				ref.filters = get_filters(file.filters());
+				ref.filters = get_filters(file.filters(), dictionaries_);
 			ref.fname = file.name();
+			if (file.has_size() and file.has_block_size()){
+				if (file.block_size() == 0 or
+				    u64(file.block_xxhash_size()) != (file.size() + file.block_size() - 1) / file.block_size())
+					throw Exception("Wrong number of block checksums. Likely corrupt file.");
+				auto &bc = storage_csums_[ref.fname];
+				bc.size = file.size();
+				bc.block_size = file.block_size();
+				bc.csums.assign(file.block_xxhash().begin(), file.block_xxhash().end());
+			}
 			for (auto &r : file.refs()){
 				ref.from = r.from();
 				ref.to   = r.to();
 				ref.ref_count_ = r.ref_count();
 				ref.space_taken = r.space_taken();
 				ASSERT(ref.space_taken);
+				if (r.has_seek_offset() and r.has_seek_from()){
+					if (r.seek_from() > ref.from)
+						throw Exception("Wrong seek point. Likely corrupt file.");
+					ref.seek = {r.seek_offset(), r.seek_from()};
+				}
+				else
+					ref.seek.reset();
 				if (r.has_xxhash()){
 					ref.csum.emplace<Xx_hash>(r.xxhash());
 				}
@@ -150,13 +239,26 @@ Catalogue::Catalogue(std::filesystem::path &arc_path, std::string_view key, bool
 						throw Exception("Wrong blake2b size. Likely corrupt file.");
 					copy_n(pb2b.begin(), sizeof(b2b), b2b.begin());
 				}
+				else
+				if (r.has_xxh3_128()){
+					fill_hash(ref.csum.emplace<Xxh3_hash>(), r.xxh3_128(), "xxh3");
+				}
+				else
+				if (r.has_blake3()){
+					fill_hash(ref.csum.emplace<Blake3_hash>(), r.blake3(), "blake3");
+				}
 				else{
 					throw Exception("Checksum is not set. Likely corrupt file.");
 				}
+				if (r.has_content_id())
+					fill_hash(ref.content_id.emplace(), r.content_id(), "content id");
+				else
+					ref.content_id.reset();
 				ASSERT(ref.ref_count_ <= fs_state_files_.size());
-				content_refs_.insert(ref);
+				index_content(*content_refs_.insert(ref).first);
 			}
 		}
+		load_verified();
 		clean_up();
 	}
 	catch (...){
@@ -173,6 +275,12 @@ void Catalogue::password(string_view key)
 	enc_->set_password(key);
 }
 
+void Catalogue::cipher(Cipher c)
+{
+	if (enc_)
+		enc_->algorithm = c == Cipher::AES256 ? Aead_stream::AES_256_GCM : Aead_stream::CHACHA20_POLY1305;
+}
+
 Filesystem_state Catalogue::fs_state(size_t ndx)
 {
 	if (ndx >= fs_state_files_.size())
@@ -204,8 +312,11 @@ Filesystem_state Catalogue::empty_fs_state()
 {
 	Filters_out f;
 	f.cmp_out = {3};
-	if (enc_)
-		f.enc_chapo_out.emplace().randomize();
+	if (enc_){
+		auto &enc = f.enc_stream_out.emplace();
+		enc.randomize();
+		enc.algorithm = enc_->algorithm;
+	}
 	return Filesystem_state(cat_file_.parent_path(), f);
 }
 
@@ -217,14 +328,20 @@ void Catalogue::add_fs_state(Filesystem_state &&fs)
 	state_file.filters = fs.filters();
 	fs_state_files_.insert(fs_state_files_.begin(), state_file);
 
-	for (auto &file : fs.files()){
-		if (!file.content_ref.has_value())
-			continue;
-		auto [it, was_inserted] = content_refs_.insert(file.content_ref.value());
+	fs.for_each_ref([&](File_content_ref &new_ref){
+		auto [it, was_inserted] = content_refs_.insert(new_ref);
 		ASSERT( (was_inserted && it->ref_count_ == 0) || !was_inserted);
+		auto &cmp = it->filters.cmp_in;
+		if (was_inserted and cmp and cmp->dictionary){
+			auto id = cmp->dictionary->id;
+			if (ranges::none_of(dictionaries_, [id](auto &d){ return d->id == id; }))
+				dictionaries_.push_back(cmp->dictionary);
+		}
+		if (was_inserted)
+			index_content(*it);
 		File_content_ref &ref = const_cast<File_content_ref&>(*it);
 		ref.ref_count_++;
-	}
+	});
 }
 
 void Catalogue::remove_fs_state(Filesystem_state &&fs)
@@ -235,16 +352,106 @@ void Catalogue::remove_fs_state(Filesystem_state &&fs)
 	if (end != --fs_state_files_.end())
 		throw_inconsistent(__LINE__);
 	fs_state_files_.pop_back();
-	for (auto &file : fs.files()){
-		if (!file.content_ref.has_value())
-			continue;
-		auto it = content_refs_.find(file.content_ref.value());
+	fs.for_each_ref([&](File_content_ref &old_ref){
+		auto it = content_refs_.find(old_ref);
 		ASSERT(it != content_refs_.end());
 		if (it == content_refs_.end())
 			throw_inconsistent(__LINE__);
 		auto &ref = const_cast<File_content_ref&>(*it);
-		if (--ref.ref_count_ == 0)
-			content_refs_.erase(file.content_ref.value());
+		if (--ref.ref_count_ == 0){
+			// the index might point to another ref with the same content
+			if (ref.content_id){
+				auto ii = content_index_.find({ref.to - ref.from, *ref.content_id});
+				if (ii != content_index_.end() and ii->second == &ref)
+					content_index_.erase(ii);
+			}
+			content_refs_.erase(it);
+		}
+	});
+}
+
+void Catalogue::index_content(const File_content_ref &ref)
+{
+	if (ref.content_id)
+		content_index_[{ref.to - ref.from, *ref.content_id}] = &ref;
+}
+
+const File_content_ref *Catalogue::content(u64 size, const Content_id &id)
+{
+	auto it = content_index_.find({size, id});
+	return it == content_index_.end() ? nullptr : it->second;
+}
+
+std::unique_ptr<Checksumer> Catalogue::content_id_csumer()
+{
+	// keyed by the password, so the ids tell nothing about the content without it
+	auto key = Checksumer_blake3::derive_key("archivarius 2025-06 content id",
+	                                         enc_ ? enc_->key() : nullptr, enc_ ? enc_->key_size() : 0);
+	return make_unique<Checksumer_blake3>(key.data());
+}
+
+Content_id Catalogue::content_id(u8 *data, u64 size)
+{
+	auto cs = content_id_csumer();
+	cs->update(data, size);
+	return get<Blake3_hash>(cs->checksum());
+}
+
+void Catalogue::storage_csums(const std::string &content_fname, Block_csums &&csums)
+{
+	storage_csums_[content_fname] = move(csums);
+}
+
+const Block_csums *Catalogue::storage_csums(const std::string &content_fname)
+{
+	auto it = storage_csums_.find(content_fname);
+	return it == storage_csums_.end() ? nullptr : &it->second;
+}
+
+void Catalogue::verified(const std::string &content_fname, Time t)
+{
+	last_verified_[content_fname] = t;
+}
+
+std::optional<Time> Catalogue::last_verified(const std::string &content_fname)
+{
+	auto it = last_verified_.find(content_fname);
+	if (it == last_verified_.end())
+		return nullopt;
+	return it->second;
+}
+
+void Catalogue::load_verified()
+{
+	ifstream in(archive_path() / verified_filename);
+	Time t;
+	string fname;
+	while (in >> t and in.get() == ' ' and getline(in, fname))
+		last_verified_[fname] = t;
+}
+
+void Catalogue::save_verified()
+{
+	auto file = archive_path() / verified_filename;
+	auto new_file = file;
+	new_file += ".tmp";
+	try {
+		{
+			auto used = used_files(); // drops the removed content files
+			ofstream out(new_file, ios::trunc);
+			for (auto &[fname, t] : last_verified_)
+				if (used.contains(fname))
+					out << t << ' ' << fname << '\n';
+			out.close();
+			if (!out)
+				throw Exception("Write failed");
+		}
+		fs::rename(new_file, file);
+	}
+	catch (...){
+		error_code ec;
+		fs::remove(new_file, ec);
+		throw_with_nested( Exception( "Can't save {0}" )(file) );
 	}
 }
 
@@ -267,9 +474,11 @@ void Catalogue::commit()
 			auto f = hdr.mutable_filters();
 			f->mutable_zstd_compression();
 			if (enc_){
-				auto enc = f->mutable_chapoly_encryption();
 				enc_->randomize_iv();
-				enc->set_iv(enc_->iv(), enc_->iv_size());
+				if (enc_->algorithm == Aead_stream::AES_256_GCM)
+					f->mutable_aes_gcm_stream_encryption()->set_iv(enc_->iv(), enc_->iv_size());
+				else
+					f->mutable_chapoly_stream_encryption()->set_iv(enc_->iv(), enc_->iv_size());
 			}
 			put_message(hdr, buf, out, csumer_xxhash);
 		}
@@ -290,6 +499,16 @@ void Catalogue::commit()
 				add_filters(f, fsf.filters);
 			}
 		}
+		unordered_set<u32> used_dicts;
+		for (auto &r : content_refs_)
+			if (r.filters.cmp_in and r.filters.cmp_in->dictionary)
+				used_dicts.insert(r.filters.cmp_in->dictionary->id);
+		erase_if(dictionaries_, [&](auto &d){ return !used_dicts.contains(d->id); });
+		for (auto &d : dictionaries_){
+			auto pd = cat_msg->add_dictionaries();
+			pd->set_id(d->id);
+			pd->set_data(d->data);
+		}
 		string_view fn;
 		proto::Content_file *cfile;
 		for (auto &rc : content_refs_){
@@ -298,6 +517,12 @@ void Catalogue::commit()
 				fn = r.fname;
 				cfile = cat_msg->add_content_files();
 				cfile->set_name(r.fname);
+				if (auto it = storage_csums_.find(r.fname); it != storage_csums_.end()){
+					auto &bc = it->second;
+					cfile->set_size(bc.size);
+					cfile->set_block_size(bc.block_size);
+					cfile->mutable_block_xxhash()->Add(bc.csums.begin(), bc.csums.end());
+				}
 				if (r.filters){
 					auto f = cfile->mutable_filters();
 					add_filters(f, r.filters);
@@ -310,10 +535,20 @@ void Catalogue::commit()
 			ref->set_space_taken(r.space_taken);
 			ASSERT(r.ref_count_);
 			ref->set_ref_count(r.ref_count_);
+			if (r.seek){
+				ref->set_seek_offset(r.seek->offset);
+				ref->set_seek_from(r.seek->from);
+			}
 			if (auto h = get_if<Xx_hash>(&r.csum))
 				ref->set_xxhash(*h);
 			if (auto h = get_if<Blake2b_hash>(&r.csum))
 				ref->set_blake2b(h, sizeof(*h));
+			if (auto h = get_if<Xxh3_hash>(&r.csum))
+				ref->set_xxh3_128(h, sizeof(*h));
+			if (auto h = get_if<Blake3_hash>(&r.csum))
+				ref->set_blake3(h, sizeof(*h));
+			if (r.content_id)
+				ref->set_content_id(&*r.content_id, sizeof(*r.content_id));
 		}
 		put_message(*cat_msg, buf, out, csumer_xxhash);
 		out.finish();
@@ -335,6 +570,7 @@ std::unordered_set<string> Catalogue::used_files()
 {
 	std::unordered_set<string> ret;
 	ret.insert(cat_filename);
+	ret.insert(verified_filename);
 	for (auto &r : content_refs_)
 		ret.insert(r.fname);
 	for (auto &fs : fs_state_files_)
@@ -2,6 +2,8 @@
 #include "file_content_ref.h"
 #include "filesystem_state.h"
 #include "platform.h"
+#include "piping_block_csum.h"
+#include "checksumer.h"
 
 namespace archi{
 
@@ -14,6 +16,8 @@ public:
 	std::filesystem::path archive_path();
 
 	void password(std::string_view password);
+	/// cipher for the catalogue and new states. the one it was saved with, by default
+	void cipher(Cipher c);
 
 	// from newest to oldest
 	auto state_times(){
@@ -38,27 +42,53 @@ public:
 		return content_refs_ | std::views::all;
 	}
 
+	/// stored content of such size and id. nullptr if there is none
+	const File_content_ref *content(u64 size, const Content_id &id);
+	/// computes Content_id. it's keyed by the password, if the archive is encrypted
+	std::unique_ptr<Checksumer> content_id_csumer();
+	Content_id content_id(u8 *data, u64 size);
+
+	/// sets storage checksums for a newly created content file
+	void storage_csums(const std::string &content_fname, Block_csums &&csums);
+	/// nullptr if the content file doesn't have them
+	const Block_csums *storage_csums(const std::string &content_fname);
+
+	/// remembers when the content file was successfully verified
+	void verified(const std::string &content_fname, Time t);
+	std::optional<Time> last_verified(const std::string &content_fname);
+	/// writes the verification times. they are kept next to the catalogue, commit() doesn't touch them
+	void save_verified();
+
+	/// the newest of dictionaries used by content files. nullptr if none
+	std::shared_ptr<const Zstd_dictionary> zstd_dictionary();
+
 	void commit();
 private:
 
 	std::set<File_content_ref> content_refs_;
+	std::map<std::pair<u64, Content_id>, const File_content_ref*> content_index_; // of content_refs_ by size and id
 	struct Fs_state_file{
 		std::string name;
 		Time        time_created;
 		Filters_in  filters;
 	};
 	std::vector<Fs_state_file> fs_state_files_; // sorted from newest to oldest
+	std::vector<std::shared_ptr<const Zstd_dictionary>> dictionaries_; // from older to newer
+	std::unordered_map<std::string, Block_csums> storage_csums_; // by content file name
+	std::unordered_map<std::string, Time> last_verified_; // by content file name
 	std::filesystem::path cat_file_;
 	std::unique_ptr<File_lock> file_lock_;
-	std::optional<Chapoly> enc_;
+	std::optional<Aead_stream> enc_;
 
 	// includes the catalogue filename itself.
 	// basically files which are not in the returned set can be safely deleted.
 	std::unordered_set<std::string> used_files();
 	// removes everything which is not in used_files
 	void clean_up();
+	void load_verified();
 	void throw_inconsistent(uint line);
 	File_content_ref map_ref(File_content_ref &r);
+	void index_content(const File_content_ref &ref);
 };
 
 static_assert (std::is_nothrow_move_constructible<Catalogue>::value);
@@ -69,6 +99,12 @@ std::filesystem::path Catalogue::archive_path()
 	return cat_file_.parent_path();
 }
 
+inline
+std::shared_ptr<const Zstd_dictionary> Catalogue::zstd_dictionary()
+{
+	return dictionaries_.empty() ? nullptr : dictionaries_.back();
+}
+
 inline
 size_t Catalogue::num_states()
 {
@@ -6,8 +6,10 @@ namespace archi{
 
 typedef u64 Xx_hash;
 typedef std::array<u8, 64> Blake2b_hash;
+typedef std::array<u8, 16> Xxh3_hash; // XXH3-128, canonical (big endian)
+typedef std::array<u8, 32> Blake3_hash;
 
-typedef std::variant<Xx_hash, Blake2b_hash> Checksum;
+typedef std::variant<Xx_hash, Blake2b_hash, Xxh3_hash, Blake3_hash> Checksum;
 
 inline
 bool operator == (const Checksum &a, const Checksum &b){
@@ -20,6 +22,14 @@ bool operator == (const Checksum &a, const Checksum &b){
 		ASSERT(holds_alternative<Blake2b_hash>(b));
 		return get<Blake2b_hash>(a) == get<Blake2b_hash>(b);
 	}
+	if ( holds_alternative<Xxh3_hash>(a) ){
+		ASSERT(holds_alternative<Xxh3_hash>(b));
+		return get<Xxh3_hash>(a) == get<Xxh3_hash>(b);
+	}
+	if ( holds_alternative<Blake3_hash>(a) ){
+		ASSERT(holds_alternative<Blake3_hash>(b));
+		return get<Blake3_hash>(a) == get<Blake3_hash>(b);
+	}
 	return false;
 }
 
@@ -0,0 +1,434 @@
+#include "checksumer_blake3.h"
+
+namespace archi{
+
+namespace{
+
+enum Flags : u32{
+	CHUNK_START = 1,
+	CHUNK_END = 2,
+	PARENT = 4,
+	ROOT = 8,
+	KEYED_HASH = 16,
+	DERIVE_KEY_CONTEXT = 32,
+	DERIVE_KEY_MATERIAL = 64
+};
+
+constexpr u32 iv[8] = {
+	0x6A09E667, 0xBB67AE85, 0x3C6EF372, 0xA54FF53A, 0x510E527F, 0x9B05688C, 0x1F83D9AB, 0x5BE0CD19
+};
+
+constexpr size_t block_len = 64;
+constexpr size_t chunk_len = 1024;
+constexpr size_t max_lanes = 16;
+
+/// message words for each round. the message is permuted between the rounds
+constexpr auto schedule = []{
+	constexpr u8 permutation[16] = {2, 6, 3, 10, 7, 0, 4, 13, 1, 11, 12, 5, 9, 14, 15, 8};
+	std::array<std::array<u8, 16>, 7> ret{};
+	for (u8 i = 0; i < 16; i++)
+		ret[0][i] = i;
+	for (size_t r = 1; r < 7; r++)
+		for (size_t i = 0; i < 16; i++)
+			ret[r][i] = ret[r - 1][permutation[i]];
+	return ret;
+}();
+
+// the rounds are written once, for a single u32 and for vectors of them, each lane hashing its own chunk.
+// vectors are GCC vector extensions, compiled to SSE, AVX2, AVX-512 or NEON, depending on the caller's target
+
+typedef u32 U32x4 __attribute__((vector_size(16)));
+typedef u32 U32x8 __attribute__((vector_size(32)));
+typedef u32 U32x16 __attribute__((vector_size(64)));
+typedef u8 U8x16 __attribute__((vector_size(16)));
+typedef u8 U8x32 __attribute__((vector_size(32)));
+typedef u8 U8x64 __attribute__((vector_size(64)));
+
+template<int N, class V, size_t... L> [[gnu::always_inline]] inline
+void rotr_bytes(V &x, std::index_sequence<L...>){
+	using Bytes = std::conditional_t<sizeof(V) == 16, U8x16, std::conditional_t<sizeof(V) == 32, U8x32, U8x64>>;
+	auto bytes = (Bytes)x;
+	x = (V)__builtin_shufflevector(bytes, bytes, ((L & ~size_t(3)) | ((L + N/8) & 3))...);
+}
+
+// in place, as a vector returned by a function without its target would change the ABI
+template<int N, class T> [[gnu::always_inline]] inline
+void rotr(T &x){
+	// rotations by whole bytes are single byte shuffles. AVX-512 has a vector rotation instead
+	if constexpr (!std::is_integral_v<T> and sizeof(T) < 64 and N % 8 == 0 and std::endian::native == std::endian::little)
+		rotr_bytes<N>(x, std::make_index_sequence<sizeof(T)>());
+	else
+		x = (x >> N) | (x << (32 - N));
+}
+
+template<class T> [[gnu::always_inline]] inline
+void g(T *s, int a, int b, int c, int d, const T &mx, const T &my){
+	s[a] = s[a] + s[b] + mx;
+	s[d] ^= s[a];
+	rotr<16>(s[d]);
+	s[c] = s[c] + s[d];
+	s[b] ^= s[c];
+	rotr<12>(s[b]);
+	s[a] = s[a] + s[b] + my;
+	s[d] ^= s[a];
+	rotr<8>(s[d]);
+	s[c] = s[c] + s[d];
+	s[b] ^= s[c];
+	rotr<7>(s[b]);
+}
+
+template<class T> [[gnu::always_inline]] inline
+void rounds(T (&s)[16], const T (&m)[16]){
+#pragma GCC unroll 7
+	for (size_t r = 0; r < 7; r++){
+		auto &sc = schedule[r];
+		g(s, 0, 4, 8, 12, m[sc[0]], m[sc[1]]);
+		g(s, 1, 5, 9, 13, m[sc[2]], m[sc[3]]);
+		g(s, 2, 6, 10, 14, m[sc[4]], m[sc[5]]);
+		g(s, 3, 7, 11, 15, m[sc[6]], m[sc[7]]);
+		g(s, 0, 5, 10, 15, m[sc[8]], m[sc[9]]);
+		g(s, 1, 6, 11, 12, m[sc[10]], m[sc[11]]);
+		g(s, 2, 7, 8, 13, m[sc[12]], m[sc[13]]);
+		g(s, 3, 4, 9, 14, m[sc[14]], m[sc[15]]);
+	}
+}
+
+inline
+u32 load_word(const u8 *from){
+	u32 ret;
+	memcpy(&ret, from, 4);
+	if constexpr (std::endian::native == std::endian::big)
+		ret = __builtin_bswap32(ret);
+	return ret;
+}
+
+void to_words(const u8 *from, u32 *to, size_t num_words){
+	for (size_t i = 0; i < num_words; i++, from += 4)
+		to[i] = load_word(from);
+}
+
+void compress(const u32 (&cv)[8], const u32 (&block)[16], u64 counter, u32 block_len, u32 flags, u32 (&out)[16]){
+	u32 s[16] = {
+		cv[0], cv[1], cv[2], cv[3], cv[4], cv[5], cv[6], cv[7],
+		iv[0], iv[1], iv[2], iv[3], u32(counter), u32(counter >> 32), block_len, flags
+	};
+	rounds(s, block);
+	for (int i = 0; i < 8; i++){
+		out[i] = s[i] ^ s[i + 8];
+		out[i + 8] = s[i + 8] ^ cv[i];
+	}
+}
+
+/// swaps the lanes of a and b, which have the bit H set in a, and not set in b
+template<size_t H, class V, size_t... L> [[gnu::always_inline]] inline
+void swap_lanes(V &a, V &b, std::index_sequence<L...>){
+	constexpr size_t lanes = sizeof...(L);
+	V na = __builtin_shufflevector(a, b, ((L & H) ? lanes + L - H : L)...);
+	V nb = __builtin_shufflevector(a, b, ((L & H) ? lanes + L : L + H)...);
+	a = na;
+	b = nb;
+}
+
+/// square transpose, in log2(lanes) steps of swapping blocks of lanes
+template<size_t H, class V, size_t lanes> [[gnu::always_inline]] inline
+void transpose(V (&rows)[lanes]){
+	if constexpr (H < lanes){
+#pragma GCC unroll 16
+		for (size_t r = 0; r < lanes; r++)
+			if ((r & H) == 0)
+				swap_lanes<H>(rows[r], rows[r + H], std::make_index_sequence<lanes>());
+		transpose<H*2>(rows);
+	}
+}
+
+/// message words of a block, one per lane. word i of lane j is at from + j*chunk_len + 4*i
+template<class V> [[gnu::always_inline]] inline
+void load_message(const u8 *from, V (&m)[16]){
+	constexpr size_t lanes = sizeof(V) / sizeof(u32);
+	if constexpr (std::endian::native == std::endian::big){
+		for (size_t i = 0; i < 16; i++)
+			for (size_t j = 0; j < lanes; j++)
+				m[i][j] = load_word(from + j*chunk_len + 4*i);
+	}
+	else{
+		// as many words of each chunk are loaded at once, as there are lanes, and transposed
+		for (size_t group = 0; group < 16; group += lanes){
+			V rows[lanes];
+#pragma GCC unroll 16
+			for (size_t j = 0; j < lanes; j++)
+				memcpy(&rows[j], from + j*chunk_len + 4*group, sizeof(V));
+			transpose<1>(rows);
+			for (size_t i = 0; i < lanes; i++)
+				m[group + i] = rows[i];
+		}
+	}
+}
+
+/// hashes as many whole chunks, as V has lanes, and returns their chaining values
+template<class V> [[gnu::always_inline]] inline
+void hash_chunks(const u8 *from, const u32 (&key)[8], u64 counter, u32 flags, u32 (*out)[8]){
+	constexpr size_t lanes = sizeof(V) / sizeof(u32);
+	V cv[8];
+	for (size_t i = 0; i < 8; i++)
+		cv[i] = V{} + key[i];
+	V counter_low, counter_high;
+	for (size_t j = 0; j < lanes; j++){
+		counter_low[j] = u32(counter + j);
+		counter_high[j] = u32((counter + j) >> 32);
+	}
+	for (size_t b = 0; b < chunk_len / block_len; b++){
+		V m[16];
+		load_message(from + b*block_len, m);
+		u32 block_flags = flags | (b == 0 ? CHUNK_START : 0) | (b == chunk_len / block_len - 1 ? CHUNK_END : 0);
+		V s[16] = {
+			cv[0], cv[1], cv[2], cv[3], cv[4], cv[5], cv[6], cv[7],
+			V{} + iv[0], V{} + iv[1], V{} + iv[2], V{} + iv[3],
+			counter_low, counter_high, V{} + u32(block_len), V{} + block_flags
+		};
+		rounds(s, m);
+		for (size_t i = 0; i < 8; i++)
+			cv[i] = s[i] ^ s[i + 8];
+	}
+	for (size_t j = 0; j < lanes; j++)
+		for (size_t i = 0; i < 8; i++)
+			out[j][i] = cv[i][j];
+}
+
+void hash_chunks_1(const u8 *from, const u32 (&key)[8], u64 counter, u32 flags, u32 (*out)[8]){
+	u32 cv[8];
+	std::copy_n(key, 8, cv);
+	for (size_t b = 0; b < chunk_len / block_len; b++){
+		u32 m[16];
+		to_words(from + b*block_len, m, 16);
+		u32 block_flags = flags | (b == 0 ? CHUNK_START : 0) | (b == chunk_len / block_len - 1 ? CHUNK_END : 0);
+		u32 s[16];
+		compress(cv, m, counter, block_len, block_flags, s);
+		std::copy_n(s, 8, cv);
+	}
+	std::copy_n(cv, 8, out[0]);
+}
+
+#if defined(__x86_64__)
+[[gnu::target("sse4.1")]]
+void hash_chunks_sse41(const u8 *from, const u32 (&key)[8], u64 counter, u32 flags, u32 (*out)[8]){
+	hash_chunks<U32x4>(from, key, counter, flags, out);
+}
+
+[[gnu::target("avx2")]]
+void hash_chunks_avx2(const u8 *from, const u32 (&key)[8], u64 counter, u32 flags, u32 (*out)[8]){
+	hash_chunks<U32x8>(from, key, counter, flags, out);
+}
+
+[[gnu::target("avx512f")]]
+void hash_chunks_avx512(const u8 *from, const u32 (&key)[8], u64 counter, u32 flags, u32 (*out)[8]){
+	hash_chunks<U32x16>(from, key, counter, flags, out);
+}
+#elif defined(__ARM_NEON)
+void hash_chunks_neon(const u8 *from, const u32 (&key)[8], u64 counter, u32 flags, u32 (*out)[8]){
+	hash_chunks<U32x4>(from, key, counter, flags, out);
+}
+#endif
+
+/// the widest implementation the cpu can run. chosen once, at start
+struct Simd{
+	size_t lanes;
+	void (*hash_chunks)(const u8 *from, const u32 (&key)[8], u64 counter, u32 flags, u32 (*out)[8]);
+};
+
+Simd pick_simd(){
+#if defined(__x86_64__)
+	__builtin_cpu_init(); // it may run before the constructors of libgcc
+	if (__builtin_cpu_supports("avx512f"))
+		return {16, hash_chunks_avx512};
+	if (__builtin_cpu_supports("avx2"))
+		return {8, hash_chunks_avx2};
+	if (__builtin_cpu_supports("sse4.1"))
+		return {4, hash_chunks_sse41};
+#elif defined(__ARM_NEON)
+	return {4, hash_chunks_neon};
+#endif
+	return {1, hash_chunks_1};
+}
+
+const Simd simd = pick_simd();
+
+}
+
+void Checksumer_blake3::Output::chaining_value(u32 (&to)[8]) const
+{
+	u32 out[16];
+	compress(cv, block, counter, block_len, flags, out);
+	std::copy_n(out, 8, to);
+}
+
+void Checksumer_blake3::Output::root_bytes(u8 *to, size_t size) const
+{
+	for (u64 n = 0; size; n++){
+		u32 out[16];
+		compress(cv, block, n, block_len, flags | ROOT, out);
+		for (size_t i = 0; i < 16 and size; i++){
+			for (int b = 0; b < 4 and size; b++, size--)
+				*to++ = out[i] >> (8*b);
+		}
+	}
+}
+
+Checksumer_blake3::Checksumer_blake3(const u8 *key)
+{
+	to_words(key, key_, 8);
+	flags_ = KEYED_HASH;
+	reset();
+}
+
+Checksumer_blake3::Checksumer_blake3(const u32 (&key)[8], u32 flags)
+{
+	std::copy_n(key, 8, key_);
+	flags_ = flags;
+	reset();
+}
+
+void Checksumer_blake3::reset()
+{
+	cv_stack_size_ = 0;
+	start_chunk(0);
+}
+
+void Checksumer_blake3::start_chunk(u64 counter)
+{
+	std::copy_n(key_, 8, chunk_cv_);
+	chunk_counter_ = counter;
+	block_size_ = 0;
+	blocks_compressed_ = 0;
+}
+
+Checksumer_blake3::Output Checksumer_blake3::chunk_output() const
+{
+	Output ret;
+	std::copy_n(chunk_cv_, 8, ret.cv);
+	u8 block[block_len] = {};
+	std::copy_n(block_, block_size_, block);
+	to_words(block, ret.block, 16);
+	ret.counter = chunk_counter_;
+	ret.block_len = block_size_;
+	ret.flags = flags_ | CHUNK_END | (blocks_compressed_ == 0 ? CHUNK_START : 0);
+	return ret;
+}
+
+void Checksumer_blake3::push_chunk_cv(const u32 (&cv)[8], u64 total_chunks)
+{
+	// merges complete subtrees. their number is the number of trailing zero bits
+	u32 new_cv[8];
+	std::copy_n(cv, 8, new_cv);
+	for (; (total_chunks & 1) == 0; total_chunks >>= 1){
+		ASSERT(cv_stack_size_);
+		Output parent;
+		std::copy_n(key_, 8, parent.cv);
+		std::copy_n(cv_stack_[--cv_stack_size_], 8, parent.block);
+		std::copy_n(new_cv, 8, parent.block + 8);
+		parent.counter = 0;
+		parent.block_len = block_len;
+		parent.flags = flags_ | PARENT;
+		parent.chaining_value(new_cv);
+	}
+	std::copy_n(new_cv, 8, cv_stack_[cv_stack_size_++]);
+}
+
+u64 Checksumer_blake3::hash_whole_chunks(const u8 *from, u64 size)
+{
+	ASSERT(block_size_ == 0 and blocks_compressed_ == 0);
+	// the last chunk is left, as it may be the root
+	u64 done = 0;
+	u32 cvs[max_lanes][8];
+	auto hash = [&](auto hash_chunks, size_t lanes){
+		for (; size - done > lanes * chunk_len; done += lanes * chunk_len){
+			hash_chunks(from + done, key_, chunk_counter_, flags_, cvs);
+			for (size_t i = 0; i < lanes; i++){
+				chunk_counter_++;
+				push_chunk_cv(cvs[i], chunk_counter_);
+			}
+		}
+	};
+	hash(simd.hash_chunks, simd.lanes);
+	hash(hash_chunks_1, 1);
+	start_chunk(chunk_counter_);
+	return done;
+}
+
+void Checksumer_blake3::update(u8 *from, u64 size)
+{
+	while (size){
+		if (blocks_compressed_ * block_len + block_size_ == chunk_len){
+			u32 cv[8];
+			chunk_output().chaining_value(cv);
+			push_chunk_cv(cv, chunk_counter_ + 1);
+			start_chunk(chunk_counter_ + 1);
+		}
+		if (blocks_compressed_ == 0 and block_size_ == 0 and size > chunk_len){
+			auto n = hash_whole_chunks(from, size);
+			from += n;
+			size -= n;
+		}
+		// a full block is compressed only when more input comes, as the last one of a chunk is flagged
+		if (block_size_ == block_len){
+			u32 words[16];
+			to_words(block_, words, 16);
+			u32 out[16];
+			compress(chunk_cv_, words, chunk_counter_, block_len, flags_ | (blocks_compressed_ == 0 ? CHUNK_START : 0), out);
+			std::copy_n(out, 8, chunk_cv_);
+			blocks_compressed_++;
+			block_size_ = 0;
+		}
+		auto n = std::min<u64>(size, block_len - block_size_);
+		std::copy_n(from, n, block_ + block_size_);
+		block_size_ += n;
+		from += n;
+		size -= n;
+	}
+}
+
+Checksumer_blake3::Output Checksumer_blake3::root_output() const
+{
+	auto out = chunk_output();
+	for (auto i = cv_stack_size_; i-- > 0;){
+		u32 cv[8];
+		out.chaining_value(cv);
+		Output parent;
+		std::copy_n(key_, 8, parent.cv);
+		std::copy_n(cv_stack_[i], 8, parent.block);
+		std::copy_n(cv, 8, parent.block + 8);
+		parent.counter = 0;
+		parent.block_len = block_len;
+		parent.flags = flags_ | PARENT;
+		out = parent;
+	}
+	return out;
+}
+
+bool Checksumer_blake3::vectorized()
+{
+	return simd.lanes > 1;
+}
+
+Checksum Checksumer_blake3::checksum()
+{
+	Blake3_hash ret;
+	root_output().root_bytes(ret.data(), ret.size());
+	return ret;
+}
+
+std::array<u8, Checksumer_blake3::key_size> Checksumer_blake3::derive_key(std::string_view context, const u8 *material, size_t size)
+{
+	Checksumer_blake3 ctx_hasher(iv, DERIVE_KEY_CONTEXT);
+	ctx_hasher.update((u8*)context.data(), context.size());
+	std::array<u8, key_size> context_key;
+	ctx_hasher.root_output().root_bytes(context_key.data(), context_key.size());
+	u32 context_key_words[8];
+	to_words(context_key.data(), context_key_words, 8);
+	Checksumer_blake3 hasher(context_key_words, DERIVE_KEY_MATERIAL);
+	hasher.update(const_cast<u8*>(material), size);
+	std::array<u8, key_size> ret;
+	hasher.root_output().root_bytes(ret.data(), ret.size());
+	return ret;
+}
+
+}
@@ -0,0 +1,54 @@
+#pragma once
+#include "checksumer.h"
+
+namespace archi{
+
+/// keyed BLAKE3
+class Checksumer_blake3 : public Checksumer
+{
+public:
+	static constexpr size_t key_size = 32;
+	explicit
+	Checksumer_blake3(const u8 *key);
+	Checksum checksum() override;
+	void reset() override;
+	void update(u8 *from, u64 size) override;
+
+	/// true if the cpu hashes several chunks at once. BLAKE2b is faster otherwise
+	static bool vectorized();
+	/// BLAKE3 in key derivation mode. context must be hardcoded and globally unique
+	static std::array<u8, key_size> derive_key(std::string_view context, const u8 *material, size_t size);
+private:
+	static constexpr size_t block_len = 64;
+	static constexpr size_t chunk_len = 1024;
+	struct Output{
+		u32 cv[8];
+		u32 block[16];
+		u64 counter;
+		u32 block_len;
+		u32 flags;
+		void chaining_value(u32 (&to)[8]) const;
+		void root_bytes(u8 *to, size_t size) const;
+	};
+	u32 key_[8];
+	u32 flags_;
+	// the chunk being hashed
+	u32 chunk_cv_[8];
+	u64 chunk_counter_;
+	u8  block_[block_len];
+	u32 block_size_;
+	u32 blocks_compressed_;
+	// chaining values of complete subtrees, one per set bit of chunk_counter_
+	u32 cv_stack_[54][8];
+	size_t cv_stack_size_;
+
+	Checksumer_blake3(const u32 (&key)[8], u32 flags);
+	void start_chunk(u64 counter);
+	Output chunk_output() const;
+	void push_chunk_cv(const u32 (&cv)[8], u64 total_chunks);
+	/// hashes whole chunks straight from the input, several at a time. returns the size hashed
+	u64 hash_whole_chunks(const u8 *from, u64 size);
+	Output root_output() const;
+};
+
+}
@@ -0,0 +1,36 @@
+#include "checksumer_xxh3.h"
+#include "checksumer_xxhash.h"
+
+namespace archi {
+
+struct Checksumer_xxh3::State{
+	XXH3_state_t s;
+};
+
+Checksumer_xxh3::Checksumer_xxh3() : state_(std::make_unique<State>())
+{
+	reset();
+}
+
+Checksumer_xxh3::~Checksumer_xxh3() = default;
+
+Checksum Checksumer_xxh3::checksum()
+{
+	XXH128_canonical_t c;
+	XXH128_canonicalFromHash(&c, XXH3_128bits_digest(&state_->s));
+	Xxh3_hash ret;
+	std::copy_n(c.digest, sizeof(c.digest), ret.begin());
+	return ret;
+}
+
+void Checksumer_xxh3::reset()
+{
+	XXH3_128bits_reset(&state_->s);
+}
+
+void Checksumer_xxh3::update(u8 *from, u64 size)
+{
+	XXH3_128bits_update(&state_->s, from, size);
+}
+
+}
@@ -0,0 +1,19 @@
+#pragma once
+#include "checksumer.h"
+
+namespace archi {
+
+/// XXH3-128
+class Checksumer_xxh3 : public Checksumer{
+public:
+	Checksumer_xxh3();
+	~Checksumer_xxh3();
+	Checksum checksum() override;
+	void reset() override;
+	void update(u8 *from, u64 size) override;
+private:
+	struct State;
+	std::unique_ptr<State> state_;
+};
+
+}
@@ -1,20 +1,38 @@
+// xxHash is compiled here, for all its users
+#define XXH_IMPLEMENTATION
 #include "checksumer_xxhash.h"
 
 namespace archi {
 
+Checksumer_xxhash::Checksumer_xxhash()
+{
+	reset();
+}
+
 Checksum Checksumer_xxhash::checksum()
 {
-	return state_.digest();
+	// the previous implementation skipped the lanes when exactly 32 bytes were streamed,
+	// archives keep those checksums
+	if (state_.total_len == 32) {
+		auto hash = state_.v[2] + XXH_PRIME64_5 + 32;
+		hash ^= hash >> 33;
+		hash *= XXH_PRIME64_2;
+		hash ^= hash >> 29;
+		hash *= XXH_PRIME64_3;
+		hash ^= hash >> 32;
+		return hash;
+	}
+	return XXH64_digest(&state_);
 }
 
 void Checksumer_xxhash::reset()
 {
-	state_.reset(0);
+	XXH64_reset(&state_, 0);
 }
 
 void Checksumer_xxhash::update(u8 *from, u64 size)
 {
-	state_.update(from, size);
+	XXH64_update(&state_, from, size);
 }
 
 }
@@ -1,15 +1,19 @@
 #pragma once
 #include "checksumer.h"
+#define XXH_STATIC_LINKING_ONLY // for the state struct
+#include "xxhash.h"
 
 namespace archi {
 
+/// XXH64
 class Checksumer_xxhash : public Checksumer{
 public:
+	Checksumer_xxhash();
 	Checksum checksum() override;
 	void reset() override;
 	void update(u8 *from, u64 size) override;
 private:
-	xxh::hash_state64_t state_{0};
+	XXH64_state_t state_;
 };
 
 }
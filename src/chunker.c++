@@ -0,0 +1,56 @@
+#include "chunker.h"
+
+using namespace std;
+
+namespace archi{
+
+
+// the gear table is part of the format in a way. changing it makes the chunks of the files already archived
+// never match the new ones
+static constexpr array<u64, 256> make_gear()
+{
+	array<u64, 256> ret{};
+	u64 s = 0x6172636869766172; // splitmix64
+	for (auto &g : ret){
+		u64 z = (s += 0x9e3779b97f4a7c15);
+		z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9;
+		z = (z ^ (z >> 27)) * 0x94d049bb133111eb;
+		g = z ^ (z >> 31);
+	}
+	return ret;
+}
+
+static constexpr auto gear = make_gear();
+
+// normalized chunking: a cut is harder to find before avg_size, and easier after it.
+// the hash is shifted left, so its top bits depend on the last 64 bytes
+static constexpr u64 mask_bits(size_t bits)
+{
+	return ~u64(0) << (64 - bits);
+}
+static constexpr u64 mask_small = mask_bits(bit_width(Chunker::avg_size) - 1 + 2);
+static constexpr u64 mask_large = mask_bits(bit_width(Chunker::avg_size) - 1 - 2);
+
+size_t Chunker::cut(const u8 *data, size_t size)
+{
+	if (size <= min_size)
+		return size;
+	size = min(size, max_size);
+	auto normal = min(size, avg_size);
+	u64 h = 0;
+	size_t i = min_size;
+	for (; i < normal; i++){
+		h = (h << 1) + gear[data[i]];
+		if (!(h & mask_small))
+			return i + 1;
+	}
+	for (; i < size; i++){
+		h = (h << 1) + gear[data[i]];
+		if (!(h & mask_large))
+			return i + 1;
+	}
+	return size;
+}
+
+
+}
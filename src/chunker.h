@@ -0,0 +1,22 @@
+#pragma once
+#include "precomp.h"
+
+namespace archi{
+
+
+/// content defined chunking (FastCDC). boundaries depend only on the bytes around them,
+/// so inserting or removing data in a file changes only the chunks next to the change
+class Chunker
+{
+public:
+	static constexpr size_t min_size = 256*1024;
+	static constexpr size_t avg_size = 1024*1024;
+	static constexpr size_t max_size = 4*1024*1024;
+
+	/// @returns the size of the chunk at the beginning of data.
+	/// less than max_size bytes of data are taken as the end of the file
+	static size_t cut(const u8 *data, size_t size);
+};
+
+
+}
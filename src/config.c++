@@ -2,6 +2,8 @@
 #include "config.h"
 #include "property_tree.h"
 
+#include <zstd.h>
+
 using namespace std;
 namespace fs=filesystem;
 using namespace property_tree;
@@ -58,7 +60,8 @@ static
 void fill_compression(Config &to, Property &p){
 	auto val = p.value_str();
 	if (val == "on"){
-		to.zstd.emplace();
+		if (!to.zstd)
+			to.zstd.emplace();
 		return;
 	}
 	if (val == "off"){
@@ -68,6 +71,29 @@ void fill_compression(Config &to, Property &p){
 	throw Exception("'compression' can only be 'on' or 'off'");
 }
 
+static
+void fill_zstd_param(int &to, ZSTD_cParameter param, Property &p){
+	auto val = p.value_i64();
+	auto bounds = ZSTD_cParam_getBounds(param);
+	if (ZSTD_isError(bounds.error) or val < bounds.lowerBound or val > bounds.upperBound)
+		throw Exception("line {0}: '{1}' must be from {2} to {3}")(p.orig_line(), p.name(), bounds.lowerBound, bounds.upperBound);
+	to = val;
+}
+
+static
+void fill_long_distance_matching(Config_zstd &to, Property &p){
+	auto val = p.value_str();
+	if (val == "on"){
+		to.long_distance_matching = true;
+		return;
+	}
+	if (val == "off"){
+		to.long_distance_matching = false;
+		return;
+	}
+	throw Exception("line {0}: 'compression-long-distance-matching' can only be 'on' or 'off'")(p.orig_line());
+}
+
 static const string conf_fn = "archivarius.conf"s;
 
 std::vector<Config> read_config(string_view filepath)
@@ -110,6 +136,8 @@ std::vector<Config> read_config(string_view filepath)
 				      "'task' named {0} already exist")(cfg.name, pt.orig_name(), pt.orig_line());
 				names.insert(cfg.name);
 				try {
+					Config_zstd zstd; // tuning options are kept, even if 'compression' comes after them
+					optional<Config_enc::Cipher> cipher;
 					for (auto &taskp : pt.subs()){
 						if (taskp.name() == "archive"){
 							if (!cfg.archive.empty())
@@ -151,12 +179,58 @@ std::vector<Config> read_config(string_view filepath)
 								throw Exception("line {0}: 'password' is already set")(taskp.orig_line());
 							cfg.enc.emplace().password = move(pwd);
 						}
+						else if (taskp.name() == "cipher"){
+							if (cipher)
+								throw Exception("line {0}: 'cipher' is already set")(taskp.orig_line());
+							auto c = taskp.value_str();
+							if (c == "chacha20")
+								cipher = Config_enc::CHACHA20;
+							else if (c == "aes256")
+								cipher = Config_enc::AES256;
+							else
+								throw Exception("line {0}: 'cipher' can only be 'chacha20' or 'aes256'")(taskp.orig_line());
+						}
 						else if (taskp.name() == "min-content-file-size"){
 							cfg.min_content_file_size = taskp.value_u64();
 						}
+						else if (taskp.name() == "chunking-min-file-size"){
+							auto n = taskp.value_u64();
+							if (n == 0)
+								throw Exception("line {0}: 'chunking-min-file-size' can not be 0")(taskp.orig_line());
+							cfg.chunking_min_file_size = n;
+						}
+						else if (taskp.name() == "scan-threads"){
+							auto n = taskp.value_u64();
+							if (n == 0 or n > 1024)
+								throw Exception("line {0}: 'scan-threads' must be from 1 to 1024")(taskp.orig_line());
+							cfg.scan_threads = n;
+						}
+						else if (taskp.name() == "compression-level"){
+							fill_zstd_param(zstd.level, ZSTD_c_compressionLevel, taskp);
+						}
+						else if (taskp.name() == "compression-window-log"){
+							int wl;
+							fill_zstd_param(wl, ZSTD_c_windowLog, taskp);
+							zstd.window_log = wl;
+						}
+						else if (taskp.name() == "compression-long-distance-matching"){
+							fill_long_distance_matching(zstd, taskp);
+						}
+						else if (taskp.name() == "compression-threads"){
+							auto n = taskp.value_u64();
+							if (n > 256)
+								throw Exception("line {0}: 'compression-threads' must be from 0 to 256")(taskp.orig_line());
+							zstd.threads = n;
+						}
 						else
 							throw Exception("line {0}: unknown parameter {1}")(taskp.orig_line(), taskp.name());
 					}
+					if (cfg.zstd)
+						cfg.zstd = zstd;
+					if (cipher and !cfg.enc)
+						throw Exception("'cipher' requires 'password'");
+					if (cipher)
+						cfg.enc->cipher = *cipher;
 					if (cfg.root.empty() && cfg.files_to_archive.empty())
 						throw Exception("either 'root' or 'include' must be set");
 					if (cfg.archive.empty())
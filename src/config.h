@@ -3,11 +3,19 @@
 #include "precomp.h"
 
 struct Config_zstd{
-
+	int level = 11;
+	unsigned threads = 0;
+	unsigned window_log = 0; // 0 means default for the level
+	bool long_distance_matching = false;
 };
 
 struct Config_enc{
+	enum Cipher{
+		CHACHA20,
+		AES256
+	};
 	std::string password;
+	Cipher cipher = CHACHA20;
 };
 
 struct Config{
@@ -23,6 +31,8 @@ struct Config{
 	std::optional<Config_zstd> zstd;
 	std::optional<Config_enc>  enc;
 	uint64_t min_content_file_size = 0;
+	std::optional<uint64_t> chunking_min_file_size;
+	unsigned scan_threads = 1;
 };
 
 
@@ -0,0 +1,50 @@
+#include "content_reader.h"
+#include "pump.h"
+
+using namespace std;
+namespace fs = std::filesystem;
+
+namespace archi{
+
+
+Content_reader::Content_reader(const std::filesystem::path &archive_path) : arc_path_(archive_path)
+{
+	tmp_.resize(128*1024);
+}
+
+void Content_reader::open(const File_content_ref &ref)
+{
+	auto content_path = arc_path_ / ref.fname;
+	fname_.clear(); // in case of failure
+	in_ = content_path;
+	sin_.name(content_path);
+	num_pumped_ = 0;
+	auto filters = ref.filters;
+	filters_ = Filtrator_in(filters);
+	sin_ << filters_ << in_;
+	fname_ = ref.fname;
+}
+
+void Content_reader::read(const File_content_ref &ref, Stream_out &out)
+{
+	if (fname_ != ref.fname or num_pumped_ > ref.from)
+		open(ref);
+	auto seek = ref.seek;
+	if (!seek and !ref.filters.cmp_in and !ref.filters.enc_chapo_in) // older archives. content size is the same on disk
+		seek = {ref.from, ref.from};
+	try{
+		if (seek and seek->from > num_pumped_ and filters_.reposition(seek->offset)){
+			in_.seek(seek->offset);
+			num_pumped_ = seek->from;
+		}
+		pump(sin_, ref.from, nullptr, fname_, tmp_, num_pumped_);
+		pump(sin_, ref.to, &out, fname_, tmp_, num_pumped_);
+	}
+	catch(...){
+		fname_.clear(); // the position is unknown now
+		throw;
+	}
+}
+
+
+}
@@ -0,0 +1,65 @@
+#pragma once
+#include "precomp.h"
+#include "file_content_ref.h"
+#include "stream.h"
+#include "piping.h"
+#include "buffer.h"
+
+namespace archi{
+
+
+/// reads refs content from the content files.
+/// jumps over the data in between, if the content file allows it. otherwise reads through it
+class Content_reader
+{
+public:
+	explicit
+	Content_reader(const std::filesystem::path &archive_path);
+	Content_reader(Content_reader&) = delete;
+
+	/// pumps ref content to `out`. doesn't finish `out`.
+	/// it's the fastest if refs of the same content file come sorted
+	void read(const File_content_ref &ref, Stream_out &out);
+private:
+	std::filesystem::path arc_path_;
+	File_source in_;
+	Stream_in   sin_;
+	Filtrator_in filters_;
+	std::string fname_;
+	u64 num_pumped_ = 0;
+	Buffer tmp_;
+
+	void open(const File_content_ref &ref);
+};
+
+/// range of refs, which can be read independently from others
+struct Read_job{
+	size_t begin;
+	size_t end;
+};
+
+/// splits refs sorted by content files into jobs, which can be read in parallel.
+/// each content file is a job, and the big ones are split at seek points
+/// @param ref_at returns ref by its index
+template<class REF_AT>
+std::vector<Read_job> split_to_read_jobs(size_t num_refs, REF_AT &&ref_at)
+{
+	static const u64 max_job_size = 64*1024*1024;
+	std::vector<Read_job> ret;
+	u64 job_from = 0;
+	for (size_t i = 0; i < num_refs; i++){
+		const File_content_ref &ref = ref_at(i);
+		bool new_job = ret.empty() or ref_at(i - 1).fname != ref.fname;
+		if (!new_job and ref.seek and ref.from - job_from >= max_job_size)
+			new_job = true;
+		if (new_job){
+			ret.push_back({i, i});
+			job_from = ref.from;
+		}
+		ret.back().end = i + 1;
+	}
+	return ret;
+}
+
+
+}
@@ -0,0 +1,256 @@
+#include "dir_walker.h"
+#include "exception.h"
+#include "globals.h"
+
+#include <fcntl.h>
+
+using namespace std;
+namespace fs = std::filesystem;
+
+namespace archi{
+
+
+Dir_walker::Dir_walker(uint num_threads)
+{
+	if (num_threads <= 1)
+		return;
+	for (uint i = 0; i < num_threads; i++)
+		queues_.push_back(make_unique<Work_queue>());
+	for (uint i = 0; i < num_threads; i++)
+		workers_.emplace_back([this, i]{ work(i); });
+}
+
+Dir_walker::~Dir_walker()
+{
+	{
+		lock_guard lk(sched_mtx_);
+		stop_ = true;
+	}
+	sched_cv_.notify_all();
+	for (auto &w : workers_)
+		w.join();
+}
+
+File_source Dir_walker::Item::open() const
+{
+	auto ret = dir ? File_source(dir->get(), path) : File_source(path);
+	if (file and !file->holes.empty())
+		ret.skip(file->holes);
+	return ret;
+}
+
+void Dir_walker::Item::find_holes()
+{
+	if (!sparse or !file)
+		return;
+	file->holes.clear(); // open() would skip them
+	file->holes = open().find_holes(size);
+}
+
+u64 Dir_walker::Item::content_size() const
+{
+	u64 ret = size;
+	if (file)
+		for (auto &h : file->holes)
+			ret -= min(h.size, ret);
+	return ret;
+}
+
+Dir_walker::Item Dir_walker::scan(const std::filesystem::path &path)
+{
+	Item ret;
+	ret.path = path;
+	scan_entry(ret, AT_FDCWD, path.c_str(), Dir_reader::UNKNOWN);
+	return ret;
+}
+
+void Dir_walker::walk(const std::filesystem::path &dir,
+                      const std::function<void (Item &)> &on_item,
+                      const std::function<void (const std::filesystem::path &, std::string &&)> &on_dir_error)
+{
+	Dir d(fs::path{dir});
+	consume(d, on_item, on_dir_error);
+}
+
+void Dir_walker::work(size_t ndx)
+{
+	while (true){
+		{
+			unique_lock lk(sched_mtx_);
+			sched_cv_.wait(lk, [this]{
+				return stop_ or (num_queued_ > 0 and num_scanned_ahead_ < max_scanned_ahead);
+			});
+			if (stop_)
+				return;
+		}
+		auto d = pop_or_steal(ndx);
+		if (!d)
+			continue;
+		auto expected = QUEUED;
+		if (!d->state.compare_exchange_strong(expected, SCANNING))
+			continue; // walk() got to it first
+		scan(*d);
+		enqueue(ndx, d->subdirs);
+		num_scanned_ahead_++;
+		{
+			lock_guard lk(scanned_mtx_);
+			d->state = SCANNED;
+		}
+		scanned_cv_.notify_all();
+	}
+}
+
+Dir_walker::Dir_ptr Dir_walker::pop_or_steal(size_t ndx)
+{
+	Dir_ptr ret;
+	{ // own queue is used as a stack, so the worker goes depth first, as the consumer does
+		auto &q = *queues_[ndx];
+		lock_guard lk(q.mtx);
+		if (!q.dirs.empty()){
+			ret = move(q.dirs.back());
+			q.dirs.pop_back();
+		}
+	}
+	// steal from the other end, where the directories closer to the root are
+	for (size_t i = 1; !ret and i < queues_.size(); i++){
+		auto &q = *queues_[(ndx + i) % queues_.size()];
+		lock_guard lk(q.mtx);
+		if (!q.dirs.empty()){
+			ret = move(q.dirs.front());
+			q.dirs.pop_front();
+		}
+	}
+	if (ret)
+		num_queued_--;
+	return ret;
+}
+
+void Dir_walker::enqueue(size_t ndx, std::vector<Dir_ptr> &dirs)
+{
+	if (queues_.empty() or dirs.empty())
+		return;
+	{
+		auto &q = *queues_[ndx];
+		lock_guard lk(q.mtx);
+		// reversed, so the first subdirectory is on top of the stack
+		for (auto &d : dirs | views::reverse)
+			q.dirs.push_back(d);
+	}
+	num_queued_ += dirs.size();
+	{
+		lock_guard lk(sched_mtx_);
+	}
+	sched_cv_.notify_all();
+}
+
+void Dir_walker::scan(Dir &d)
+{
+	try{
+		auto dir = make_shared<const Fd>(open_dir(d.path));
+		Dir_reader reader(*dir);
+		Dir_reader::Entry e;
+		while (reader.next(e)){
+			if (e.type == Dir_reader::OTHER)
+				continue;
+			auto p = d.path / e.name;
+			if (files_to_exclude and files_to_exclude->contains(p))
+				continue;
+			auto &item = d.items.emplace_back();
+			item.path = move(p);
+			item.dir = dir;
+			scan_entry(item, dir->get(), e.name, e.type);
+			bool is_dir = item.file ? item.file->type == Filesystem_state::DIR : e.type == Dir_reader::DIRECTORY;
+			if (is_dir)
+				d.subdirs.push_back(make_shared<Dir>(fs::path(item.path)));
+			if (!item.file and item.error.empty())
+				d.items.pop_back(); // not supported file type
+		}
+	}
+	catch(std::exception &exp){
+		// same as a recursive walk would do: whatever is inside is not reachable
+		d.subdirs.clear();
+		d.error = message(exp);
+	}
+}
+
+void Dir_walker::scan_entry(Item &item, int dir_fd, const char *name, Dir_reader::Type type)
+{
+	try{
+		Filesystem_state::File file;
+		file.path = root.empty() ? item.path : item.path.lexically_relative(root);
+		if (type == Dir_reader::SYMLINK){
+			// symlinks attributes are not stored, so no need to stat them
+			file.type = Filesystem_state::SYMLINK;
+			file.symlink_target = read_link_at(dir_fd, name);
+			item.file = move(file);
+			return;
+		}
+		auto st = stat_at(dir_fd, name);
+		if (st.type == fs::file_type::regular)
+			file.type = Filesystem_state::FILE;
+		else if (st.type == fs::file_type::directory)
+			file.type = Filesystem_state::DIR;
+		else if (st.type == fs::file_type::symlink){
+			file.type = Filesystem_state::SYMLINK;
+			file.symlink_target = read_link_at(dir_fd, name);
+		} else
+			return;
+		if (file.type != Filesystem_state::SYMLINK){
+			file.unix_permissions = st.permissions;
+			file.mod_time = st.mod_time;
+			if (process_acls){
+				file.acl = get_acl_at(dir_fd, name);
+				if (file.type == Filesystem_state::DIR)
+					file.default_acl = get_default_acl_at(dir_fd, name);
+			}
+			if (file.type == Filesystem_state::FILE){
+				item.size = st.size;
+				item.sparse = st.allocated < st.size;
+				file.inode = {st.device, st.inode, st.size, st.change_time};
+			}
+		}
+		item.file = move(file);
+	}
+	catch(std::exception &exp){
+		item.file.reset();
+		item.error = message(exp);
+	}
+}
+
+void Dir_walker::wait_scanned(Dir &d)
+{
+	auto expected = QUEUED;
+	if (d.state.compare_exchange_strong(expected, SCANNING)){
+		// nobody has taken it yet. no point waiting
+		scan(d);
+		enqueue(0, d.subdirs);
+		num_scanned_ahead_++;
+		d.state = SCANNED;
+		return;
+	}
+	unique_lock lk(scanned_mtx_);
+	scanned_cv_.wait(lk, [&d]{ return d.state == SCANNED; });
+}
+
+void Dir_walker::consume(Dir &d,
+                         const std::function<void (Item &)> &on_item,
+                         const std::function<void (const std::filesystem::path &, std::string &&)> &on_dir_error)
+{
+	wait_scanned(d);
+	for (auto &item : d.items)
+		on_item(item);
+	if (!d.error.empty())
+		on_dir_error(d.path, move(d.error));
+	d.items = {};
+	auto subdirs = move(d.subdirs);
+	num_scanned_ahead_--;
+	{
+		lock_guard lk(sched_mtx_);
+	}
+	sched_cv_.notify_all();
+	for (auto &s : subdirs)
+		consume(*s, on_item, on_dir_error);
+}
+
+
+}
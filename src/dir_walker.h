@@ -0,0 +1,104 @@
+#pragma once
+#include "precomp.h"
+#include "filesystem_state.h"
+#include "platform.h"
+#include "piping.h"
+
+namespace archi{
+
+
+/**
+ * @brief Scans directory trees with several threads.
+ * Directories are distributed among the threads, each of which has its own queue,
+ * and steals from others when it runs out of work.
+ * The results are handed out on the calling thread, in exactly the same order
+ * a single threaded depth first walk would produce them: entries of a directory first,
+ * then its subdirectories, one by one.
+ */
+class Dir_walker
+{
+public:
+	struct Item{
+		std::filesystem::path path; // as it is on disk
+		std::optional<Filesystem_state::File> file; // not set for unsupported file types, or if scanning failed
+		u64 size = 0; // only for regular files
+		bool sparse = false; // takes less space on disk than its size. it may have holes
+		std::string error; // not empty if scanning failed
+		std::shared_ptr<const Fd> dir; // the containing directory, if it is still open
+
+		/// opens the file for reading. relative to the containing directory, if possible.
+		/// the holes in file->holes are skipped
+		File_source open() const;
+		/// fills file->holes, if the file is sparse
+		void find_holes();
+		/// size of the file without its holes
+		u64 content_size() const;
+	};
+
+	std::filesystem::path root; // paths in Filesystem_state::File are relative to it
+	const std::unordered_set<std::filesystem::path> *files_to_exclude = nullptr;
+	bool process_acls = false;
+
+	/// @param num_threads number of scanning threads. if it's 1 or less,
+	/// everything is scanned by the thread calling walk()
+	explicit
+	Dir_walker(uint num_threads);
+	Dir_walker(const Dir_walker&) = delete;
+	~Dir_walker();
+
+	/// scans a single file or dir. doesn't throw, errors are reported via Item::error
+	Item scan(const std::filesystem::path &path);
+
+	/// walks everything inside `dir`, not including the `dir` itself.
+	/// exceptions thrown by the callbacks abort the walk and propagate to the caller
+	void walk(const std::filesystem::path &dir,
+	          const std::function<void(Item &)> &on_item,
+	          const std::function<void(const std::filesystem::path &dir, std::string &&error)> &on_dir_error);
+private:
+	enum Dir_state: u8{
+		QUEUED,
+		SCANNING,
+		SCANNED,
+	};
+	struct Dir{
+		explicit
+		Dir(std::filesystem::path &&p): path(std::move(p)) {}
+		std::filesystem::path path;
+		std::atomic<Dir_state> state{QUEUED};
+		std::vector<Item> items;
+		std::vector<std::shared_ptr<Dir>> subdirs;
+		std::string error;
+	};
+	typedef std::shared_ptr<Dir> Dir_ptr;
+	struct Work_queue{
+		std::mutex mtx;
+		std::deque<Dir_ptr> dirs;
+	};
+
+	std::vector<std::unique_ptr<Work_queue>> queues_; // one per worker
+	std::vector<std::thread> workers_;
+	std::mutex sched_mtx_;
+	std::condition_variable sched_cv_; // idle workers sleep on it
+	std::mutex scanned_mtx_;
+	std::condition_variable scanned_cv_; // walk() waits on it for a directory to be scanned
+	std::atomic<size_t> num_queued_{0};
+	std::atomic<size_t> num_scanned_ahead_{0}; // scanned, but not yet handed out by walk()
+	bool stop_ = false; // guarded by sched_mtx_
+
+	// keeps workers from running too far ahead of the consumer.
+	// each scanned directory keeps its descriptor open until consumed.
+	static constexpr size_t max_scanned_ahead = 256;
+
+	void work(size_t ndx);
+	Dir_ptr pop_or_steal(size_t ndx);
+	void enqueue(size_t ndx, std::vector<Dir_ptr> &dirs);
+	void scan(Dir &d);
+	void scan_entry(Item &item, int dir_fd, const char *name, Dir_reader::Type type);
+	void wait_scanned(Dir &d);
+	void consume(Dir &d,
+	             const std::function<void(Item &)> &on_item,
+	             const std::function<void(const std::filesystem::path &dir, std::string &&error)> &on_dir_error);
+};
+
+
+}
@@ -3,12 +3,20 @@
 
 namespace archi{
 
+/// what a task encrypts its archive with
+enum class Cipher{
+	CHACHA20, // ChaCha20 for content, ChaCha20Poly1305 for the catalogue and states
+	AES256    // AES-256/CTR for content, AES-256/GCM for the catalogue and states
+};
 
 class Encryption_params{
 public:
 	u8* key(){
 		return key_;
 	};
+	const u8* key() const{
+		return key_;
+	};
 	u8* iv(){
 		return iv_;
 	}
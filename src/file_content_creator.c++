@@ -1,5 +1,6 @@
 #include "file_content_creator.h"
-#include "checksumer_blake2b.h"
+#include "checksumer_xxh3.h"
+#include "checksumer_blake3.h"
 #include "globals.h"
 
 
@@ -14,29 +15,52 @@ File_content_creator::File_content_creator(const std::filesystem::path &arc_path
 {
 	out_.error_tag(unrecoverable_output_problem);
 	arc_path_ = arc_path;
-	buff_.resize(128*1024);
+	filters_.enable_pipelining();
 }
 
+// dictionary is trained when the small files samples add up to that
+static const size_t samples_to_train = 8*1024*1024;
+// bigger files don't need a dictionary
+static const size_t max_sample_size = 16*1024;
+// restoring a single file needs to decompress at most that much before it
+static const u64 frame_size = 1024*1024;
+
 void File_content_creator::enable_compression(Zstd_out &p)
 {
 	ASSERT(!file_sink_);
+	zstd_ = p;
 	filters_.compression(p);
 }
 
-void File_content_creator::enable_encryption()
+void File_content_creator::use_dictionary(std::shared_ptr<const Zstd_dictionary> dict)
+{
+	ASSERT(!file_sink_ and zstd_);
+	zstd_->dictionary = move(dict);
+	filters_.compression(*zstd_);
+}
+
+void File_content_creator::train_dictionary()
+{
+	ASSERT(zstd_);
+	sampling_ = true;
+}
+
+void File_content_creator::enable_encryption(Cipher c)
 {
 	ASSERT(!file_sink_);
-	enc_.emplace();
-	cs_.csumer(make_unique<Checksumer_blake2b>());
+	if (c == Cipher::AES256)
+		enc_aes_.emplace();
+	else
+		enc_.emplace();
 }
 
-File_content_ref File_content_creator::add(const std::filesystem::path &file_name)
+File_content_ref File_content_creator::add(Source &src, const std::filesystem::path &file_name)
 {
-	if (!file_sink_ || file_sink_.bytes_written() >= min_file_size_){
+	if (!file_sink_ || file_sink_.bytes_written() >= min_file_size_ || new_dictionary_){
 		create_file();
 		bytes_pumped_ = 0;
+		frame_ = {0, 0};
 	}
-	File_source src(file_name);
 	in_.name(file_name);
 	in_ << src;
 	cs_.csumer()->reset();
@@ -44,18 +68,46 @@ File_content_ref File_content_creator::add(const std::filesystem::path &file_nam
 	ref.filters = filters_.get_filters();
 	ref.fname = fname_;
 	ref.from = bytes_pumped_;
+	ref.seek = frame_;
 	auto bytes_actually_wirtten = file_sink_.bytes_written();
-	Source::Pump_result res;
-	do{
-		res = in_.pump(buff_.raw(), buff_.size());
-		out_.pump(buff_.raw(), res.pumped_size);
-		bytes_pumped_ += res.pumped_size;
-	}while (!res.eof);
+	// small files fit into a single buffer and go through on this thread.
+	// for the bigger ones, reading, compression and encryption with writing run on their own threads,
+	// while this one does the checksum.
+	buff_.resize(buff_size); // it may have been swapped for a smaller one
+	auto res = in_.pump(buff_.raw(), buff_.size());
+	out_.pump(buff_.raw(), res.pumped_size);
+	bytes_pumped_ += res.pumped_size;
+	if (sampling_ and res.eof)
+		add_sample(buff_.raw(), res.pumped_size);
+	if (!res.eof){
+		in_ << read_ahead_ << src;
+		out_.run([&]{ filters_.pipelined(true); });
+		try{
+			// blocks read ahead are handed down the chain, which hands back ones already written
+			do{
+				res = in_.pump_buffer(buff_, buff_size);
+				out_.pump_buffer(buff_);
+				bytes_pumped_ += res.pumped_size;
+			}while (!res.eof);
+		}catch(...){
+			read_ahead_.cancel();
+			out_.run([&]{ filters_.pipelined(false); });
+			throw;
+		}
+	}
 	ref.to = bytes_pumped_;
+	// compressed frames hold several small files, so they still share some context
+	bool new_frame = !zstd_ or bytes_pumped_ - frame_.from >= frame_size;
 	out_.run([&]{
 		ref.csum = cs_.csumer()->checksum();
-		filters_.flush_der_kompressor();
+		if (new_frame)
+			filters_.end_frame();
+		else
+			filters_.flush_der_kompressor();
+		filters_.pipelined(false);
 	});
+	if (new_frame)
+		frame_ = {file_sink_.bytes_written(), bytes_pumped_};
 	ref.space_taken = file_sink_.bytes_written() - bytes_actually_wirtten;
 	comp_ratio_.original += ref.to - ref.from;
 	comp_ratio_.compressed += ref.space_taken;
@@ -68,14 +120,42 @@ File_content_ref File_content_creator::add(const std::filesystem::path &file_nam
 void File_content_creator::finish()
 {
 	out_.finish();
+	finish_file();
+}
+
+void File_content_creator::finish_file()
+{
+	if (!fname_.empty())
+		finished_files_.emplace_back(move(fname_), block_cs_.take());
+	fname_.clear();
+}
+
+void File_content_creator::add_sample(u8 *data, size_t size)
+{
+	if (size > max_sample_size)
+		return;
+	samples_.append(reinterpret_cast<char*>(data), size);
+	sample_sizes_.push_back(size);
+	if (samples_.size() < samples_to_train)
+		return;
+	sampling_ = false;
+	if (auto dict = Zstd_dictionary::train(samples_, sample_sizes_)){
+		zstd_->dictionary = move(dict);
+		new_dictionary_ = true;
+	}
+	samples_ = string();
+	sample_sizes_ = vector<size_t>();
 }
 
 void File_content_creator::create_file()
 {
 	try{
 		out_.finish();
-		if (cs_.csumer() == nullptr)
-			cs_.csumer(make_unique<Checksumer_xxhash>());
+		finish_file();
+		if (new_dictionary_){
+			filters_.compression(*zstd_);
+			new_dictionary_ = false;
+		}
 		fs::path file = arc_path_;
 		fname_ = make_unique_filename(arc_path_, "c");
 		file /= fname_;
@@ -85,7 +165,22 @@ void File_content_creator::create_file()
 			enc_->randomize();
 			filters_.encryption(*enc_);
 		}
-		out_ >> cs_ >> filters_ >> file_sink_;
+		if (enc_aes_){
+			enc_aes_->randomize();
+			filters_.encryption(*enc_aes_);
+		}
+		// encrypted content gets BLAKE3, keyed by the content file key.
+		// without SIMD it's slower than BLAKE2b, which is used then
+		Checksum enc_csum = Blake2b_hash{};
+		if (Checksumer_blake3::vectorized())
+			enc_csum = Blake3_hash{};
+		if (enc_)
+			cs_.csumer_for(enc_csum, &*enc_);
+		else if (enc_aes_)
+			cs_.csumer_for(enc_csum, &*enc_aes_);
+		else if (cs_.csumer() == nullptr)
+			cs_.csumer(make_unique<Checksumer_xxh3>());
+		out_ >> cs_ >> filters_ >> block_cs_ >> file_sink_;
 	}catch(...){
 		throw_with_nested(Exception(unrecoverable_output_problem));
 	}
@@ -5,6 +5,8 @@
 #include "stream.h"
 #include "filters.h"
 #include "piping_csum.h"
+#include "piping_async.h"
+#include "piping_block_csum.h"
 
 namespace archi{
 
@@ -16,15 +18,26 @@ public:
 	File_content_creator(const std::filesystem::path &arc_path);
 
 	void enable_compression(Zstd_out &p);
-	void enable_encryption();
+	void enable_encryption(Cipher c = Cipher::CHACHA20);
+	/// compression has to be enabled first
+	void use_dictionary(std::shared_ptr<const Zstd_dictionary> dict);
+	/// collects samples of small files. when there are enough of them, trains a dictionary
+	/// and starts a new content file, which uses it.
+	/// compression has to be enabled first
+	void train_dictionary();
+	/// trained or set by use_dictionary(). nullptr if none
+	std::shared_ptr<const Zstd_dictionary> dictionary();
 
 	void min_file_size(u64 bytes);
 	u64 min_file_size();
 
-	/// @param file_name full path to file, which content will be added to archive
-	File_content_ref add(const std::filesystem::path &file_name);
+	/// @param src opened file, which content will be added to archive
+	/// @param file_name full path to the file
+	File_content_ref add(Source &src, const std::filesystem::path &file_name);
 
 	void finish();
+	/// content files, which are complete, with their storage checksums. they are not returned again
+	std::vector<std::pair<std::string, Block_csums>> take_finished_files();
 	struct Compression_ratio{
 		u64 original;
 		u64 compressed; // can be 0
@@ -39,17 +52,30 @@ private:
 	std::filesystem::path arc_path_;
 	std::string   fname_;
 	Stream_in     in_;
+	Pipe_async_in read_ahead_;
 	Stream_out    out_;
 	File_sink     file_sink_;
+	Pipe_block_csum_out block_cs_;
+	std::vector<std::pair<std::string, Block_csums>> finished_files_;
 	Pipe_csum_out cs_;
 	u64 bytes_pumped_;
+	File_content_ref::Seek_point frame_; // where the current zstd frame starts
 	u64 min_file_size_;
 	Buffer buff_;
+	static constexpr size_t buff_size = 128*1024;
 	Filtrator_out filters_;
 	std::optional<Chacha> enc_;
+	std::optional<Aes_ctr> enc_aes_;
 	Compression_ratio comp_ratio_{0,0};
+	std::optional<Zstd_out> zstd_;
+	bool sampling_ = false;
+	bool new_dictionary_ = false; // a new content file is needed to use it
+	std::string samples_;
+	std::vector<size_t> sample_sizes_;
 
 	void create_file();
+	void finish_file();
+	void add_sample(u8 *data, size_t size);
 };
 
 inline
@@ -64,6 +90,18 @@ u64 File_content_creator::min_file_size()
 	return min_file_size_;
 }
 
+inline
+std::shared_ptr<const Zstd_dictionary> File_content_creator::dictionary()
+{
+	return zstd_ ? zstd_->dictionary : nullptr;
+}
+
+inline
+std::vector<std::pair<std::string, Block_csums>> File_content_creator::take_finished_files()
+{
+	return std::move(finished_files_);
+}
+
 inline
 File_content_creator::Compression_ratio File_content_creator::compression_statistic()
 {
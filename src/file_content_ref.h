@@ -6,6 +6,9 @@
 namespace archi{
 
 
+/// keyed BLAKE3 of content. the same content of different files, chunks and versions is stored once
+using Content_id = Blake3_hash;
+
 struct File_content_ref{
 	std::string fname;
 	u64 from;
@@ -13,6 +16,14 @@ struct File_content_ref{
 	u64 space_taken; // space taken in file. never 0
 	Checksum csum;
 	Filters_in filters;
+	// the closest point before `from`, where reading the content file can start from.
+	// not set in older archives
+	struct Seek_point{
+		u64 offset; // on disk
+		u64 from;   // in the content, as `from`
+	};
+	std::optional<Seek_point> seek;
+	std::optional<Content_id> content_id; // not set in older archives
 	u64 ref_count_ = 0;  // only Catalogue can change this
 };
 
@@ -48,12 +48,10 @@ Filesystem_state::Filesystem_state(
 	auto fn = arc_path_ / file_name();
 	Filtrator_in filtr(f);
 	File_source file(fn);
-	auto cs_tmp = make_unique<Checksumer_xxhash>();
-	auto &cs = *cs_tmp.get();
-	Pipe_csum_in cs_in(move(cs_tmp));
+	Checksumer_xxhash cs;
 
 	Stream_in in(fn);
-	in << cs_in << filtr << file;
+	in << filtr << file;
 
 	Buffer buf;
 	google::protobuf::Arena arena;
@@ -69,6 +67,13 @@ Filesystem_state::Filesystem_state(
 			incomplete_ref.from = ref.from();
 			f.content_ref = ref_mapper(incomplete_ref);
 		}
+		f.chunks.reserve(r.chunks_size());
+		for (auto &ref : r.chunks()){
+			File_content_ref incomplete_ref;
+			incomplete_ref.fname = ref.content_fname();
+			incomplete_ref.from = ref.from();
+			f.chunks.push_back(ref_mapper(incomplete_ref));
+		}
 		if (f.type == SYMLINK)
 			f.symlink_target = r.symlink_target();
 		else{
@@ -78,6 +83,15 @@ Filesystem_state::Filesystem_state(
 				f.unix_permissions = r.unix_permissions();
 			if (r.has_posix_acl())
 				f.acl = r.posix_acl();
+			if (r.has_inode()){
+				auto &i = r.inode();
+				f.inode = {i.device(), i.number(), i.size(), i.changed_nanoseconds()};
+			}
+			if (r.has_hard_link())
+				f.hard_link = r.hard_link();
+			f.holes.reserve(r.holes_size());
+			for (auto &h : r.holes())
+				f.holes.push_back({h.offset(), h.size()});
 			if (f.type == DIR and r.has_posix_default_acl())
 				f.default_acl = r.posix_default_acl();
 		}
@@ -89,17 +103,36 @@ void Filesystem_state::add(Filesystem_state::File &&f)
 {
 	ASSERT(!f.path.empty());
 	ASSERT(files_.find(f.path) == files_.end());
-	files_[f.path] = move(f);
+	auto &added = files_[f.path];
+	added = move(f);
+	if (added.inode)
+		by_inode_.try_emplace({added.inode->device, added.inode->number}, &added);
+}
+
+const Filesystem_state::File *Filesystem_state::get_if_same_inode(const Inode &inode, Time modified_time)
+{
+	auto it = by_inode_.find({inode.device, inode.number});
+	if (it == by_inode_.end())
+		return nullptr;
+	auto &was = *it->second;
+	// the same as get_if_unchanged(), but by the inode. ctime is no guard here, renaming a file changes it
+	if (was.inode->size != inode.size or was.mod_time != modified_time)
+		return nullptr;
+	return &was;
+}
+
+const Filesystem_state::File *Filesystem_state::get(const std::filesystem::path &path_in_archive)
+{
+	auto it = files_.find(path_in_archive);
+	return it != files_.end() ? &it->second : nullptr;
 }
 
-std::optional<File_content_ref> Filesystem_state::get_ref_if_exist(std::filesystem::path &path_in_archive, Time modified_time)
+const Filesystem_state::File *Filesystem_state::get_if_unchanged(const std::filesystem::path &path_in_archive, Time modified_time)
 {
 	auto it = files_.find(path_in_archive);
-	if (it == files_.end())
-		return optional<File_content_ref>();
-	if (it->second.mod_time.value() != modified_time)
-		return optional<File_content_ref>();
-	return it->second.content_ref;
+	if (it == files_.end() or it->second.type != FILE or it->second.mod_time != modified_time)
+		return nullptr;
+	return &it->second;
 }
 
 static proto::File_type to_proto(Filesystem_state::File_type ft){
@@ -139,6 +172,11 @@ void Filesystem_state::commit()
 			ref->set_content_fname(fref.fname);
 			ref->set_from(fref.from);
 		}
+		for (auto &c : f.chunks){
+			auto ref = rec->add_chunks();
+			ref->set_content_fname(c.fname);
+			ref->set_from(c.from);
+		}
 		if (SYMLINK == f.type)
 			rec->set_symlink_target(f.symlink_target);
 		if (f.mod_time)
@@ -149,6 +187,20 @@ void Filesystem_state::commit()
 			rec->set_posix_acl(f.acl);
 		if (!f.default_acl.empty())
 			rec->set_posix_default_acl(f.default_acl);
+		if (f.inode){
+			auto i = rec->mutable_inode();
+			i->set_device(f.inode->device);
+			i->set_number(f.inode->number);
+			i->set_size(f.inode->size);
+			i->set_changed_nanoseconds(f.inode->change_time);
+		}
+		if (!f.hard_link.empty())
+			rec->set_hard_link(f.hard_link);
+		for (auto &h : f.holes){
+			auto hole = rec->add_holes();
+			hole->set_offset(h.offset);
+			hole->set_size(h.size);
+		}
 	}
 	Buffer buf;
 	put_message(*state, buf, out, cs);
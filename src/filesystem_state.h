@@ -19,15 +19,28 @@ public:
 		SYMLINK,
 	};
 
+	/// a regular file on disk, as it was seen. it is found by this after renaming or moving
+	/// to another directory of the same file system
+	struct Inode{
+		u64  device;
+		u64  number;
+		u64  size;
+		Time change_time; // changes with any change of the file, including renaming. it's stored, but not matched
+	};
+
 	struct File {
 		std::filesystem::path path;
 		File_type  type;
 		std::optional<Time>   mod_time;
 		std::optional<File_content_ref> content_ref; // only for regular files with sizes > 0
+		std::vector<File_content_ref> chunks; // content of a big file, split to chunks. then content_ref is not set
 		std::filesystem::path	symlink_target;
 		std::string acl; // posix long format
 		std::string default_acl; // posix long format
 		std::optional<u16>    unix_permissions;
+		std::optional<Inode>  inode; // for regular files. not set in older archives
+		std::filesystem::path hard_link; // the file, added before, this one is a hard link to. its content is shared
+		std::vector<Hole> holes; // of a sparse file, in order. the content is what is between them
 	};
 
 	void add(File &&f);
@@ -35,21 +48,29 @@ public:
 	std::string_view file_name();
 	Time time_created();
 
-	std::optional<File_content_ref> get_ref_if_exist(
-	                                                std::filesystem::path &path_in_archive,
-	                                                Time modified_time );
+	/// the file on the path, modified since or not. nullptr if there is none
+	const File *get(const std::filesystem::path &path_in_archive);
+	/// the regular file on the path, if it wasn't modified since. nullptr otherwise
+	const File *get_if_unchanged(const std::filesystem::path &path_in_archive, Time modified_time);
+	/// the regular file on the same inode, if it wasn't modified since. it's found after renaming or moving. nullptr otherwise
+	const File *get_if_same_inode(const Inode &inode, Time modified_time);
 
 	// for (File &file: fss.files())...
 	auto files(){
 		return files_ | std::views::values;
 	}
 
+	/// calls f(File_content_ref&) once for each ref, even if several files or chunks share it
+	template<class F>
+	void for_each_ref(F &&f);
+
 	Filters_in filters();
 
 	void commit();
 private:
 	// key is pathname
 	std::unordered_map<std::filesystem::path, File> files_;
+	std::map<std::pair<u64, u64>, const File*> by_inode_; // files_ by device and inode number. the first one of hard links
 	std::string filename_;
 	std::filesystem::path arc_path_;
 	Time time_created_;
@@ -82,6 +103,22 @@ Time Filesystem_state::time_created()
 	return time_created_;
 }
 
+template<class F>
+void Filesystem_state::for_each_ref(F &&f)
+{
+	std::set<std::pair<std::string_view, u64>> seen;
+	auto visit = [&](File_content_ref &r){
+		if (seen.emplace(r.fname, r.from).second)
+			f(r);
+	};
+	for (auto &file : files()){
+		if (file.content_ref)
+			visit(*file.content_ref);
+		for (auto &c : file.chunks)
+			visit(c);
+	}
+}
+
 inline
 Filters_in Filesystem_state::filters()
 {
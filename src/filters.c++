@@ -1,8 +1,23 @@
 #include "filters.h"
 
+using namespace std;
+
 namespace archi{
 
 
+const Encryption_params *Filters_in::encryption() const
+{
+	if (enc_chapo_in)
+		return &*enc_chapo_in;
+	if (enc_chacha_in)
+		return &*enc_chacha_in;
+	if (enc_stream_in)
+		return &*enc_stream_in;
+	if (enc_aes_ctr_in)
+		return &*enc_aes_ctr_in;
+	return nullptr;
+}
+
 Filtrator_in::Filtrator_in()
 {
 
@@ -12,12 +27,16 @@ Filtrator_in::Filtrator_in(Filters_in &f)
 {
 	if (f.cmp_in)
 		compression(f.cmp_in.value());
-	ASSERT(!(f.enc_chapo_in and f.enc_chacha_in));
+	ASSERT(!!f.enc_chapo_in + !!f.enc_chacha_in + !!f.enc_stream_in + !!f.enc_aes_ctr_in <= 1);
 
 	if (f.enc_chapo_in)
 		encryption(f.enc_chapo_in.value());
 	if (f.enc_chacha_in)
 		encryption(f.enc_chacha_in.value());
+	if (f.enc_stream_in)
+		encryption(f.enc_stream_in.value());
+	if (f.enc_aes_ctr_in)
+		encryption(f.enc_aes_ctr_in.value());
 }
 
 Pipe_in &Filtrator_in::apply(Pipe_in &p)
@@ -35,33 +54,74 @@ Pipe_in &Filtrator_in::apply(Pipe_in &p)
 		*prev << *enc_pipe_chacha_in_;
 		prev = &*enc_pipe_chacha_in_;
 	}
+	if (enc_pipe_stream_in_){
+		*prev << *enc_pipe_stream_in_;
+		prev = &*enc_pipe_stream_in_;
+	}
+	if (enc_pipe_aes_ctr_in_){
+		*prev << *enc_pipe_aes_ctr_in_;
+		prev = &*enc_pipe_aes_ctr_in_;
+	}
 	return *prev;
 }
 
 void Filtrator_in::compression(Zstd_in &zin)
 {
-	cmp_pipe_in_.emplace();
+	cmp_pipe_in_.emplace(zin);
 }
 
 void Filtrator_in::encryption(Chapoly &ein)
 {
-	ASSERT(!enc_pipe_chacha_in_);
+	ASSERT(!enc_pipe_chacha_in_ and !enc_pipe_stream_in_ and !enc_pipe_aes_ctr_in_);
 	enc_pipe_chapo_in_.emplace(ein);
 }
 
 void Filtrator_in::encryption(Chacha &ein)
 {
-	ASSERT(!enc_pipe_chapo_in_);
+	ASSERT(!enc_pipe_chapo_in_ and !enc_pipe_stream_in_ and !enc_pipe_aes_ctr_in_);
 	enc_pipe_chacha_in_.emplace(ein);
 }
 
+void Filtrator_in::encryption(Aead_stream &ein)
+{
+	ASSERT(!enc_pipe_chapo_in_ and !enc_pipe_chacha_in_ and !enc_pipe_aes_ctr_in_);
+	enc_pipe_stream_in_.emplace(ein);
+}
+
+void Filtrator_in::encryption(Aes_ctr &ein)
+{
+	ASSERT(!enc_pipe_chapo_in_ and !enc_pipe_chacha_in_ and !enc_pipe_stream_in_);
+	enc_pipe_aes_ctr_in_.emplace(ein);
+}
+
+bool Filtrator_in::reposition(u64 pos)
+{
+	if (enc_pipe_chapo_in_ or enc_pipe_stream_in_) // authenticated as a whole
+		return false;
+	if (enc_pipe_chacha_in_)
+		enc_pipe_chacha_in_->seek(pos);
+	if (enc_pipe_aes_ctr_in_)
+		enc_pipe_aes_ctr_in_->seek(pos);
+	if (cmp_pipe_in_)
+		cmp_pipe_in_->reset();
+	return true;
+}
+
 Pipe_out &Filtrator_out::apply(Pipe_out &p)
 {
 	Pipe_out *prev = &p;
 	if (cmp_pipe_out_){
+		if (async_cmp_){
+			*prev >> *async_cmp_;
+			prev = async_cmp_.get();
+		}
 		*prev >> *cmp_pipe_out_;
 		prev = &*cmp_pipe_out_;
 	}
+	if (async_tail_){
+		*prev >> *async_tail_;
+		prev = async_tail_.get();
+	}
 	if (enc_pipe_chacha_out_){
 		*prev >> *enc_pipe_chacha_out_;
 		prev = &*enc_pipe_chacha_out_;
@@ -70,6 +130,14 @@ Pipe_out &Filtrator_out::apply(Pipe_out &p)
 		*prev >> *enc_pipe_chapo_out_;
 		prev = &*enc_pipe_chapo_out_;
 	}
+	if (enc_pipe_stream_out_){
+		*prev >> *enc_pipe_stream_out_;
+		prev = &*enc_pipe_stream_out_;
+	}
+	if (enc_pipe_aes_ctr_out_){
+		*prev >> *enc_pipe_aes_ctr_out_;
+		prev = &*enc_pipe_aes_ctr_out_;
+	}
 	return *prev;
 }
 
@@ -81,29 +149,47 @@ void Filtrator_out::compression(Zstd_out zout)
 
 void Filtrator_out::encryption(Chapoly &eout)
 {
-	ASSERT(!enc_pipe_chacha_out_);
+	ASSERT(!enc_pipe_chacha_out_ and !enc_pipe_stream_out_ and !enc_pipe_aes_ctr_out_);
 	enc_pipe_chapo_out_.emplace(eout);
 	enc_chapo_out_.emplace(eout);
 }
 
 void Filtrator_out::encryption(Chacha &eout)
 {
-	ASSERT(!enc_pipe_chapo_out_);
+	ASSERT(!enc_pipe_chapo_out_ and !enc_pipe_stream_out_ and !enc_pipe_aes_ctr_out_);
 	enc_pipe_chacha_out_.emplace(eout);
 	enc_chacha_out_.emplace(eout);
 }
 
+void Filtrator_out::encryption(Aead_stream &eout)
+{
+	ASSERT(!enc_pipe_chapo_out_ and !enc_pipe_chacha_out_ and !enc_pipe_aes_ctr_out_);
+	enc_pipe_stream_out_.emplace(eout);
+	enc_stream_out_.emplace(eout);
+}
+
+void Filtrator_out::encryption(Aes_ctr &eout)
+{
+	ASSERT(!enc_pipe_chapo_out_ and !enc_pipe_chacha_out_ and !enc_pipe_stream_out_);
+	enc_pipe_aes_ctr_out_.emplace(eout);
+	enc_aes_ctr_out_.emplace(eout);
+}
+
 void Filtrator_out::set_filters(Filters_out &f)
 {
 	// do not set twice
-	ASSERT(!enc_pipe_chacha_out_ and !enc_pipe_chapo_out_ and !cmp_pipe_out_);
+	ASSERT(!enc_pipe_chacha_out_ and !enc_pipe_chapo_out_ and !enc_pipe_stream_out_ and !enc_pipe_aes_ctr_out_ and !cmp_pipe_out_);
 	if (f.cmp_out)
 		compression(f.cmp_out.value());
-	ASSERT(!(f.enc_chapo_out and f.enc_chacha_out));
+	ASSERT(!!f.enc_chapo_out + !!f.enc_chacha_out + !!f.enc_stream_out + !!f.enc_aes_ctr_out <= 1);
 	if (f.enc_chapo_out)
 		encryption(f.enc_chapo_out.value());
 	if (f.enc_chacha_out)
 		encryption(f.enc_chacha_out.value());
+	if (f.enc_stream_out)
+		encryption(f.enc_stream_out.value());
+	if (f.enc_aes_ctr_out)
+		encryption(f.enc_aes_ctr_out.value());
 }
 
 Filters_in Filtrator_out::get_filters()
@@ -113,15 +199,47 @@ Filters_in Filtrator_out::get_filters()
 		ret.enc_chapo_in = *enc_chapo_out_;
 	if (enc_chacha_out_)
 		ret.enc_chacha_in = *enc_chacha_out_;
+	if (enc_stream_out_)
+		ret.enc_stream_in = *enc_stream_out_;
+	if (enc_aes_ctr_out_)
+		ret.enc_aes_ctr_in = *enc_aes_ctr_out_;
 	if (cmp_out_)
-		ret.cmp_in.emplace();
+		ret.cmp_in = cmp_out_->decompression_params();
 	return ret;
 }
 
+void Filtrator_out::enable_pipelining()
+{
+	async_cmp_ = make_unique<Pipe_async_out>();
+	async_tail_ = make_unique<Pipe_async_out>();
+}
+
+void Filtrator_out::pipelined(bool on)
+{
+	if (async_cmp_)
+		async_cmp_->async(on);
+	if (async_tail_)
+		async_tail_->async(on);
+}
+
+void Filtrator_out::end_frame()
+{
+	if (async_cmp_)
+		async_cmp_->sync();
+	if (cmp_pipe_out_)
+		cmp_pipe_out_->end_frame();
+	if (async_tail_)
+		async_tail_->sync();
+}
+
 void Filtrator_out::flush_der_kompressor()
 {
+	if (async_cmp_)
+		async_cmp_->sync();
 	if (cmp_pipe_out_)
 		cmp_pipe_out_->flush();
+	if (async_tail_)
+		async_tail_->sync();
 }
 
 
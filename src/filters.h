@@ -3,6 +3,9 @@
 #include "piping_zstd.h"
 #include "piping_chapoly.h"
 #include "piping_chacha.h"
+#include "piping_aead_stream.h"
+#include "piping_aes.h"
+#include "piping_async.h"
 
 namespace archi{
 
@@ -11,7 +14,11 @@ struct Filters_in{
 	std::optional<Zstd_in> cmp_in;
 	std::optional<Chapoly> enc_chapo_in;
 	std::optional<Chacha> enc_chacha_in;
-	operator bool() const { return cmp_in or enc_chapo_in or enc_chacha_in; }
+	std::optional<Aead_stream> enc_stream_in;
+	std::optional<Aes_ctr> enc_aes_ctr_in;
+	operator bool() const { return cmp_in or enc_chapo_in or enc_chacha_in or enc_stream_in or enc_aes_ctr_in; }
+	/// params of whichever encryption is set. nullptr if none
+	const Encryption_params *encryption() const;
 };
 
 class Filtrator_in
@@ -26,10 +33,20 @@ public:
 	void compression(Zstd_in &zin);
 	void encryption(Chapoly &ein);
 	void encryption(Chacha &ein);
+	void encryption(Aead_stream &ein);
+	void encryption(Aes_ctr &ein);
+
+	/// prepares filters to continue from another position in the underlying source.
+	/// compressed data has to continue from the beginning of a zstd frame.
+	/// @param pos position in the underlying source
+	/// @returns false if the filters can only read sequentially
+	bool reposition(u64 pos);
 private:
 	std::optional<Pipe_zstd_in> cmp_pipe_in_;
 	std::optional<Pipe_chapoly_in> enc_pipe_chapo_in_;
 	std::optional<Pipe_chacha_in> enc_pipe_chacha_in_;
+	std::optional<Pipe_aead_stream_in> enc_pipe_stream_in_;
+	std::optional<Pipe_aes_ctr_in> enc_pipe_aes_ctr_in_;
 };
 
 inline
@@ -41,6 +58,8 @@ struct Filters_out{
 	std::optional<Zstd_out> cmp_out;
 	std::optional<Chapoly> enc_chapo_out;
 	std::optional<Chacha>  enc_chacha_out;
+	std::optional<Aead_stream> enc_stream_out;
+	std::optional<Aes_ctr> enc_aes_ctr_out;
 };
 
 
@@ -53,17 +72,34 @@ public:
 	void compression(Zstd_out zout);
 	void encryption(Chapoly &eout);
 	void encryption(Chacha &eout);
+	void encryption(Aead_stream &eout);
+	void encryption(Aes_ctr &eout);
 	void set_filters(Filters_out &f);
 	Filters_in get_filters();
 
+	/// inserts stages, which run compression, and encryption with writing, on their own threads.
+	/// should be called before apply()
+	void enable_pipelining();
+	/// turns the threads, set by enable_pipelining(), on and off.
+	/// it's only worth it for big enough data.
+	void pipelined(bool on);
+	/// flushes compressor, and waits till everything pumped so far reaches the end of the chain
 	void flush_der_kompressor();
+	/// same as flush_der_kompressor(), but the data pumped after this can be decompressed on its own
+	void end_frame();
 private:
+	std::unique_ptr<Pipe_async_out> async_cmp_;  // in front of compression
+	std::unique_ptr<Pipe_async_out> async_tail_; // in front of encryption and the final sink
 	std::optional<Pipe_zstd_out> cmp_pipe_out_;
 	std::optional<Pipe_chapoly_out> enc_pipe_chapo_out_;
 	std::optional<Pipe_chacha_out>  enc_pipe_chacha_out_;
+	std::optional<Pipe_aead_stream_out> enc_pipe_stream_out_;
+	std::optional<Pipe_aes_ctr_out> enc_pipe_aes_ctr_out_;
 	std::optional<Zstd_out> cmp_out_;
 	std::optional<Chapoly> enc_chapo_out_;
 	std::optional<Chacha>  enc_chacha_out_;
+	std::optional<Aead_stream> enc_stream_out_;
+	std::optional<Aes_ctr> enc_aes_ctr_out_;
 };
 
 inline
@@ -19,7 +19,9 @@ namespace _pbi = _pb::internal;
 
 namespace proto {
 PROTOBUF_CONSTEXPR ZSTD_Compression_filter::ZSTD_Compression_filter(
-    ::_pbi::ConstantInitialized){}
+    ::_pbi::ConstantInitialized)
+  : window_log_(0u)
+  , dictionary_id_(0u){}
 struct ZSTD_Compression_filterDefaultTypeInternal {
   PROTOBUF_CONSTEXPR ZSTD_Compression_filterDefaultTypeInternal()
       : _instance(::_pbi::ConstantInitialized{}) {}
@@ -55,6 +57,19 @@ struct Chacha_Encryption_filterDefaultTypeInternal {
   };
 };
 PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 Chacha_Encryption_filterDefaultTypeInternal _Chacha_Encryption_filter_default_instance_;
+PROTOBUF_CONSTEXPR Aes_Encryption_filter::Aes_Encryption_filter(
+    ::_pbi::ConstantInitialized)
+  : iv_(&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{})
+  , key_(&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}){}
+struct Aes_Encryption_filterDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR Aes_Encryption_filterDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~Aes_Encryption_filterDefaultTypeInternal() {}
+  union {
+    Aes_Encryption_filter _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 Aes_Encryption_filterDefaultTypeInternal _Aes_Encryption_filter_default_instance_;
 PROTOBUF_CONSTEXPR Filters::Filters(
     ::_pbi::ConstantInitialized)
   : zstd_compression_(nullptr)
@@ -81,13 +96,45 @@ struct Ref_to_refcountDefaultTypeInternal {
   };
 };
 PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 Ref_to_refcountDefaultTypeInternal _Ref_to_refcount_default_instance_;
+PROTOBUF_CONSTEXPR Inode::Inode(
+    ::_pbi::ConstantInitialized)
+  : device_(uint64_t{0u})
+  , number_(uint64_t{0u})
+  , size_(uint64_t{0u})
+  , changed_nanoseconds_(uint64_t{0u}){}
+struct InodeDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR InodeDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~InodeDefaultTypeInternal() {}
+  union {
+    Inode _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 InodeDefaultTypeInternal _Inode_default_instance_;
+PROTOBUF_CONSTEXPR Hole::Hole(
+    ::_pbi::ConstantInitialized)
+  : offset_(uint64_t{0u})
+  , size_(uint64_t{0u}){}
+struct HoleDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR HoleDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~HoleDefaultTypeInternal() {}
+  union {
+    Hole _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 HoleDefaultTypeInternal _Hole_default_instance_;
 PROTOBUF_CONSTEXPR Fs_record::Fs_record(
     ::_pbi::ConstantInitialized)
-  : pathname_(&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{})
+  : chunks_()
+  , holes_()
+  , pathname_(&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{})
   , symlink_target_(&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{})
   , posix_acl_(&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{})
   , posix_default_acl_(&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{})
+  , hard_link_(&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{})
   , ref_(nullptr)
+  , inode_(nullptr)
   , modified_nanoseconds_(uint64_t{0u})
   , type_(0)
 
@@ -130,8 +177,11 @@ PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORIT
 PROTOBUF_CONSTEXPR Content_file::Content_file(
     ::_pbi::ConstantInitialized)
   : refs_()
+  , block_xxhash_()
   , name_(&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{})
-  , filters_(nullptr){}
+  , filters_(nullptr)
+  , size_(uint64_t{0u})
+  , block_size_(uint64_t{0u}){}
 struct Content_fileDefaultTypeInternal {
   PROTOBUF_CONSTEXPR Content_fileDefaultTypeInternal()
       : _instance(::_pbi::ConstantInitialized{}) {}
@@ -143,10 +193,13 @@ struct Content_fileDefaultTypeInternal {
 PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 Content_fileDefaultTypeInternal _Content_file_default_instance_;
 PROTOBUF_CONSTEXPR Ref_count::Ref_count(
     ::_pbi::ConstantInitialized)
-  : from_(uint64_t{0u})
+  : content_id_(&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{})
+  , from_(uint64_t{0u})
   , to_(uint64_t{0u})
   , ref_count_(uint64_t{0u})
   , space_taken_(uint64_t{0u})
+  , seek_offset_(uint64_t{0u})
+  , seek_from_(uint64_t{0u})
   , _oneof_case_{}{}
 struct Ref_countDefaultTypeInternal {
   PROTOBUF_CONSTEXPR Ref_countDefaultTypeInternal()
@@ -157,10 +210,24 @@ struct Ref_countDefaultTypeInternal {
   };
 };
 PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 Ref_countDefaultTypeInternal _Ref_count_default_instance_;
+PROTOBUF_CONSTEXPR Zstd_dictionary::Zstd_dictionary(
+    ::_pbi::ConstantInitialized)
+  : data_(&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{})
+  , id_(0u){}
+struct Zstd_dictionaryDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR Zstd_dictionaryDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~Zstd_dictionaryDefaultTypeInternal() {}
+  union {
+    Zstd_dictionary _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 Zstd_dictionaryDefaultTypeInternal _Zstd_dictionary_default_instance_;
 PROTOBUF_CONSTEXPR Catalogue::Catalogue(
     ::_pbi::ConstantInitialized)
   : state_files_()
-  , content_files_(){}
+  , content_files_()
+  , dictionaries_(){}
 struct CatalogueDefaultTypeInternal {
   PROTOBUF_CONSTEXPR CatalogueDefaultTypeInternal()
       : _instance(::_pbi::ConstantInitialized{}) {}
@@ -244,6 +311,13 @@ bool File_type_Parse(
 
 class ZSTD_Compression_filter::_Internal {
  public:
+  using HasBits = decltype(std::declval<ZSTD_Compression_filter>()._has_bits_);
+  static void set_has_window_log(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_dictionary_id(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
 };
 
 ZSTD_Compression_filter::ZSTD_Compression_filter(::PROTOBUF_NAMESPACE_ID::Arena* arena,
@@ -253,12 +327,20 @@ ZSTD_Compression_filter::ZSTD_Compression_filter(::PROTOBUF_NAMESPACE_ID::Arena*
   // @@protoc_insertion_point(arena_constructor:proto.ZSTD_Compression_filter)
 }
 ZSTD_Compression_filter::ZSTD_Compression_filter(const ZSTD_Compression_filter& from)
-  : ::PROTOBUF_NAMESPACE_ID::MessageLite() {
+  : ::PROTOBUF_NAMESPACE_ID::MessageLite(),
+      _has_bits_(from._has_bits_) {
   _internal_metadata_.MergeFrom<std::string>(from._internal_metadata_);
+  ::memcpy(&window_log_, &from.window_log_,
+    static_cast<size_t>(reinterpret_cast<char*>(&dictionary_id_) -
+    reinterpret_cast<char*>(&window_log_)) + sizeof(dictionary_id_));
   // @@protoc_insertion_point(copy_constructor:proto.ZSTD_Compression_filter)
 }
 
 inline void ZSTD_Compression_filter::SharedCtor() {
+::memset(reinterpret_cast<char*>(this) + static_cast<size_t>(
+    reinterpret_cast<char*>(&window_log_) - reinterpret_cast<char*>(this)),
+    0, static_cast<size_t>(reinterpret_cast<char*>(&dictionary_id_) -
+    reinterpret_cast<char*>(&window_log_)) + sizeof(dictionary_id_));
 }
 
 ZSTD_Compression_filter::~ZSTD_Compression_filter() {
@@ -284,14 +366,45 @@ void ZSTD_Compression_filter::Clear() {
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
+  cached_has_bits = _has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    ::memset(&window_log_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&dictionary_id_) -
+        reinterpret_cast<char*>(&window_log_)) + sizeof(dictionary_id_));
+  }
+  _has_bits_.Clear();
   _internal_metadata_.Clear<std::string>();
 }
 
 const char* ZSTD_Compression_filter::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
 #define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
   while (!ctx->Done(&ptr)) {
     uint32_t tag;
     ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // optional uint32 window_log = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _Internal::set_has_window_log(&has_bits);
+          window_log_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional uint32 dictionary_id = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _Internal::set_has_dictionary_id(&has_bits);
+          dictionary_id_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
     if ((tag == 0) || ((tag & 7) == 4)) {
       CHK_(ptr);
       ctx->SetLastTag(tag);
@@ -304,6 +417,7 @@ const char* ZSTD_Compression_filter::_InternalParse(const char* ptr, ::_pbi::Par
     CHK_(ptr != nullptr);
   }  // while
 message_done:
+  _has_bits_.Or(has_bits);
   return ptr;
 failure:
   ptr = nullptr;
@@ -317,6 +431,19 @@ uint8_t* ZSTD_Compression_filter::_InternalSerialize(
   uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
+  cached_has_bits = _has_bits_[0];
+  // optional uint32 window_log = 1;
+  if (cached_has_bits & 0x00000001u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(1, this->_internal_window_log(), target);
+  }
+
+  // optional uint32 dictionary_id = 2;
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(2, this->_internal_dictionary_id(), target);
+  }
+
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
     target = stream->WriteRaw(_internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString).data(),
         static_cast<int>(_internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString).size()), target);
@@ -333,6 +460,19 @@ size_t ZSTD_Compression_filter::ByteSizeLong() const {
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
+  cached_has_bits = _has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    // optional uint32 window_log = 1;
+    if (cached_has_bits & 0x00000001u) {
+      total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_window_log());
+    }
+
+    // optional uint32 dictionary_id = 2;
+    if (cached_has_bits & 0x00000002u) {
+      total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_dictionary_id());
+    }
+
+  }
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
     total_size += _internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString).size();
   }
@@ -353,6 +493,16 @@ void ZSTD_Compression_filter::MergeFrom(const ZSTD_Compression_filter& from) {
   uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
+  cached_has_bits = from._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    if (cached_has_bits & 0x00000001u) {
+      window_log_ = from.window_log_;
+    }
+    if (cached_has_bits & 0x00000002u) {
+      dictionary_id_ = from.dictionary_id_;
+    }
+    _has_bits_[0] |= cached_has_bits;
+  }
   _internal_metadata_.MergeFrom<std::string>(from._internal_metadata_);
 }
 
@@ -370,6 +520,13 @@ bool ZSTD_Compression_filter::IsInitialized() const {
 void ZSTD_Compression_filter::InternalSwap(ZSTD_Compression_filter* other) {
   using std::swap;
   _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_has_bits_[0], other->_has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(ZSTD_Compression_filter, dictionary_id_)
+      + sizeof(ZSTD_Compression_filter::dictionary_id_)
+      - PROTOBUF_FIELD_OFFSET(ZSTD_Compression_filter, window_log_)>(
+          reinterpret_cast<char*>(&window_log_),
+          reinterpret_cast<char*>(&other->window_log_));
 }
 
 std::string ZSTD_Compression_filter::GetTypeName() const {
@@ -913,98 +1070,62 @@ std::string Chacha_Encryption_filter::GetTypeName() const {
 
 // ===================================================================
 
-class Filters::_Internal {
+class Aes_Encryption_filter::_Internal {
  public:
-  using HasBits = decltype(std::declval<Filters>()._has_bits_);
-  static const ::proto::ZSTD_Compression_filter& zstd_compression(const Filters* msg);
-  static void set_has_zstd_compression(HasBits* has_bits) {
+  using HasBits = decltype(std::declval<Aes_Encryption_filter>()._has_bits_);
+  static void set_has_iv(HasBits* has_bits) {
     (*has_bits)[0] |= 1u;
   }
-  static const ::proto::Chapoly_Encryption_filter& chapoly_encryption(const Filters* msg);
-  static const ::proto::Chacha_Encryption_filter& chacha_encryption(const Filters* msg);
-};
-
-const ::proto::ZSTD_Compression_filter&
-Filters::_Internal::zstd_compression(const Filters* msg) {
-  return *msg->zstd_compression_;
-}
-const ::proto::Chapoly_Encryption_filter&
-Filters::_Internal::chapoly_encryption(const Filters* msg) {
-  return *msg->encryption_.chapoly_encryption_;
-}
-const ::proto::Chacha_Encryption_filter&
-Filters::_Internal::chacha_encryption(const Filters* msg) {
-  return *msg->encryption_.chacha_encryption_;
-}
-void Filters::set_allocated_chapoly_encryption(::proto::Chapoly_Encryption_filter* chapoly_encryption) {
-  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
-  clear_encryption();
-  if (chapoly_encryption) {
-    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
-      ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(chapoly_encryption);
-    if (message_arena != submessage_arena) {
-      chapoly_encryption = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
-          message_arena, chapoly_encryption, submessage_arena);
-    }
-    set_has_chapoly_encryption();
-    encryption_.chapoly_encryption_ = chapoly_encryption;
+  static void set_has_key(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
   }
-  // @@protoc_insertion_point(field_set_allocated:proto.Filters.chapoly_encryption)
-}
-void Filters::set_allocated_chacha_encryption(::proto::Chacha_Encryption_filter* chacha_encryption) {
-  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
-  clear_encryption();
-  if (chacha_encryption) {
-    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
-      ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(chacha_encryption);
-    if (message_arena != submessage_arena) {
-      chacha_encryption = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
-          message_arena, chacha_encryption, submessage_arena);
-    }
-    set_has_chacha_encryption();
-    encryption_.chacha_encryption_ = chacha_encryption;
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x00000001) ^ 0x00000001) != 0;
   }
-  // @@protoc_insertion_point(field_set_allocated:proto.Filters.chacha_encryption)
-}
-Filters::Filters(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+};
+
+Aes_Encryption_filter::Aes_Encryption_filter(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                          bool is_message_owned)
   : ::PROTOBUF_NAMESPACE_ID::MessageLite(arena, is_message_owned) {
   SharedCtor();
-  // @@protoc_insertion_point(arena_constructor:proto.Filters)
+  // @@protoc_insertion_point(arena_constructor:proto.Aes_Encryption_filter)
 }
-Filters::Filters(const Filters& from)
+Aes_Encryption_filter::Aes_Encryption_filter(const Aes_Encryption_filter& from)
   : ::PROTOBUF_NAMESPACE_ID::MessageLite(),
       _has_bits_(from._has_bits_) {
   _internal_metadata_.MergeFrom<std::string>(from._internal_metadata_);
-  if (from._internal_has_zstd_compression()) {
-    zstd_compression_ = new ::proto::ZSTD_Compression_filter(*from.zstd_compression_);
-  } else {
-    zstd_compression_ = nullptr;
+  iv_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    iv_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_iv()) {
+    iv_.Set(from._internal_iv(), 
+      GetArenaForAllocation());
   }
-  clear_has_encryption();
-  switch (from.encryption_case()) {
-    case kChapolyEncryption: {
-      _internal_mutable_chapoly_encryption()->::proto::Chapoly_Encryption_filter::MergeFrom(from._internal_chapoly_encryption());
-      break;
-    }
-    case kChachaEncryption: {
-      _internal_mutable_chacha_encryption()->::proto::Chacha_Encryption_filter::MergeFrom(from._internal_chacha_encryption());
-      break;
-    }
-    case ENCRYPTION_NOT_SET: {
-      break;
-    }
+  key_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    key_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_key()) {
+    key_.Set(from._internal_key(), 
+      GetArenaForAllocation());
   }
-  // @@protoc_insertion_point(copy_constructor:proto.Filters)
+  // @@protoc_insertion_point(copy_constructor:proto.Aes_Encryption_filter)
 }
 
-inline void Filters::SharedCtor() {
-zstd_compression_ = nullptr;
-clear_has_encryption();
+inline void Aes_Encryption_filter::SharedCtor() {
+iv_.InitDefault();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  iv_.Set("", GetArenaForAllocation());
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+key_.InitDefault();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  key_.Set("", GetArenaForAllocation());
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
 }
 
-Filters::~Filters() {
-  // @@protoc_insertion_point(destructor:proto.Filters)
+Aes_Encryption_filter::~Aes_Encryption_filter() {
+  // @@protoc_insertion_point(destructor:proto.Aes_Encryption_filter)
   if (auto *arena = _internal_metadata_.DeleteReturnArena<std::string>()) {
   (void)arena;
     return;
@@ -1012,84 +1133,56 @@ Filters::~Filters() {
   SharedDtor();
 }
 
-inline void Filters::SharedDtor() {
+inline void Aes_Encryption_filter::SharedDtor() {
   GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
-  if (this != internal_default_instance()) delete zstd_compression_;
-  if (has_encryption()) {
-    clear_encryption();
-  }
+  iv_.Destroy();
+  key_.Destroy();
 }
 
-void Filters::SetCachedSize(int size) const {
+void Aes_Encryption_filter::SetCachedSize(int size) const {
   _cached_size_.Set(size);
 }
 
-void Filters::clear_encryption() {
-// @@protoc_insertion_point(one_of_clear_start:proto.Filters)
-  switch (encryption_case()) {
-    case kChapolyEncryption: {
-      if (GetArenaForAllocation() == nullptr) {
-        delete encryption_.chapoly_encryption_;
-      }
-      break;
-    }
-    case kChachaEncryption: {
-      if (GetArenaForAllocation() == nullptr) {
-        delete encryption_.chacha_encryption_;
-      }
-      break;
-    }
-    case ENCRYPTION_NOT_SET: {
-      break;
-    }
-  }
-  _oneof_case_[0] = ENCRYPTION_NOT_SET;
-}
-
-
-void Filters::Clear() {
-// @@protoc_insertion_point(message_clear_start:proto.Filters)
+void Aes_Encryption_filter::Clear() {
+// @@protoc_insertion_point(message_clear_start:proto.Aes_Encryption_filter)
   uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
   cached_has_bits = _has_bits_[0];
-  if (cached_has_bits & 0x00000001u) {
-    GOOGLE_DCHECK(zstd_compression_ != nullptr);
-    zstd_compression_->Clear();
+  if (cached_has_bits & 0x00000003u) {
+    if (cached_has_bits & 0x00000001u) {
+      iv_.ClearNonDefaultToEmpty();
+    }
+    if (cached_has_bits & 0x00000002u) {
+      key_.ClearNonDefaultToEmpty();
+    }
   }
-  clear_encryption();
   _has_bits_.Clear();
   _internal_metadata_.Clear<std::string>();
 }
 
-const char* Filters::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+const char* Aes_Encryption_filter::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
 #define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
   _Internal::HasBits has_bits{};
   while (!ctx->Done(&ptr)) {
     uint32_t tag;
     ptr = ::_pbi::ReadTag(ptr, &tag);
     switch (tag >> 3) {
-      // optional .proto.ZSTD_Compression_filter zstd_compression = 1;
+      // required bytes iv = 1;
       case 1:
         if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
-          ptr = ctx->ParseMessage(_internal_mutable_zstd_compression(), ptr);
+          auto str = _internal_mutable_iv();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
           CHK_(ptr);
         } else
           goto handle_unusual;
         continue;
-      // .proto.Chapoly_Encryption_filter chapoly_encryption = 2;
+      // optional bytes key = 2;
       case 2:
         if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
-          ptr = ctx->ParseMessage(_internal_mutable_chapoly_encryption(), ptr);
-          CHK_(ptr);
-        } else
-          goto handle_unusual;
-        continue;
-      // .proto.Chacha_Encryption_filter chacha_encryption = 3;
-      case 3:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
-          ptr = ctx->ParseMessage(_internal_mutable_chacha_encryption(), ptr);
+          auto str = _internal_mutable_key();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
           CHK_(ptr);
         } else
           goto handle_unusual;
@@ -1118,78 +1211,55 @@ failure:
 #undef CHK_
 }
 
-uint8_t* Filters::_InternalSerialize(
+uint8_t* Aes_Encryption_filter::_InternalSerialize(
     uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
-  // @@protoc_insertion_point(serialize_to_array_start:proto.Filters)
+  // @@protoc_insertion_point(serialize_to_array_start:proto.Aes_Encryption_filter)
   uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
   cached_has_bits = _has_bits_[0];
-  // optional .proto.ZSTD_Compression_filter zstd_compression = 1;
+  // required bytes iv = 1;
   if (cached_has_bits & 0x00000001u) {
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
-      InternalWriteMessage(1, _Internal::zstd_compression(this),
-        _Internal::zstd_compression(this).GetCachedSize(), target, stream);
-  }
+    target = stream->WriteBytesMaybeAliased(
+        1, this->_internal_iv(), target);
+  }
 
-  switch (encryption_case()) {
-    case kChapolyEncryption: {
-      target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
-        InternalWriteMessage(2, _Internal::chapoly_encryption(this),
-          _Internal::chapoly_encryption(this).GetCachedSize(), target, stream);
-      break;
-    }
-    case kChachaEncryption: {
-      target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
-        InternalWriteMessage(3, _Internal::chacha_encryption(this),
-          _Internal::chacha_encryption(this).GetCachedSize(), target, stream);
-      break;
-    }
-    default: ;
+  // optional bytes key = 2;
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->WriteBytesMaybeAliased(
+        2, this->_internal_key(), target);
   }
+
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
     target = stream->WriteRaw(_internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString).data(),
         static_cast<int>(_internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString).size()), target);
   }
-  // @@protoc_insertion_point(serialize_to_array_end:proto.Filters)
+  // @@protoc_insertion_point(serialize_to_array_end:proto.Aes_Encryption_filter)
   return target;
 }
 
-size_t Filters::ByteSizeLong() const {
-// @@protoc_insertion_point(message_byte_size_start:proto.Filters)
+size_t Aes_Encryption_filter::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:proto.Aes_Encryption_filter)
   size_t total_size = 0;
 
+  // required bytes iv = 1;
+  if (_internal_has_iv()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->_internal_iv());
+  }
   uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  // optional .proto.ZSTD_Compression_filter zstd_compression = 1;
+  // optional bytes key = 2;
   cached_has_bits = _has_bits_[0];
-  if (cached_has_bits & 0x00000001u) {
+  if (cached_has_bits & 0x00000002u) {
     total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
-        *zstd_compression_);
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->_internal_key());
   }
 
-  switch (encryption_case()) {
-    // .proto.Chapoly_Encryption_filter chapoly_encryption = 2;
-    case kChapolyEncryption: {
-      total_size += 1 +
-        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
-          *encryption_.chapoly_encryption_);
-      break;
-    }
-    // .proto.Chacha_Encryption_filter chacha_encryption = 3;
-    case kChachaEncryption: {
-      total_size += 1 +
-        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
-          *encryption_.chacha_encryption_);
-      break;
-    }
-    case ENCRYPTION_NOT_SET: {
-      break;
-    }
-  }
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
     total_size += _internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString).size();
   }
@@ -1198,127 +1268,229 @@ size_t Filters::ByteSizeLong() const {
   return total_size;
 }
 
-void Filters::CheckTypeAndMergeFrom(
+void Aes_Encryption_filter::CheckTypeAndMergeFrom(
     const ::PROTOBUF_NAMESPACE_ID::MessageLite& from) {
-  MergeFrom(*::_pbi::DownCast<const Filters*>(
+  MergeFrom(*::_pbi::DownCast<const Aes_Encryption_filter*>(
       &from));
 }
 
-void Filters::MergeFrom(const Filters& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:proto.Filters)
+void Aes_Encryption_filter::MergeFrom(const Aes_Encryption_filter& from) {
+// @@protoc_insertion_point(class_specific_merge_from_start:proto.Aes_Encryption_filter)
   GOOGLE_DCHECK_NE(&from, this);
   uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  if (from._internal_has_zstd_compression()) {
-    _internal_mutable_zstd_compression()->::proto::ZSTD_Compression_filter::MergeFrom(from._internal_zstd_compression());
-  }
-  switch (from.encryption_case()) {
-    case kChapolyEncryption: {
-      _internal_mutable_chapoly_encryption()->::proto::Chapoly_Encryption_filter::MergeFrom(from._internal_chapoly_encryption());
-      break;
-    }
-    case kChachaEncryption: {
-      _internal_mutable_chacha_encryption()->::proto::Chacha_Encryption_filter::MergeFrom(from._internal_chacha_encryption());
-      break;
+  cached_has_bits = from._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    if (cached_has_bits & 0x00000001u) {
+      _internal_set_iv(from._internal_iv());
     }
-    case ENCRYPTION_NOT_SET: {
-      break;
+    if (cached_has_bits & 0x00000002u) {
+      _internal_set_key(from._internal_key());
     }
   }
   _internal_metadata_.MergeFrom<std::string>(from._internal_metadata_);
 }
 
-void Filters::CopyFrom(const Filters& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:proto.Filters)
+void Aes_Encryption_filter::CopyFrom(const Aes_Encryption_filter& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:proto.Aes_Encryption_filter)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-bool Filters::IsInitialized() const {
-  switch (encryption_case()) {
-    case kChapolyEncryption: {
-      if (_internal_has_chapoly_encryption()) {
-        if (!encryption_.chapoly_encryption_->IsInitialized()) return false;
-      }
-      break;
-    }
-    case kChachaEncryption: {
-      if (_internal_has_chacha_encryption()) {
-        if (!encryption_.chacha_encryption_->IsInitialized()) return false;
-      }
-      break;
-    }
-    case ENCRYPTION_NOT_SET: {
-      break;
-    }
-  }
+bool Aes_Encryption_filter::IsInitialized() const {
+  if (_Internal::MissingRequiredFields(_has_bits_)) return false;
   return true;
 }
 
-void Filters::InternalSwap(Filters* other) {
+void Aes_Encryption_filter::InternalSwap(Aes_Encryption_filter* other) {
   using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
   _internal_metadata_.InternalSwap(&other->_internal_metadata_);
   swap(_has_bits_[0], other->_has_bits_[0]);
-  swap(zstd_compression_, other->zstd_compression_);
-  swap(encryption_, other->encryption_);
-  swap(_oneof_case_[0], other->_oneof_case_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &iv_, lhs_arena,
+      &other->iv_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &key_, lhs_arena,
+      &other->key_, rhs_arena
+  );
 }
 
-std::string Filters::GetTypeName() const {
-  return "proto.Filters";
+std::string Aes_Encryption_filter::GetTypeName() const {
+  return "proto.Aes_Encryption_filter";
 }
 
 
 // ===================================================================
 
-class Ref_to_refcount::_Internal {
+class Filters::_Internal {
  public:
-  using HasBits = decltype(std::declval<Ref_to_refcount>()._has_bits_);
-  static void set_has_content_fname(HasBits* has_bits) {
+  using HasBits = decltype(std::declval<Filters>()._has_bits_);
+  static const ::proto::ZSTD_Compression_filter& zstd_compression(const Filters* msg);
+  static void set_has_zstd_compression(HasBits* has_bits) {
     (*has_bits)[0] |= 1u;
   }
-  static void set_has_from(HasBits* has_bits) {
-    (*has_bits)[0] |= 2u;
-  }
-  static bool MissingRequiredFields(const HasBits& has_bits) {
-    return ((has_bits[0] & 0x00000003) ^ 0x00000003) != 0;
-  }
+  static const ::proto::Chapoly_Encryption_filter& chapoly_encryption(const Filters* msg);
+  static const ::proto::Chacha_Encryption_filter& chacha_encryption(const Filters* msg);
+  static const ::proto::Chapoly_Encryption_filter& chapoly_stream_encryption(const Filters* msg);
+  static const ::proto::Aes_Encryption_filter& aes_gcm_stream_encryption(const Filters* msg);
+  static const ::proto::Aes_Encryption_filter& aes_ctr_encryption(const Filters* msg);
 };
 
-Ref_to_refcount::Ref_to_refcount(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+const ::proto::ZSTD_Compression_filter&
+Filters::_Internal::zstd_compression(const Filters* msg) {
+  return *msg->zstd_compression_;
+}
+const ::proto::Chapoly_Encryption_filter&
+Filters::_Internal::chapoly_encryption(const Filters* msg) {
+  return *msg->encryption_.chapoly_encryption_;
+}
+const ::proto::Chacha_Encryption_filter&
+Filters::_Internal::chacha_encryption(const Filters* msg) {
+  return *msg->encryption_.chacha_encryption_;
+}
+const ::proto::Chapoly_Encryption_filter&
+Filters::_Internal::chapoly_stream_encryption(const Filters* msg) {
+  return *msg->encryption_.chapoly_stream_encryption_;
+}
+const ::proto::Aes_Encryption_filter&
+Filters::_Internal::aes_gcm_stream_encryption(const Filters* msg) {
+  return *msg->encryption_.aes_gcm_stream_encryption_;
+}
+const ::proto::Aes_Encryption_filter&
+Filters::_Internal::aes_ctr_encryption(const Filters* msg) {
+  return *msg->encryption_.aes_ctr_encryption_;
+}
+void Filters::set_allocated_chapoly_encryption(::proto::Chapoly_Encryption_filter* chapoly_encryption) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  clear_encryption();
+  if (chapoly_encryption) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(chapoly_encryption);
+    if (message_arena != submessage_arena) {
+      chapoly_encryption = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, chapoly_encryption, submessage_arena);
+    }
+    set_has_chapoly_encryption();
+    encryption_.chapoly_encryption_ = chapoly_encryption;
+  }
+  // @@protoc_insertion_point(field_set_allocated:proto.Filters.chapoly_encryption)
+}
+void Filters::set_allocated_chacha_encryption(::proto::Chacha_Encryption_filter* chacha_encryption) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  clear_encryption();
+  if (chacha_encryption) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(chacha_encryption);
+    if (message_arena != submessage_arena) {
+      chacha_encryption = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, chacha_encryption, submessage_arena);
+    }
+    set_has_chacha_encryption();
+    encryption_.chacha_encryption_ = chacha_encryption;
+  }
+  // @@protoc_insertion_point(field_set_allocated:proto.Filters.chacha_encryption)
+}
+void Filters::set_allocated_chapoly_stream_encryption(::proto::Chapoly_Encryption_filter* chapoly_stream_encryption) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  clear_encryption();
+  if (chapoly_stream_encryption) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(chapoly_stream_encryption);
+    if (message_arena != submessage_arena) {
+      chapoly_stream_encryption = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, chapoly_stream_encryption, submessage_arena);
+    }
+    set_has_chapoly_stream_encryption();
+    encryption_.chapoly_stream_encryption_ = chapoly_stream_encryption;
+  }
+  // @@protoc_insertion_point(field_set_allocated:proto.Filters.chapoly_stream_encryption)
+}
+void Filters::set_allocated_aes_gcm_stream_encryption(::proto::Aes_Encryption_filter* aes_gcm_stream_encryption) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  clear_encryption();
+  if (aes_gcm_stream_encryption) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(aes_gcm_stream_encryption);
+    if (message_arena != submessage_arena) {
+      aes_gcm_stream_encryption = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, aes_gcm_stream_encryption, submessage_arena);
+    }
+    set_has_aes_gcm_stream_encryption();
+    encryption_.aes_gcm_stream_encryption_ = aes_gcm_stream_encryption;
+  }
+  // @@protoc_insertion_point(field_set_allocated:proto.Filters.aes_gcm_stream_encryption)
+}
+void Filters::set_allocated_aes_ctr_encryption(::proto::Aes_Encryption_filter* aes_ctr_encryption) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  clear_encryption();
+  if (aes_ctr_encryption) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(aes_ctr_encryption);
+    if (message_arena != submessage_arena) {
+      aes_ctr_encryption = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, aes_ctr_encryption, submessage_arena);
+    }
+    set_has_aes_ctr_encryption();
+    encryption_.aes_ctr_encryption_ = aes_ctr_encryption;
+  }
+  // @@protoc_insertion_point(field_set_allocated:proto.Filters.aes_ctr_encryption)
+}
+Filters::Filters(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                          bool is_message_owned)
   : ::PROTOBUF_NAMESPACE_ID::MessageLite(arena, is_message_owned) {
   SharedCtor();
-  // @@protoc_insertion_point(arena_constructor:proto.Ref_to_refcount)
+  // @@protoc_insertion_point(arena_constructor:proto.Filters)
 }
-Ref_to_refcount::Ref_to_refcount(const Ref_to_refcount& from)
+Filters::Filters(const Filters& from)
   : ::PROTOBUF_NAMESPACE_ID::MessageLite(),
       _has_bits_(from._has_bits_) {
   _internal_metadata_.MergeFrom<std::string>(from._internal_metadata_);
-  content_fname_.InitDefault();
-  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-    content_fname_.Set("", GetArenaForAllocation());
-  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (from._internal_has_content_fname()) {
-    content_fname_.Set(from._internal_content_fname(), 
-      GetArenaForAllocation());
+  if (from._internal_has_zstd_compression()) {
+    zstd_compression_ = new ::proto::ZSTD_Compression_filter(*from.zstd_compression_);
+  } else {
+    zstd_compression_ = nullptr;
   }
-  from_ = from.from_;
-  // @@protoc_insertion_point(copy_constructor:proto.Ref_to_refcount)
+  clear_has_encryption();
+  switch (from.encryption_case()) {
+    case kChapolyEncryption: {
+      _internal_mutable_chapoly_encryption()->::proto::Chapoly_Encryption_filter::MergeFrom(from._internal_chapoly_encryption());
+      break;
+    }
+    case kChachaEncryption: {
+      _internal_mutable_chacha_encryption()->::proto::Chacha_Encryption_filter::MergeFrom(from._internal_chacha_encryption());
+      break;
+    }
+    case kChapolyStreamEncryption: {
+      _internal_mutable_chapoly_stream_encryption()->::proto::Chapoly_Encryption_filter::MergeFrom(from._internal_chapoly_stream_encryption());
+      break;
+    }
+    case kAesGcmStreamEncryption: {
+      _internal_mutable_aes_gcm_stream_encryption()->::proto::Aes_Encryption_filter::MergeFrom(from._internal_aes_gcm_stream_encryption());
+      break;
+    }
+    case kAesCtrEncryption: {
+      _internal_mutable_aes_ctr_encryption()->::proto::Aes_Encryption_filter::MergeFrom(from._internal_aes_ctr_encryption());
+      break;
+    }
+    case ENCRYPTION_NOT_SET: {
+      break;
+    }
+  }
+  // @@protoc_insertion_point(copy_constructor:proto.Filters)
 }
 
-inline void Ref_to_refcount::SharedCtor() {
-content_fname_.InitDefault();
-#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  content_fname_.Set("", GetArenaForAllocation());
-#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-from_ = uint64_t{0u};
+inline void Filters::SharedCtor() {
+zstd_compression_ = nullptr;
+clear_has_encryption();
 }
 
-Ref_to_refcount::~Ref_to_refcount() {
-  // @@protoc_insertion_point(destructor:proto.Ref_to_refcount)
+Filters::~Filters() {
+  // @@protoc_insertion_point(destructor:proto.Filters)
   if (auto *arena = _internal_metadata_.DeleteReturnArena<std::string>()) {
   (void)arena;
     return;
@@ -1326,51 +1498,126 @@ Ref_to_refcount::~Ref_to_refcount() {
   SharedDtor();
 }
 
-inline void Ref_to_refcount::SharedDtor() {
+inline void Filters::SharedDtor() {
   GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
-  content_fname_.Destroy();
+  if (this != internal_default_instance()) delete zstd_compression_;
+  if (has_encryption()) {
+    clear_encryption();
+  }
 }
 
-void Ref_to_refcount::SetCachedSize(int size) const {
+void Filters::SetCachedSize(int size) const {
   _cached_size_.Set(size);
 }
 
-void Ref_to_refcount::Clear() {
-// @@protoc_insertion_point(message_clear_start:proto.Ref_to_refcount)
+void Filters::clear_encryption() {
+// @@protoc_insertion_point(one_of_clear_start:proto.Filters)
+  switch (encryption_case()) {
+    case kChapolyEncryption: {
+      if (GetArenaForAllocation() == nullptr) {
+        delete encryption_.chapoly_encryption_;
+      }
+      break;
+    }
+    case kChachaEncryption: {
+      if (GetArenaForAllocation() == nullptr) {
+        delete encryption_.chacha_encryption_;
+      }
+      break;
+    }
+    case kChapolyStreamEncryption: {
+      if (GetArenaForAllocation() == nullptr) {
+        delete encryption_.chapoly_stream_encryption_;
+      }
+      break;
+    }
+    case kAesGcmStreamEncryption: {
+      if (GetArenaForAllocation() == nullptr) {
+        delete encryption_.aes_gcm_stream_encryption_;
+      }
+      break;
+    }
+    case kAesCtrEncryption: {
+      if (GetArenaForAllocation() == nullptr) {
+        delete encryption_.aes_ctr_encryption_;
+      }
+      break;
+    }
+    case ENCRYPTION_NOT_SET: {
+      break;
+    }
+  }
+  _oneof_case_[0] = ENCRYPTION_NOT_SET;
+}
+
+
+void Filters::Clear() {
+// @@protoc_insertion_point(message_clear_start:proto.Filters)
   uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
   cached_has_bits = _has_bits_[0];
   if (cached_has_bits & 0x00000001u) {
-    content_fname_.ClearNonDefaultToEmpty();
+    GOOGLE_DCHECK(zstd_compression_ != nullptr);
+    zstd_compression_->Clear();
   }
-  from_ = uint64_t{0u};
+  clear_encryption();
   _has_bits_.Clear();
   _internal_metadata_.Clear<std::string>();
 }
 
-const char* Ref_to_refcount::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+const char* Filters::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
 #define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
   _Internal::HasBits has_bits{};
   while (!ctx->Done(&ptr)) {
     uint32_t tag;
     ptr = ::_pbi::ReadTag(ptr, &tag);
     switch (tag >> 3) {
-      // required string content_fname = 1;
+      // optional .proto.ZSTD_Compression_filter zstd_compression = 1;
       case 1:
         if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
-          auto str = _internal_mutable_content_fname();
-          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          ptr = ctx->ParseMessage(_internal_mutable_zstd_compression(), ptr);
           CHK_(ptr);
         } else
           goto handle_unusual;
         continue;
-      // required uint64 from = 2;
+      // .proto.Chapoly_Encryption_filter chapoly_encryption = 2;
       case 2:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
-          _Internal::set_has_from(&has_bits);
-          from_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          ptr = ctx->ParseMessage(_internal_mutable_chapoly_encryption(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .proto.Chacha_Encryption_filter chacha_encryption = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          ptr = ctx->ParseMessage(_internal_mutable_chacha_encryption(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .proto.Chapoly_Encryption_filter chapoly_stream_encryption = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 34)) {
+          ptr = ctx->ParseMessage(_internal_mutable_chapoly_stream_encryption(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .proto.Aes_Encryption_filter aes_gcm_stream_encryption = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 42)) {
+          ptr = ctx->ParseMessage(_internal_mutable_aes_gcm_stream_encryption(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .proto.Aes_Encryption_filter aes_ctr_encryption = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 50)) {
+          ptr = ctx->ParseMessage(_internal_mutable_aes_ctr_encryption(), ptr);
           CHK_(ptr);
         } else
           goto handle_unusual;
@@ -1399,71 +1646,117 @@ failure:
 #undef CHK_
 }
 
-uint8_t* Ref_to_refcount::_InternalSerialize(
+uint8_t* Filters::_InternalSerialize(
     uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
-  // @@protoc_insertion_point(serialize_to_array_start:proto.Ref_to_refcount)
+  // @@protoc_insertion_point(serialize_to_array_start:proto.Filters)
   uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
   cached_has_bits = _has_bits_[0];
-  // required string content_fname = 1;
+  // optional .proto.ZSTD_Compression_filter zstd_compression = 1;
   if (cached_has_bits & 0x00000001u) {
-    target = stream->WriteStringMaybeAliased(
-        1, this->_internal_content_fname(), target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(1, _Internal::zstd_compression(this),
+        _Internal::zstd_compression(this).GetCachedSize(), target, stream);
   }
 
-  // required uint64 from = 2;
-  if (cached_has_bits & 0x00000002u) {
-    target = stream->EnsureSpace(target);
-    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(2, this->_internal_from(), target);
+  switch (encryption_case()) {
+    case kChapolyEncryption: {
+      target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(2, _Internal::chapoly_encryption(this),
+          _Internal::chapoly_encryption(this).GetCachedSize(), target, stream);
+      break;
+    }
+    case kChachaEncryption: {
+      target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(3, _Internal::chacha_encryption(this),
+          _Internal::chacha_encryption(this).GetCachedSize(), target, stream);
+      break;
+    }
+    case kChapolyStreamEncryption: {
+      target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(4, _Internal::chapoly_stream_encryption(this),
+          _Internal::chapoly_stream_encryption(this).GetCachedSize(), target, stream);
+      break;
+    }
+    case kAesGcmStreamEncryption: {
+      target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(5, _Internal::aes_gcm_stream_encryption(this),
+          _Internal::aes_gcm_stream_encryption(this).GetCachedSize(), target, stream);
+      break;
+    }
+    case kAesCtrEncryption: {
+      target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(6, _Internal::aes_ctr_encryption(this),
+          _Internal::aes_ctr_encryption(this).GetCachedSize(), target, stream);
+      break;
+    }
+    default: ;
   }
-
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
     target = stream->WriteRaw(_internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString).data(),
         static_cast<int>(_internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString).size()), target);
   }
-  // @@protoc_insertion_point(serialize_to_array_end:proto.Ref_to_refcount)
+  // @@protoc_insertion_point(serialize_to_array_end:proto.Filters)
   return target;
 }
 
-size_t Ref_to_refcount::RequiredFieldsByteSizeFallback() const {
-// @@protoc_insertion_point(required_fields_byte_size_fallback_start:proto.Ref_to_refcount)
-  size_t total_size = 0;
-
-  if (_internal_has_content_fname()) {
-    // required string content_fname = 1;
-    total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
-        this->_internal_content_fname());
-  }
-
-  if (_internal_has_from()) {
-    // required uint64 from = 2;
-    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_from());
-  }
-
-  return total_size;
-}
-size_t Ref_to_refcount::ByteSizeLong() const {
-// @@protoc_insertion_point(message_byte_size_start:proto.Ref_to_refcount)
+size_t Filters::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:proto.Filters)
   size_t total_size = 0;
 
-  if (((_has_bits_[0] & 0x00000003) ^ 0x00000003) == 0) {  // All required fields are present.
-    // required string content_fname = 1;
-    total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
-        this->_internal_content_fname());
-
-    // required uint64 from = 2;
-    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_from());
-
-  } else {
-    total_size += RequiredFieldsByteSizeFallback();
-  }
   uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
+  // optional .proto.ZSTD_Compression_filter zstd_compression = 1;
+  cached_has_bits = _has_bits_[0];
+  if (cached_has_bits & 0x00000001u) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *zstd_compression_);
+  }
+
+  switch (encryption_case()) {
+    // .proto.Chapoly_Encryption_filter chapoly_encryption = 2;
+    case kChapolyEncryption: {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *encryption_.chapoly_encryption_);
+      break;
+    }
+    // .proto.Chacha_Encryption_filter chacha_encryption = 3;
+    case kChachaEncryption: {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *encryption_.chacha_encryption_);
+      break;
+    }
+    // .proto.Chapoly_Encryption_filter chapoly_stream_encryption = 4;
+    case kChapolyStreamEncryption: {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *encryption_.chapoly_stream_encryption_);
+      break;
+    }
+    // .proto.Aes_Encryption_filter aes_gcm_stream_encryption = 5;
+    case kAesGcmStreamEncryption: {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *encryption_.aes_gcm_stream_encryption_);
+      break;
+    }
+    // .proto.Aes_Encryption_filter aes_ctr_encryption = 6;
+    case kAesCtrEncryption: {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *encryption_.aes_ctr_encryption_);
+      break;
+    }
+    case ENCRYPTION_NOT_SET: {
+      break;
+    }
+  }
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
     total_size += _internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString).size();
   }
@@ -1472,178 +1765,157 @@ size_t Ref_to_refcount::ByteSizeLong() const {
   return total_size;
 }
 
-void Ref_to_refcount::CheckTypeAndMergeFrom(
+void Filters::CheckTypeAndMergeFrom(
     const ::PROTOBUF_NAMESPACE_ID::MessageLite& from) {
-  MergeFrom(*::_pbi::DownCast<const Ref_to_refcount*>(
+  MergeFrom(*::_pbi::DownCast<const Filters*>(
       &from));
 }
 
-void Ref_to_refcount::MergeFrom(const Ref_to_refcount& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:proto.Ref_to_refcount)
+void Filters::MergeFrom(const Filters& from) {
+// @@protoc_insertion_point(class_specific_merge_from_start:proto.Filters)
   GOOGLE_DCHECK_NE(&from, this);
   uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  cached_has_bits = from._has_bits_[0];
-  if (cached_has_bits & 0x00000003u) {
-    if (cached_has_bits & 0x00000001u) {
-      _internal_set_content_fname(from._internal_content_fname());
+  if (from._internal_has_zstd_compression()) {
+    _internal_mutable_zstd_compression()->::proto::ZSTD_Compression_filter::MergeFrom(from._internal_zstd_compression());
+  }
+  switch (from.encryption_case()) {
+    case kChapolyEncryption: {
+      _internal_mutable_chapoly_encryption()->::proto::Chapoly_Encryption_filter::MergeFrom(from._internal_chapoly_encryption());
+      break;
     }
-    if (cached_has_bits & 0x00000002u) {
-      from_ = from.from_;
+    case kChachaEncryption: {
+      _internal_mutable_chacha_encryption()->::proto::Chacha_Encryption_filter::MergeFrom(from._internal_chacha_encryption());
+      break;
+    }
+    case kChapolyStreamEncryption: {
+      _internal_mutable_chapoly_stream_encryption()->::proto::Chapoly_Encryption_filter::MergeFrom(from._internal_chapoly_stream_encryption());
+      break;
+    }
+    case kAesGcmStreamEncryption: {
+      _internal_mutable_aes_gcm_stream_encryption()->::proto::Aes_Encryption_filter::MergeFrom(from._internal_aes_gcm_stream_encryption());
+      break;
+    }
+    case kAesCtrEncryption: {
+      _internal_mutable_aes_ctr_encryption()->::proto::Aes_Encryption_filter::MergeFrom(from._internal_aes_ctr_encryption());
+      break;
+    }
+    case ENCRYPTION_NOT_SET: {
+      break;
     }
-    _has_bits_[0] |= cached_has_bits;
   }
   _internal_metadata_.MergeFrom<std::string>(from._internal_metadata_);
 }
 
-void Ref_to_refcount::CopyFrom(const Ref_to_refcount& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:proto.Ref_to_refcount)
+void Filters::CopyFrom(const Filters& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:proto.Filters)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-bool Ref_to_refcount::IsInitialized() const {
-  if (_Internal::MissingRequiredFields(_has_bits_)) return false;
-  return true;
-}
-
-void Ref_to_refcount::InternalSwap(Ref_to_refcount* other) {
-  using std::swap;
-  auto* lhs_arena = GetArenaForAllocation();
-  auto* rhs_arena = other->GetArenaForAllocation();
-  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
-  swap(_has_bits_[0], other->_has_bits_[0]);
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
-      &content_fname_, lhs_arena,
-      &other->content_fname_, rhs_arena
-  );
-  swap(from_, other->from_);
+bool Filters::IsInitialized() const {
+  switch (encryption_case()) {
+    case kChapolyEncryption: {
+      if (_internal_has_chapoly_encryption()) {
+        if (!encryption_.chapoly_encryption_->IsInitialized()) return false;
+      }
+      break;
+    }
+    case kChachaEncryption: {
+      if (_internal_has_chacha_encryption()) {
+        if (!encryption_.chacha_encryption_->IsInitialized()) return false;
+      }
+      break;
+    }
+    case kChapolyStreamEncryption: {
+      if (_internal_has_chapoly_stream_encryption()) {
+        if (!encryption_.chapoly_stream_encryption_->IsInitialized()) return false;
+      }
+      break;
+    }
+    case kAesGcmStreamEncryption: {
+      if (_internal_has_aes_gcm_stream_encryption()) {
+        if (!encryption_.aes_gcm_stream_encryption_->IsInitialized()) return false;
+      }
+      break;
+    }
+    case kAesCtrEncryption: {
+      if (_internal_has_aes_ctr_encryption()) {
+        if (!encryption_.aes_ctr_encryption_->IsInitialized()) return false;
+      }
+      break;
+    }
+    case ENCRYPTION_NOT_SET: {
+      break;
+    }
+  }
+  return true;
 }
 
-std::string Ref_to_refcount::GetTypeName() const {
-  return "proto.Ref_to_refcount";
+void Filters::InternalSwap(Filters* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_has_bits_[0], other->_has_bits_[0]);
+  swap(zstd_compression_, other->zstd_compression_);
+  swap(encryption_, other->encryption_);
+  swap(_oneof_case_[0], other->_oneof_case_[0]);
+}
+
+std::string Filters::GetTypeName() const {
+  return "proto.Filters";
 }
 
 
 // ===================================================================
 
-class Fs_record::_Internal {
+class Ref_to_refcount::_Internal {
  public:
-  using HasBits = decltype(std::declval<Fs_record>()._has_bits_);
-  static void set_has_pathname(HasBits* has_bits) {
+  using HasBits = decltype(std::declval<Ref_to_refcount>()._has_bits_);
+  static void set_has_content_fname(HasBits* has_bits) {
     (*has_bits)[0] |= 1u;
   }
-  static void set_has_type(HasBits* has_bits) {
-    (*has_bits)[0] |= 64u;
-  }
-  static void set_has_modified_nanoseconds(HasBits* has_bits) {
-    (*has_bits)[0] |= 32u;
-  }
-  static const ::proto::Ref_to_refcount& ref(const Fs_record* msg);
-  static void set_has_ref(HasBits* has_bits) {
-    (*has_bits)[0] |= 16u;
-  }
-  static void set_has_symlink_target(HasBits* has_bits) {
+  static void set_has_from(HasBits* has_bits) {
     (*has_bits)[0] |= 2u;
   }
-  static void set_has_unix_permissions(HasBits* has_bits) {
-    (*has_bits)[0] |= 128u;
-  }
-  static void set_has_posix_acl(HasBits* has_bits) {
-    (*has_bits)[0] |= 4u;
-  }
-  static void set_has_posix_default_acl(HasBits* has_bits) {
-    (*has_bits)[0] |= 8u;
-  }
   static bool MissingRequiredFields(const HasBits& has_bits) {
-    return ((has_bits[0] & 0x00000041) ^ 0x00000041) != 0;
+    return ((has_bits[0] & 0x00000003) ^ 0x00000003) != 0;
   }
 };
 
-const ::proto::Ref_to_refcount&
-Fs_record::_Internal::ref(const Fs_record* msg) {
-  return *msg->ref_;
-}
-Fs_record::Fs_record(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+Ref_to_refcount::Ref_to_refcount(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                          bool is_message_owned)
   : ::PROTOBUF_NAMESPACE_ID::MessageLite(arena, is_message_owned) {
   SharedCtor();
-  // @@protoc_insertion_point(arena_constructor:proto.Fs_record)
+  // @@protoc_insertion_point(arena_constructor:proto.Ref_to_refcount)
 }
-Fs_record::Fs_record(const Fs_record& from)
+Ref_to_refcount::Ref_to_refcount(const Ref_to_refcount& from)
   : ::PROTOBUF_NAMESPACE_ID::MessageLite(),
       _has_bits_(from._has_bits_) {
   _internal_metadata_.MergeFrom<std::string>(from._internal_metadata_);
-  pathname_.InitDefault();
-  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-    pathname_.Set("", GetArenaForAllocation());
-  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (from._internal_has_pathname()) {
-    pathname_.Set(from._internal_pathname(), 
-      GetArenaForAllocation());
-  }
-  symlink_target_.InitDefault();
-  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-    symlink_target_.Set("", GetArenaForAllocation());
-  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (from._internal_has_symlink_target()) {
-    symlink_target_.Set(from._internal_symlink_target(), 
-      GetArenaForAllocation());
-  }
-  posix_acl_.InitDefault();
-  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-    posix_acl_.Set("", GetArenaForAllocation());
-  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (from._internal_has_posix_acl()) {
-    posix_acl_.Set(from._internal_posix_acl(), 
-      GetArenaForAllocation());
-  }
-  posix_default_acl_.InitDefault();
+  content_fname_.InitDefault();
   #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-    posix_default_acl_.Set("", GetArenaForAllocation());
+    content_fname_.Set("", GetArenaForAllocation());
   #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (from._internal_has_posix_default_acl()) {
-    posix_default_acl_.Set(from._internal_posix_default_acl(), 
+  if (from._internal_has_content_fname()) {
+    content_fname_.Set(from._internal_content_fname(), 
       GetArenaForAllocation());
   }
-  if (from._internal_has_ref()) {
-    ref_ = new ::proto::Ref_to_refcount(*from.ref_);
-  } else {
-    ref_ = nullptr;
-  }
-  ::memcpy(&modified_nanoseconds_, &from.modified_nanoseconds_,
-    static_cast<size_t>(reinterpret_cast<char*>(&unix_permissions_) -
-    reinterpret_cast<char*>(&modified_nanoseconds_)) + sizeof(unix_permissions_));
-  // @@protoc_insertion_point(copy_constructor:proto.Fs_record)
+  from_ = from.from_;
+  // @@protoc_insertion_point(copy_constructor:proto.Ref_to_refcount)
 }
 
-inline void Fs_record::SharedCtor() {
-pathname_.InitDefault();
-#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  pathname_.Set("", GetArenaForAllocation());
-#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-symlink_target_.InitDefault();
-#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  symlink_target_.Set("", GetArenaForAllocation());
-#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-posix_acl_.InitDefault();
-#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  posix_acl_.Set("", GetArenaForAllocation());
-#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-posix_default_acl_.InitDefault();
+inline void Ref_to_refcount::SharedCtor() {
+content_fname_.InitDefault();
 #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  posix_default_acl_.Set("", GetArenaForAllocation());
+  content_fname_.Set("", GetArenaForAllocation());
 #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-::memset(reinterpret_cast<char*>(this) + static_cast<size_t>(
-    reinterpret_cast<char*>(&ref_) - reinterpret_cast<char*>(this)),
-    0, static_cast<size_t>(reinterpret_cast<char*>(&unix_permissions_) -
-    reinterpret_cast<char*>(&ref_)) + sizeof(unix_permissions_));
+from_ = uint64_t{0u};
 }
 
-Fs_record::~Fs_record() {
-  // @@protoc_insertion_point(destructor:proto.Fs_record)
+Ref_to_refcount::~Ref_to_refcount() {
+  // @@protoc_insertion_point(destructor:proto.Ref_to_refcount)
   if (auto *arena = _internal_metadata_.DeleteReturnArena<std::string>()) {
   (void)arena;
     return;
@@ -1651,131 +1923,51 @@ Fs_record::~Fs_record() {
   SharedDtor();
 }
 
-inline void Fs_record::SharedDtor() {
+inline void Ref_to_refcount::SharedDtor() {
   GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
-  pathname_.Destroy();
-  symlink_target_.Destroy();
-  posix_acl_.Destroy();
-  posix_default_acl_.Destroy();
-  if (this != internal_default_instance()) delete ref_;
+  content_fname_.Destroy();
 }
 
-void Fs_record::SetCachedSize(int size) const {
+void Ref_to_refcount::SetCachedSize(int size) const {
   _cached_size_.Set(size);
 }
 
-void Fs_record::Clear() {
-// @@protoc_insertion_point(message_clear_start:proto.Fs_record)
+void Ref_to_refcount::Clear() {
+// @@protoc_insertion_point(message_clear_start:proto.Ref_to_refcount)
   uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
   cached_has_bits = _has_bits_[0];
-  if (cached_has_bits & 0x0000001fu) {
-    if (cached_has_bits & 0x00000001u) {
-      pathname_.ClearNonDefaultToEmpty();
-    }
-    if (cached_has_bits & 0x00000002u) {
-      symlink_target_.ClearNonDefaultToEmpty();
-    }
-    if (cached_has_bits & 0x00000004u) {
-      posix_acl_.ClearNonDefaultToEmpty();
-    }
-    if (cached_has_bits & 0x00000008u) {
-      posix_default_acl_.ClearNonDefaultToEmpty();
-    }
-    if (cached_has_bits & 0x00000010u) {
-      GOOGLE_DCHECK(ref_ != nullptr);
-      ref_->Clear();
-    }
-  }
-  if (cached_has_bits & 0x000000e0u) {
-    ::memset(&modified_nanoseconds_, 0, static_cast<size_t>(
-        reinterpret_cast<char*>(&unix_permissions_) -
-        reinterpret_cast<char*>(&modified_nanoseconds_)) + sizeof(unix_permissions_));
+  if (cached_has_bits & 0x00000001u) {
+    content_fname_.ClearNonDefaultToEmpty();
   }
+  from_ = uint64_t{0u};
   _has_bits_.Clear();
   _internal_metadata_.Clear<std::string>();
 }
 
-const char* Fs_record::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+const char* Ref_to_refcount::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
 #define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
   _Internal::HasBits has_bits{};
   while (!ctx->Done(&ptr)) {
     uint32_t tag;
     ptr = ::_pbi::ReadTag(ptr, &tag);
     switch (tag >> 3) {
-      // required string pathname = 1;
+      // required string content_fname = 1;
       case 1:
         if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
-          auto str = _internal_mutable_pathname();
+          auto str = _internal_mutable_content_fname();
           ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
           CHK_(ptr);
         } else
           goto handle_unusual;
         continue;
-      // required .proto.File_type type = 2;
+      // required uint64 from = 2;
       case 2:
         if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
-          uint64_t val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
-          CHK_(ptr);
-          if (PROTOBUF_PREDICT_TRUE(::proto::File_type_IsValid(val))) {
-            _internal_set_type(static_cast<::proto::File_type>(val));
-          } else {
-            ::PROTOBUF_NAMESPACE_ID::internal::WriteVarint(2, val, mutable_unknown_fields());
-          }
-        } else
-          goto handle_unusual;
-        continue;
-      // optional uint64 modified_nanoseconds = 3;
-      case 3:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
-          _Internal::set_has_modified_nanoseconds(&has_bits);
-          modified_nanoseconds_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
-          CHK_(ptr);
-        } else
-          goto handle_unusual;
-        continue;
-      // optional .proto.Ref_to_refcount ref = 4;
-      case 4:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 34)) {
-          ptr = ctx->ParseMessage(_internal_mutable_ref(), ptr);
-          CHK_(ptr);
-        } else
-          goto handle_unusual;
-        continue;
-      // optional string symlink_target = 5;
-      case 5:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 42)) {
-          auto str = _internal_mutable_symlink_target();
-          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
-          CHK_(ptr);
-        } else
-          goto handle_unusual;
-        continue;
-      // optional uint32 unix_permissions = 6;
-      case 6:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 48)) {
-          _Internal::set_has_unix_permissions(&has_bits);
-          unix_permissions_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
-          CHK_(ptr);
-        } else
-          goto handle_unusual;
-        continue;
-      // optional string posix_acl = 7;
-      case 7:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 58)) {
-          auto str = _internal_mutable_posix_acl();
-          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
-          CHK_(ptr);
-        } else
-          goto handle_unusual;
-        continue;
-      // optional string posix_default_acl = 8;
-      case 8:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 66)) {
-          auto str = _internal_mutable_posix_default_acl();
-          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          _Internal::set_has_from(&has_bits);
+          from_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
           CHK_(ptr);
         } else
           goto handle_unusual;
@@ -1804,7 +1996,1045 @@ failure:
 #undef CHK_
 }
 
-uint8_t* Fs_record::_InternalSerialize(
+uint8_t* Ref_to_refcount::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:proto.Ref_to_refcount)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _has_bits_[0];
+  // required string content_fname = 1;
+  if (cached_has_bits & 0x00000001u) {
+    target = stream->WriteStringMaybeAliased(
+        1, this->_internal_content_fname(), target);
+  }
+
+  // required uint64 from = 2;
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(2, this->_internal_from(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = stream->WriteRaw(_internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString).data(),
+        static_cast<int>(_internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString).size()), target);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:proto.Ref_to_refcount)
+  return target;
+}
+
+size_t Ref_to_refcount::RequiredFieldsByteSizeFallback() const {
+// @@protoc_insertion_point(required_fields_byte_size_fallback_start:proto.Ref_to_refcount)
+  size_t total_size = 0;
+
+  if (_internal_has_content_fname()) {
+    // required string content_fname = 1;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_content_fname());
+  }
+
+  if (_internal_has_from()) {
+    // required uint64 from = 2;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_from());
+  }
+
+  return total_size;
+}
+size_t Ref_to_refcount::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:proto.Ref_to_refcount)
+  size_t total_size = 0;
+
+  if (((_has_bits_[0] & 0x00000003) ^ 0x00000003) == 0) {  // All required fields are present.
+    // required string content_fname = 1;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_content_fname());
+
+    // required uint64 from = 2;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_from());
+
+  } else {
+    total_size += RequiredFieldsByteSizeFallback();
+  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    total_size += _internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString).size();
+  }
+  int cached_size = ::_pbi::ToCachedSize(total_size);
+  SetCachedSize(cached_size);
+  return total_size;
+}
+
+void Ref_to_refcount::CheckTypeAndMergeFrom(
+    const ::PROTOBUF_NAMESPACE_ID::MessageLite& from) {
+  MergeFrom(*::_pbi::DownCast<const Ref_to_refcount*>(
+      &from));
+}
+
+void Ref_to_refcount::MergeFrom(const Ref_to_refcount& from) {
+// @@protoc_insertion_point(class_specific_merge_from_start:proto.Ref_to_refcount)
+  GOOGLE_DCHECK_NE(&from, this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    if (cached_has_bits & 0x00000001u) {
+      _internal_set_content_fname(from._internal_content_fname());
+    }
+    if (cached_has_bits & 0x00000002u) {
+      from_ = from.from_;
+    }
+    _has_bits_[0] |= cached_has_bits;
+  }
+  _internal_metadata_.MergeFrom<std::string>(from._internal_metadata_);
+}
+
+void Ref_to_refcount::CopyFrom(const Ref_to_refcount& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:proto.Ref_to_refcount)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool Ref_to_refcount::IsInitialized() const {
+  if (_Internal::MissingRequiredFields(_has_bits_)) return false;
+  return true;
+}
+
+void Ref_to_refcount::InternalSwap(Ref_to_refcount* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_has_bits_[0], other->_has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &content_fname_, lhs_arena,
+      &other->content_fname_, rhs_arena
+  );
+  swap(from_, other->from_);
+}
+
+std::string Ref_to_refcount::GetTypeName() const {
+  return "proto.Ref_to_refcount";
+}
+
+
+// ===================================================================
+
+class Inode::_Internal {
+ public:
+  using HasBits = decltype(std::declval<Inode>()._has_bits_);
+  static void set_has_device(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_number(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static void set_has_size(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+  static void set_has_changed_nanoseconds(HasBits* has_bits) {
+    (*has_bits)[0] |= 8u;
+  }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x0000000f) ^ 0x0000000f) != 0;
+  }
+};
+
+Inode::Inode(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::MessageLite(arena, is_message_owned) {
+  SharedCtor();
+  // @@protoc_insertion_point(arena_constructor:proto.Inode)
+}
+Inode::Inode(const Inode& from)
+  : ::PROTOBUF_NAMESPACE_ID::MessageLite(),
+      _has_bits_(from._has_bits_) {
+  _internal_metadata_.MergeFrom<std::string>(from._internal_metadata_);
+  ::memcpy(&device_, &from.device_,
+    static_cast<size_t>(reinterpret_cast<char*>(&changed_nanoseconds_) -
+    reinterpret_cast<char*>(&device_)) + sizeof(changed_nanoseconds_));
+  // @@protoc_insertion_point(copy_constructor:proto.Inode)
+}
+
+inline void Inode::SharedCtor() {
+::memset(reinterpret_cast<char*>(this) + static_cast<size_t>(
+    reinterpret_cast<char*>(&device_) - reinterpret_cast<char*>(this)),
+    0, static_cast<size_t>(reinterpret_cast<char*>(&changed_nanoseconds_) -
+    reinterpret_cast<char*>(&device_)) + sizeof(changed_nanoseconds_));
+}
+
+Inode::~Inode() {
+  // @@protoc_insertion_point(destructor:proto.Inode)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<std::string>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void Inode::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+}
+
+void Inode::SetCachedSize(int size) const {
+  _cached_size_.Set(size);
+}
+
+void Inode::Clear() {
+// @@protoc_insertion_point(message_clear_start:proto.Inode)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _has_bits_[0];
+  if (cached_has_bits & 0x0000000fu) {
+    ::memset(&device_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&changed_nanoseconds_) -
+        reinterpret_cast<char*>(&device_)) + sizeof(changed_nanoseconds_));
+  }
+  _has_bits_.Clear();
+  _internal_metadata_.Clear<std::string>();
+}
+
+const char* Inode::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // required uint64 device = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _Internal::set_has_device(&has_bits);
+          device_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // required uint64 number = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _Internal::set_has_number(&has_bits);
+          number_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // required uint64 size = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _Internal::set_has_size(&has_bits);
+          size_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // required uint64 changed_nanoseconds = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          _Internal::set_has_changed_nanoseconds(&has_bits);
+          changed_nanoseconds_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<std::string>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* Inode::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:proto.Inode)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _has_bits_[0];
+  // required uint64 device = 1;
+  if (cached_has_bits & 0x00000001u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(1, this->_internal_device(), target);
+  }
+
+  // required uint64 number = 2;
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(2, this->_internal_number(), target);
+  }
+
+  // required uint64 size = 3;
+  if (cached_has_bits & 0x00000004u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(3, this->_internal_size(), target);
+  }
+
+  // required uint64 changed_nanoseconds = 4;
+  if (cached_has_bits & 0x00000008u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(4, this->_internal_changed_nanoseconds(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = stream->WriteRaw(_internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString).data(),
+        static_cast<int>(_internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString).size()), target);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:proto.Inode)
+  return target;
+}
+
+size_t Inode::RequiredFieldsByteSizeFallback() const {
+// @@protoc_insertion_point(required_fields_byte_size_fallback_start:proto.Inode)
+  size_t total_size = 0;
+
+  if (_internal_has_device()) {
+    // required uint64 device = 1;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_device());
+  }
+
+  if (_internal_has_number()) {
+    // required uint64 number = 2;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_number());
+  }
+
+  if (_internal_has_size()) {
+    // required uint64 size = 3;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_size());
+  }
+
+  if (_internal_has_changed_nanoseconds()) {
+    // required uint64 changed_nanoseconds = 4;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_changed_nanoseconds());
+  }
+
+  return total_size;
+}
+size_t Inode::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:proto.Inode)
+  size_t total_size = 0;
+
+  if (((_has_bits_[0] & 0x0000000f) ^ 0x0000000f) == 0) {  // All required fields are present.
+    // required uint64 device = 1;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_device());
+
+    // required uint64 number = 2;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_number());
+
+    // required uint64 size = 3;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_size());
+
+    // required uint64 changed_nanoseconds = 4;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_changed_nanoseconds());
+
+  } else {
+    total_size += RequiredFieldsByteSizeFallback();
+  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    total_size += _internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString).size();
+  }
+  int cached_size = ::_pbi::ToCachedSize(total_size);
+  SetCachedSize(cached_size);
+  return total_size;
+}
+
+void Inode::CheckTypeAndMergeFrom(
+    const ::PROTOBUF_NAMESPACE_ID::MessageLite& from) {
+  MergeFrom(*::_pbi::DownCast<const Inode*>(
+      &from));
+}
+
+void Inode::MergeFrom(const Inode& from) {
+// @@protoc_insertion_point(class_specific_merge_from_start:proto.Inode)
+  GOOGLE_DCHECK_NE(&from, this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._has_bits_[0];
+  if (cached_has_bits & 0x0000000fu) {
+    if (cached_has_bits & 0x00000001u) {
+      device_ = from.device_;
+    }
+    if (cached_has_bits & 0x00000002u) {
+      number_ = from.number_;
+    }
+    if (cached_has_bits & 0x00000004u) {
+      size_ = from.size_;
+    }
+    if (cached_has_bits & 0x00000008u) {
+      changed_nanoseconds_ = from.changed_nanoseconds_;
+    }
+    _has_bits_[0] |= cached_has_bits;
+  }
+  _internal_metadata_.MergeFrom<std::string>(from._internal_metadata_);
+}
+
+void Inode::CopyFrom(const Inode& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:proto.Inode)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool Inode::IsInitialized() const {
+  if (_Internal::MissingRequiredFields(_has_bits_)) return false;
+  return true;
+}
+
+void Inode::InternalSwap(Inode* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_has_bits_[0], other->_has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(Inode, changed_nanoseconds_)
+      + sizeof(Inode::changed_nanoseconds_)
+      - PROTOBUF_FIELD_OFFSET(Inode, device_)>(
+          reinterpret_cast<char*>(&device_),
+          reinterpret_cast<char*>(&other->device_));
+}
+
+std::string Inode::GetTypeName() const {
+  return "proto.Inode";
+}
+
+
+// ===================================================================
+
+class Hole::_Internal {
+ public:
+  using HasBits = decltype(std::declval<Hole>()._has_bits_);
+  static void set_has_offset(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_size(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x00000003) ^ 0x00000003) != 0;
+  }
+};
+
+Hole::Hole(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::MessageLite(arena, is_message_owned) {
+  SharedCtor();
+  // @@protoc_insertion_point(arena_constructor:proto.Hole)
+}
+Hole::Hole(const Hole& from)
+  : ::PROTOBUF_NAMESPACE_ID::MessageLite(),
+      _has_bits_(from._has_bits_) {
+  _internal_metadata_.MergeFrom<std::string>(from._internal_metadata_);
+  ::memcpy(&offset_, &from.offset_,
+    static_cast<size_t>(reinterpret_cast<char*>(&size_) -
+    reinterpret_cast<char*>(&offset_)) + sizeof(size_));
+  // @@protoc_insertion_point(copy_constructor:proto.Hole)
+}
+
+inline void Hole::SharedCtor() {
+::memset(reinterpret_cast<char*>(this) + static_cast<size_t>(
+    reinterpret_cast<char*>(&offset_) - reinterpret_cast<char*>(this)),
+    0, static_cast<size_t>(reinterpret_cast<char*>(&size_) -
+    reinterpret_cast<char*>(&offset_)) + sizeof(size_));
+}
+
+Hole::~Hole() {
+  // @@protoc_insertion_point(destructor:proto.Hole)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<std::string>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void Hole::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+}
+
+void Hole::SetCachedSize(int size) const {
+  _cached_size_.Set(size);
+}
+
+void Hole::Clear() {
+// @@protoc_insertion_point(message_clear_start:proto.Hole)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  cached_has_bits = _has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    ::memset(&offset_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&size_) -
+        reinterpret_cast<char*>(&offset_)) + sizeof(size_));
+  }
+  _has_bits_.Clear();
+  _internal_metadata_.Clear<std::string>();
+}
+
+const char* Hole::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // required uint64 offset = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _Internal::set_has_offset(&has_bits);
+          offset_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // required uint64 size = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _Internal::set_has_size(&has_bits);
+          size_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<std::string>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* Hole::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:proto.Hole)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _has_bits_[0];
+  // required uint64 offset = 1;
+  if (cached_has_bits & 0x00000001u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(1, this->_internal_offset(), target);
+  }
+
+  // required uint64 size = 2;
+  if (cached_has_bits & 0x00000002u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(2, this->_internal_size(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = stream->WriteRaw(_internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString).data(),
+        static_cast<int>(_internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString).size()), target);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:proto.Hole)
+  return target;
+}
+
+size_t Hole::RequiredFieldsByteSizeFallback() const {
+// @@protoc_insertion_point(required_fields_byte_size_fallback_start:proto.Hole)
+  size_t total_size = 0;
+
+  if (_internal_has_offset()) {
+    // required uint64 offset = 1;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_offset());
+  }
+
+  if (_internal_has_size()) {
+    // required uint64 size = 2;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_size());
+  }
+
+  return total_size;
+}
+size_t Hole::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:proto.Hole)
+  size_t total_size = 0;
+
+  if (((_has_bits_[0] & 0x00000003) ^ 0x00000003) == 0) {  // All required fields are present.
+    // required uint64 offset = 1;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_offset());
+
+    // required uint64 size = 2;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_size());
+
+  } else {
+    total_size += RequiredFieldsByteSizeFallback();
+  }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    total_size += _internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString).size();
+  }
+  int cached_size = ::_pbi::ToCachedSize(total_size);
+  SetCachedSize(cached_size);
+  return total_size;
+}
+
+void Hole::CheckTypeAndMergeFrom(
+    const ::PROTOBUF_NAMESPACE_ID::MessageLite& from) {
+  MergeFrom(*::_pbi::DownCast<const Hole*>(
+      &from));
+}
+
+void Hole::MergeFrom(const Hole& from) {
+// @@protoc_insertion_point(class_specific_merge_from_start:proto.Hole)
+  GOOGLE_DCHECK_NE(&from, this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    if (cached_has_bits & 0x00000001u) {
+      offset_ = from.offset_;
+    }
+    if (cached_has_bits & 0x00000002u) {
+      size_ = from.size_;
+    }
+    _has_bits_[0] |= cached_has_bits;
+  }
+  _internal_metadata_.MergeFrom<std::string>(from._internal_metadata_);
+}
+
+void Hole::CopyFrom(const Hole& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:proto.Hole)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool Hole::IsInitialized() const {
+  if (_Internal::MissingRequiredFields(_has_bits_)) return false;
+  return true;
+}
+
+void Hole::InternalSwap(Hole* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_has_bits_[0], other->_has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(Hole, size_)
+      + sizeof(Hole::size_)
+      - PROTOBUF_FIELD_OFFSET(Hole, offset_)>(
+          reinterpret_cast<char*>(&offset_),
+          reinterpret_cast<char*>(&other->offset_));
+}
+
+std::string Hole::GetTypeName() const {
+  return "proto.Hole";
+}
+
+
+// ===================================================================
+
+class Fs_record::_Internal {
+ public:
+  using HasBits = decltype(std::declval<Fs_record>()._has_bits_);
+  static void set_has_pathname(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_type(HasBits* has_bits) {
+    (*has_bits)[0] |= 256u;
+  }
+  static void set_has_modified_nanoseconds(HasBits* has_bits) {
+    (*has_bits)[0] |= 128u;
+  }
+  static const ::proto::Ref_to_refcount& ref(const Fs_record* msg);
+  static void set_has_ref(HasBits* has_bits) {
+    (*has_bits)[0] |= 32u;
+  }
+  static void set_has_symlink_target(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static void set_has_unix_permissions(HasBits* has_bits) {
+    (*has_bits)[0] |= 512u;
+  }
+  static void set_has_posix_acl(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+  static void set_has_posix_default_acl(HasBits* has_bits) {
+    (*has_bits)[0] |= 8u;
+  }
+  static const ::proto::Inode& inode(const Fs_record* msg);
+  static void set_has_inode(HasBits* has_bits) {
+    (*has_bits)[0] |= 64u;
+  }
+  static void set_has_hard_link(HasBits* has_bits) {
+    (*has_bits)[0] |= 16u;
+  }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x00000101) ^ 0x00000101) != 0;
+  }
+};
+
+const ::proto::Ref_to_refcount&
+Fs_record::_Internal::ref(const Fs_record* msg) {
+  return *msg->ref_;
+}
+const ::proto::Inode&
+Fs_record::_Internal::inode(const Fs_record* msg) {
+  return *msg->inode_;
+}
+Fs_record::Fs_record(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::MessageLite(arena, is_message_owned),
+  chunks_(arena),
+  holes_(arena) {
+  SharedCtor();
+  // @@protoc_insertion_point(arena_constructor:proto.Fs_record)
+}
+Fs_record::Fs_record(const Fs_record& from)
+  : ::PROTOBUF_NAMESPACE_ID::MessageLite(),
+      _has_bits_(from._has_bits_),
+      chunks_(from.chunks_),
+      holes_(from.holes_) {
+  _internal_metadata_.MergeFrom<std::string>(from._internal_metadata_);
+  pathname_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    pathname_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_pathname()) {
+    pathname_.Set(from._internal_pathname(), 
+      GetArenaForAllocation());
+  }
+  symlink_target_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    symlink_target_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_symlink_target()) {
+    symlink_target_.Set(from._internal_symlink_target(), 
+      GetArenaForAllocation());
+  }
+  posix_acl_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    posix_acl_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_posix_acl()) {
+    posix_acl_.Set(from._internal_posix_acl(), 
+      GetArenaForAllocation());
+  }
+  posix_default_acl_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    posix_default_acl_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_posix_default_acl()) {
+    posix_default_acl_.Set(from._internal_posix_default_acl(), 
+      GetArenaForAllocation());
+  }
+  hard_link_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    hard_link_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_hard_link()) {
+    hard_link_.Set(from._internal_hard_link(), 
+      GetArenaForAllocation());
+  }
+  if (from._internal_has_ref()) {
+    ref_ = new ::proto::Ref_to_refcount(*from.ref_);
+  } else {
+    ref_ = nullptr;
+  }
+  if (from._internal_has_inode()) {
+    inode_ = new ::proto::Inode(*from.inode_);
+  } else {
+    inode_ = nullptr;
+  }
+  ::memcpy(&modified_nanoseconds_, &from.modified_nanoseconds_,
+    static_cast<size_t>(reinterpret_cast<char*>(&unix_permissions_) -
+    reinterpret_cast<char*>(&modified_nanoseconds_)) + sizeof(unix_permissions_));
+  // @@protoc_insertion_point(copy_constructor:proto.Fs_record)
+}
+
+inline void Fs_record::SharedCtor() {
+pathname_.InitDefault();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  pathname_.Set("", GetArenaForAllocation());
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+symlink_target_.InitDefault();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  symlink_target_.Set("", GetArenaForAllocation());
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+posix_acl_.InitDefault();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  posix_acl_.Set("", GetArenaForAllocation());
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+posix_default_acl_.InitDefault();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  posix_default_acl_.Set("", GetArenaForAllocation());
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+hard_link_.InitDefault();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  hard_link_.Set("", GetArenaForAllocation());
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+::memset(reinterpret_cast<char*>(this) + static_cast<size_t>(
+    reinterpret_cast<char*>(&ref_) - reinterpret_cast<char*>(this)),
+    0, static_cast<size_t>(reinterpret_cast<char*>(&unix_permissions_) -
+    reinterpret_cast<char*>(&ref_)) + sizeof(unix_permissions_));
+}
+
+Fs_record::~Fs_record() {
+  // @@protoc_insertion_point(destructor:proto.Fs_record)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<std::string>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void Fs_record::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  pathname_.Destroy();
+  symlink_target_.Destroy();
+  posix_acl_.Destroy();
+  posix_default_acl_.Destroy();
+  hard_link_.Destroy();
+  if (this != internal_default_instance()) delete ref_;
+  if (this != internal_default_instance()) delete inode_;
+}
+
+void Fs_record::SetCachedSize(int size) const {
+  _cached_size_.Set(size);
+}
+
+void Fs_record::Clear() {
+// @@protoc_insertion_point(message_clear_start:proto.Fs_record)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  chunks_.Clear();
+  holes_.Clear();
+  cached_has_bits = _has_bits_[0];
+  if (cached_has_bits & 0x0000007fu) {
+    if (cached_has_bits & 0x00000001u) {
+      pathname_.ClearNonDefaultToEmpty();
+    }
+    if (cached_has_bits & 0x00000002u) {
+      symlink_target_.ClearNonDefaultToEmpty();
+    }
+    if (cached_has_bits & 0x00000004u) {
+      posix_acl_.ClearNonDefaultToEmpty();
+    }
+    if (cached_has_bits & 0x00000008u) {
+      posix_default_acl_.ClearNonDefaultToEmpty();
+    }
+    if (cached_has_bits & 0x00000010u) {
+      hard_link_.ClearNonDefaultToEmpty();
+    }
+    if (cached_has_bits & 0x00000020u) {
+      GOOGLE_DCHECK(ref_ != nullptr);
+      ref_->Clear();
+    }
+    if (cached_has_bits & 0x00000040u) {
+      GOOGLE_DCHECK(inode_ != nullptr);
+      inode_->Clear();
+    }
+  }
+  modified_nanoseconds_ = uint64_t{0u};
+  if (cached_has_bits & 0x00000300u) {
+    ::memset(&type_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&unix_permissions_) -
+        reinterpret_cast<char*>(&type_)) + sizeof(unix_permissions_));
+  }
+  _has_bits_.Clear();
+  _internal_metadata_.Clear<std::string>();
+}
+
+const char* Fs_record::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // required string pathname = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_pathname();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // required .proto.File_type type = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          uint64_t val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+          if (PROTOBUF_PREDICT_TRUE(::proto::File_type_IsValid(val))) {
+            _internal_set_type(static_cast<::proto::File_type>(val));
+          } else {
+            ::PROTOBUF_NAMESPACE_ID::internal::WriteVarint(2, val, mutable_unknown_fields());
+          }
+        } else
+          goto handle_unusual;
+        continue;
+      // optional uint64 modified_nanoseconds = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _Internal::set_has_modified_nanoseconds(&has_bits);
+          modified_nanoseconds_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional .proto.Ref_to_refcount ref = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 34)) {
+          ptr = ctx->ParseMessage(_internal_mutable_ref(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional string symlink_target = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 42)) {
+          auto str = _internal_mutable_symlink_target();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional uint32 unix_permissions = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 48)) {
+          _Internal::set_has_unix_permissions(&has_bits);
+          unix_permissions_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional string posix_acl = 7;
+      case 7:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 58)) {
+          auto str = _internal_mutable_posix_acl();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional string posix_default_acl = 8;
+      case 8:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 66)) {
+          auto str = _internal_mutable_posix_default_acl();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated .proto.Ref_to_refcount chunks = 9;
+      case 9:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 74)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_chunks(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<74>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      // optional .proto.Inode inode = 10;
+      case 10:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 82)) {
+          ptr = ctx->ParseMessage(_internal_mutable_inode(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional string hard_link = 11;
+      case 11:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 90)) {
+          auto str = _internal_mutable_hard_link();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated .proto.Hole holes = 12;
+      case 12:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 98)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_holes(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<98>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<std::string>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  _has_bits_.Or(has_bits);
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* Fs_record::_InternalSerialize(
     uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
   // @@protoc_insertion_point(serialize_to_array_start:proto.Fs_record)
   uint32_t cached_has_bits = 0;
@@ -1818,20 +3048,20 @@ uint8_t* Fs_record::_InternalSerialize(
   }
 
   // required .proto.File_type type = 2;
-  if (cached_has_bits & 0x00000040u) {
+  if (cached_has_bits & 0x00000100u) {
     target = stream->EnsureSpace(target);
     target = ::_pbi::WireFormatLite::WriteEnumToArray(
       2, this->_internal_type(), target);
   }
 
   // optional uint64 modified_nanoseconds = 3;
-  if (cached_has_bits & 0x00000020u) {
+  if (cached_has_bits & 0x00000080u) {
     target = stream->EnsureSpace(target);
     target = ::_pbi::WireFormatLite::WriteUInt64ToArray(3, this->_internal_modified_nanoseconds(), target);
   }
 
   // optional .proto.Ref_to_refcount ref = 4;
-  if (cached_has_bits & 0x00000010u) {
+  if (cached_has_bits & 0x00000020u) {
     target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
       InternalWriteMessage(4, _Internal::ref(this),
         _Internal::ref(this).GetCachedSize(), target, stream);
@@ -1844,7 +3074,7 @@ uint8_t* Fs_record::_InternalSerialize(
   }
 
   // optional uint32 unix_permissions = 6;
-  if (cached_has_bits & 0x00000080u) {
+  if (cached_has_bits & 0x00000200u) {
     target = stream->EnsureSpace(target);
     target = ::_pbi::WireFormatLite::WriteUInt32ToArray(6, this->_internal_unix_permissions(), target);
   }
@@ -1861,6 +3091,35 @@ uint8_t* Fs_record::_InternalSerialize(
         8, this->_internal_posix_default_acl(), target);
   }
 
+  // repeated .proto.Ref_to_refcount chunks = 9;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_chunks_size()); i < n; i++) {
+    const auto& repfield = this->_internal_chunks(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(9, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  // optional .proto.Inode inode = 10;
+  if (cached_has_bits & 0x00000040u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(10, _Internal::inode(this),
+        _Internal::inode(this).GetCachedSize(), target, stream);
+  }
+
+  // optional string hard_link = 11;
+  if (cached_has_bits & 0x00000010u) {
+    target = stream->WriteStringMaybeAliased(
+        11, this->_internal_hard_link(), target);
+  }
+
+  // repeated .proto.Hole holes = 12;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_holes_size()); i < n; i++) {
+    const auto& repfield = this->_internal_holes(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(12, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
     target = stream->WriteRaw(_internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString).data(),
         static_cast<int>(_internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString).size()), target);
@@ -1892,7 +3151,7 @@ size_t Fs_record::ByteSizeLong() const {
 // @@protoc_insertion_point(message_byte_size_start:proto.Fs_record)
   size_t total_size = 0;
 
-  if (((_has_bits_[0] & 0x00000041) ^ 0x00000041) == 0) {  // All required fields are present.
+  if (((_has_bits_[0] & 0x00000101) ^ 0x00000101) == 0) {  // All required fields are present.
     // required string pathname = 1;
     total_size += 1 +
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
@@ -1909,8 +3168,22 @@ size_t Fs_record::ByteSizeLong() const {
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
+  // repeated .proto.Ref_to_refcount chunks = 9;
+  total_size += 1UL * this->_internal_chunks_size();
+  for (const auto& msg : this->chunks_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  // repeated .proto.Hole holes = 12;
+  total_size += 1UL * this->_internal_holes_size();
+  for (const auto& msg : this->holes_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
   cached_has_bits = _has_bits_[0];
-  if (cached_has_bits & 0x0000003eu) {
+  if (cached_has_bits & 0x000000feu) {
     // optional string symlink_target = 5;
     if (cached_has_bits & 0x00000002u) {
       total_size += 1 +
@@ -1925,29 +3198,297 @@ size_t Fs_record::ByteSizeLong() const {
           this->_internal_posix_acl());
     }
 
-    // optional string posix_default_acl = 8;
-    if (cached_has_bits & 0x00000008u) {
-      total_size += 1 +
-        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
-          this->_internal_posix_default_acl());
-    }
+    // optional string posix_default_acl = 8;
+    if (cached_has_bits & 0x00000008u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+          this->_internal_posix_default_acl());
+    }
+
+    // optional string hard_link = 11;
+    if (cached_has_bits & 0x00000010u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+          this->_internal_hard_link());
+    }
+
+    // optional .proto.Ref_to_refcount ref = 4;
+    if (cached_has_bits & 0x00000020u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *ref_);
+    }
+
+    // optional .proto.Inode inode = 10;
+    if (cached_has_bits & 0x00000040u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *inode_);
+    }
+
+    // optional uint64 modified_nanoseconds = 3;
+    if (cached_has_bits & 0x00000080u) {
+      total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_modified_nanoseconds());
+    }
+
+  }
+  // optional uint32 unix_permissions = 6;
+  if (cached_has_bits & 0x00000200u) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_unix_permissions());
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    total_size += _internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString).size();
+  }
+  int cached_size = ::_pbi::ToCachedSize(total_size);
+  SetCachedSize(cached_size);
+  return total_size;
+}
+
+void Fs_record::CheckTypeAndMergeFrom(
+    const ::PROTOBUF_NAMESPACE_ID::MessageLite& from) {
+  MergeFrom(*::_pbi::DownCast<const Fs_record*>(
+      &from));
+}
+
+void Fs_record::MergeFrom(const Fs_record& from) {
+// @@protoc_insertion_point(class_specific_merge_from_start:proto.Fs_record)
+  GOOGLE_DCHECK_NE(&from, this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  chunks_.MergeFrom(from.chunks_);
+  holes_.MergeFrom(from.holes_);
+  cached_has_bits = from._has_bits_[0];
+  if (cached_has_bits & 0x000000ffu) {
+    if (cached_has_bits & 0x00000001u) {
+      _internal_set_pathname(from._internal_pathname());
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _internal_set_symlink_target(from._internal_symlink_target());
+    }
+    if (cached_has_bits & 0x00000004u) {
+      _internal_set_posix_acl(from._internal_posix_acl());
+    }
+    if (cached_has_bits & 0x00000008u) {
+      _internal_set_posix_default_acl(from._internal_posix_default_acl());
+    }
+    if (cached_has_bits & 0x00000010u) {
+      _internal_set_hard_link(from._internal_hard_link());
+    }
+    if (cached_has_bits & 0x00000020u) {
+      _internal_mutable_ref()->::proto::Ref_to_refcount::MergeFrom(from._internal_ref());
+    }
+    if (cached_has_bits & 0x00000040u) {
+      _internal_mutable_inode()->::proto::Inode::MergeFrom(from._internal_inode());
+    }
+    if (cached_has_bits & 0x00000080u) {
+      modified_nanoseconds_ = from.modified_nanoseconds_;
+    }
+    _has_bits_[0] |= cached_has_bits;
+  }
+  if (cached_has_bits & 0x00000300u) {
+    if (cached_has_bits & 0x00000100u) {
+      type_ = from.type_;
+    }
+    if (cached_has_bits & 0x00000200u) {
+      unix_permissions_ = from.unix_permissions_;
+    }
+    _has_bits_[0] |= cached_has_bits;
+  }
+  _internal_metadata_.MergeFrom<std::string>(from._internal_metadata_);
+}
+
+void Fs_record::CopyFrom(const Fs_record& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:proto.Fs_record)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool Fs_record::IsInitialized() const {
+  if (_Internal::MissingRequiredFields(_has_bits_)) return false;
+  if (!::PROTOBUF_NAMESPACE_ID::internal::AllAreInitialized(chunks_))
+    return false;
+  if (!::PROTOBUF_NAMESPACE_ID::internal::AllAreInitialized(holes_))
+    return false;
+  if (_internal_has_ref()) {
+    if (!ref_->IsInitialized()) return false;
+  }
+  if (_internal_has_inode()) {
+    if (!inode_->IsInitialized()) return false;
+  }
+  return true;
+}
+
+void Fs_record::InternalSwap(Fs_record* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_has_bits_[0], other->_has_bits_[0]);
+  chunks_.InternalSwap(&other->chunks_);
+  holes_.InternalSwap(&other->holes_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &pathname_, lhs_arena,
+      &other->pathname_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &symlink_target_, lhs_arena,
+      &other->symlink_target_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &posix_acl_, lhs_arena,
+      &other->posix_acl_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &posix_default_acl_, lhs_arena,
+      &other->posix_default_acl_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &hard_link_, lhs_arena,
+      &other->hard_link_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(Fs_record, unix_permissions_)
+      + sizeof(Fs_record::unix_permissions_)
+      - PROTOBUF_FIELD_OFFSET(Fs_record, ref_)>(
+          reinterpret_cast<char*>(&ref_),
+          reinterpret_cast<char*>(&other->ref_));
+}
+
+std::string Fs_record::GetTypeName() const {
+  return "proto.Fs_record";
+}
+
+
+// ===================================================================
+
+class Fs_state::_Internal {
+ public:
+};
+
+Fs_state::Fs_state(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::MessageLite(arena, is_message_owned),
+  rec_(arena) {
+  SharedCtor();
+  // @@protoc_insertion_point(arena_constructor:proto.Fs_state)
+}
+Fs_state::Fs_state(const Fs_state& from)
+  : ::PROTOBUF_NAMESPACE_ID::MessageLite(),
+      rec_(from.rec_) {
+  _internal_metadata_.MergeFrom<std::string>(from._internal_metadata_);
+  // @@protoc_insertion_point(copy_constructor:proto.Fs_state)
+}
+
+inline void Fs_state::SharedCtor() {
+}
+
+Fs_state::~Fs_state() {
+  // @@protoc_insertion_point(destructor:proto.Fs_state)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<std::string>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void Fs_state::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+}
+
+void Fs_state::SetCachedSize(int size) const {
+  _cached_size_.Set(size);
+}
+
+void Fs_state::Clear() {
+// @@protoc_insertion_point(message_clear_start:proto.Fs_state)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  rec_.Clear();
+  _internal_metadata_.Clear<std::string>();
+}
+
+const char* Fs_state::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // repeated .proto.Fs_record rec = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_rec(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<10>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<std::string>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* Fs_state::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:proto.Fs_state)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // repeated .proto.Fs_record rec = 1;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_rec_size()); i < n; i++) {
+    const auto& repfield = this->_internal_rec(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(1, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = stream->WriteRaw(_internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString).data(),
+        static_cast<int>(_internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString).size()), target);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:proto.Fs_state)
+  return target;
+}
 
-    // optional .proto.Ref_to_refcount ref = 4;
-    if (cached_has_bits & 0x00000010u) {
-      total_size += 1 +
-        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
-          *ref_);
-    }
+size_t Fs_state::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:proto.Fs_state)
+  size_t total_size = 0;
 
-    // optional uint64 modified_nanoseconds = 3;
-    if (cached_has_bits & 0x00000020u) {
-      total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_modified_nanoseconds());
-    }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
 
-  }
-  // optional uint32 unix_permissions = 6;
-  if (cached_has_bits & 0x00000080u) {
-    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_unix_permissions());
+  // repeated .proto.Fs_record rec = 1;
+  total_size += 1UL * this->_internal_rec_size();
+  for (const auto& msg : this->rec_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
   }
 
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
@@ -1958,124 +3499,110 @@ size_t Fs_record::ByteSizeLong() const {
   return total_size;
 }
 
-void Fs_record::CheckTypeAndMergeFrom(
+void Fs_state::CheckTypeAndMergeFrom(
     const ::PROTOBUF_NAMESPACE_ID::MessageLite& from) {
-  MergeFrom(*::_pbi::DownCast<const Fs_record*>(
+  MergeFrom(*::_pbi::DownCast<const Fs_state*>(
       &from));
 }
 
-void Fs_record::MergeFrom(const Fs_record& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:proto.Fs_record)
+void Fs_state::MergeFrom(const Fs_state& from) {
+// @@protoc_insertion_point(class_specific_merge_from_start:proto.Fs_state)
   GOOGLE_DCHECK_NE(&from, this);
   uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  cached_has_bits = from._has_bits_[0];
-  if (cached_has_bits & 0x000000ffu) {
-    if (cached_has_bits & 0x00000001u) {
-      _internal_set_pathname(from._internal_pathname());
-    }
-    if (cached_has_bits & 0x00000002u) {
-      _internal_set_symlink_target(from._internal_symlink_target());
-    }
-    if (cached_has_bits & 0x00000004u) {
-      _internal_set_posix_acl(from._internal_posix_acl());
-    }
-    if (cached_has_bits & 0x00000008u) {
-      _internal_set_posix_default_acl(from._internal_posix_default_acl());
-    }
-    if (cached_has_bits & 0x00000010u) {
-      _internal_mutable_ref()->::proto::Ref_to_refcount::MergeFrom(from._internal_ref());
-    }
-    if (cached_has_bits & 0x00000020u) {
-      modified_nanoseconds_ = from.modified_nanoseconds_;
-    }
-    if (cached_has_bits & 0x00000040u) {
-      type_ = from.type_;
-    }
-    if (cached_has_bits & 0x00000080u) {
-      unix_permissions_ = from.unix_permissions_;
-    }
-    _has_bits_[0] |= cached_has_bits;
-  }
+  rec_.MergeFrom(from.rec_);
   _internal_metadata_.MergeFrom<std::string>(from._internal_metadata_);
 }
 
-void Fs_record::CopyFrom(const Fs_record& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:proto.Fs_record)
+void Fs_state::CopyFrom(const Fs_state& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:proto.Fs_state)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-bool Fs_record::IsInitialized() const {
-  if (_Internal::MissingRequiredFields(_has_bits_)) return false;
-  if (_internal_has_ref()) {
-    if (!ref_->IsInitialized()) return false;
-  }
+bool Fs_state::IsInitialized() const {
+  if (!::PROTOBUF_NAMESPACE_ID::internal::AllAreInitialized(rec_))
+    return false;
   return true;
 }
 
-void Fs_record::InternalSwap(Fs_record* other) {
+void Fs_state::InternalSwap(Fs_state* other) {
   using std::swap;
-  auto* lhs_arena = GetArenaForAllocation();
-  auto* rhs_arena = other->GetArenaForAllocation();
   _internal_metadata_.InternalSwap(&other->_internal_metadata_);
-  swap(_has_bits_[0], other->_has_bits_[0]);
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
-      &pathname_, lhs_arena,
-      &other->pathname_, rhs_arena
-  );
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
-      &symlink_target_, lhs_arena,
-      &other->symlink_target_, rhs_arena
-  );
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
-      &posix_acl_, lhs_arena,
-      &other->posix_acl_, rhs_arena
-  );
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
-      &posix_default_acl_, lhs_arena,
-      &other->posix_default_acl_, rhs_arena
-  );
-  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
-      PROTOBUF_FIELD_OFFSET(Fs_record, unix_permissions_)
-      + sizeof(Fs_record::unix_permissions_)
-      - PROTOBUF_FIELD_OFFSET(Fs_record, ref_)>(
-          reinterpret_cast<char*>(&ref_),
-          reinterpret_cast<char*>(&other->ref_));
+  rec_.InternalSwap(&other->rec_);
 }
 
-std::string Fs_record::GetTypeName() const {
-  return "proto.Fs_record";
+std::string Fs_state::GetTypeName() const {
+  return "proto.Fs_state";
 }
 
 
 // ===================================================================
 
-class Fs_state::_Internal {
+class State_file::_Internal {
  public:
+  using HasBits = decltype(std::declval<State_file>()._has_bits_);
+  static const ::proto::Filters& filters(const State_file* msg);
+  static void set_has_filters(HasBits* has_bits) {
+    (*has_bits)[0] |= 2u;
+  }
+  static void set_has_name(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
+  }
+  static void set_has_time_created(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+  static bool MissingRequiredFields(const HasBits& has_bits) {
+    return ((has_bits[0] & 0x00000005) ^ 0x00000005) != 0;
+  }
 };
 
-Fs_state::Fs_state(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+const ::proto::Filters&
+State_file::_Internal::filters(const State_file* msg) {
+  return *msg->filters_;
+}
+State_file::State_file(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                          bool is_message_owned)
-  : ::PROTOBUF_NAMESPACE_ID::MessageLite(arena, is_message_owned),
-  rec_(arena) {
+  : ::PROTOBUF_NAMESPACE_ID::MessageLite(arena, is_message_owned) {
   SharedCtor();
-  // @@protoc_insertion_point(arena_constructor:proto.Fs_state)
+  // @@protoc_insertion_point(arena_constructor:proto.State_file)
 }
-Fs_state::Fs_state(const Fs_state& from)
+State_file::State_file(const State_file& from)
   : ::PROTOBUF_NAMESPACE_ID::MessageLite(),
-      rec_(from.rec_) {
+      _has_bits_(from._has_bits_) {
   _internal_metadata_.MergeFrom<std::string>(from._internal_metadata_);
-  // @@protoc_insertion_point(copy_constructor:proto.Fs_state)
+  name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_name()) {
+    name_.Set(from._internal_name(), 
+      GetArenaForAllocation());
+  }
+  if (from._internal_has_filters()) {
+    filters_ = new ::proto::Filters(*from.filters_);
+  } else {
+    filters_ = nullptr;
+  }
+  time_created_ = from.time_created_;
+  // @@protoc_insertion_point(copy_constructor:proto.State_file)
 }
 
-inline void Fs_state::SharedCtor() {
+inline void State_file::SharedCtor() {
+name_.InitDefault();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  name_.Set("", GetArenaForAllocation());
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+::memset(reinterpret_cast<char*>(this) + static_cast<size_t>(
+    reinterpret_cast<char*>(&filters_) - reinterpret_cast<char*>(this)),
+    0, static_cast<size_t>(reinterpret_cast<char*>(&time_created_) -
+    reinterpret_cast<char*>(&filters_)) + sizeof(time_created_));
 }
 
-Fs_state::~Fs_state() {
-  // @@protoc_insertion_point(destructor:proto.Fs_state)
+State_file::~State_file() {
+  // @@protoc_insertion_point(destructor:proto.State_file)
   if (auto *arena = _internal_metadata_.DeleteReturnArena<std::string>()) {
   (void)arena;
     return;
@@ -2083,40 +3610,67 @@ Fs_state::~Fs_state() {
   SharedDtor();
 }
 
-inline void Fs_state::SharedDtor() {
+inline void State_file::SharedDtor() {
   GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  name_.Destroy();
+  if (this != internal_default_instance()) delete filters_;
 }
 
-void Fs_state::SetCachedSize(int size) const {
+void State_file::SetCachedSize(int size) const {
   _cached_size_.Set(size);
 }
 
-void Fs_state::Clear() {
-// @@protoc_insertion_point(message_clear_start:proto.Fs_state)
+void State_file::Clear() {
+// @@protoc_insertion_point(message_clear_start:proto.State_file)
   uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  rec_.Clear();
+  cached_has_bits = _has_bits_[0];
+  if (cached_has_bits & 0x00000003u) {
+    if (cached_has_bits & 0x00000001u) {
+      name_.ClearNonDefaultToEmpty();
+    }
+    if (cached_has_bits & 0x00000002u) {
+      GOOGLE_DCHECK(filters_ != nullptr);
+      filters_->Clear();
+    }
+  }
+  time_created_ = uint64_t{0u};
+  _has_bits_.Clear();
   _internal_metadata_.Clear<std::string>();
 }
 
-const char* Fs_state::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+const char* State_file::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
 #define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  _Internal::HasBits has_bits{};
   while (!ctx->Done(&ptr)) {
     uint32_t tag;
     ptr = ::_pbi::ReadTag(ptr, &tag);
     switch (tag >> 3) {
-      // repeated .proto.Fs_record rec = 1;
+      // optional .proto.Filters filters = 1;
       case 1:
         if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
-          ptr -= 1;
-          do {
-            ptr += 1;
-            ptr = ctx->ParseMessage(_internal_add_rec(), ptr);
-            CHK_(ptr);
-            if (!ctx->DataAvailable(ptr)) break;
-          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<10>(ptr));
+          ptr = ctx->ParseMessage(_internal_mutable_filters(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // required string name = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          auto str = _internal_mutable_name();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // required uint64 time_created = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _Internal::set_has_time_created(&has_bits);
+          time_created_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
         } else
           goto handle_unusual;
         continue;
@@ -2136,6 +3690,7 @@ const char* Fs_state::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx)
     CHK_(ptr != nullptr);
   }  // while
 message_done:
+  _has_bits_.Or(has_bits);
   return ptr;
 failure:
   ptr = nullptr;
@@ -2143,41 +3698,84 @@ failure:
 #undef CHK_
 }
 
-uint8_t* Fs_state::_InternalSerialize(
-    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
-  // @@protoc_insertion_point(serialize_to_array_start:proto.Fs_state)
-  uint32_t cached_has_bits = 0;
-  (void) cached_has_bits;
+uint8_t* State_file::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:proto.State_file)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _has_bits_[0];
+  // optional .proto.Filters filters = 1;
+  if (cached_has_bits & 0x00000002u) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(1, _Internal::filters(this),
+        _Internal::filters(this).GetCachedSize(), target, stream);
+  }
+
+  // required string name = 2;
+  if (cached_has_bits & 0x00000001u) {
+    target = stream->WriteStringMaybeAliased(
+        2, this->_internal_name(), target);
+  }
 
-  // repeated .proto.Fs_record rec = 1;
-  for (unsigned i = 0,
-      n = static_cast<unsigned>(this->_internal_rec_size()); i < n; i++) {
-    const auto& repfield = this->_internal_rec(i);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
-        InternalWriteMessage(1, repfield, repfield.GetCachedSize(), target, stream);
+  // required uint64 time_created = 3;
+  if (cached_has_bits & 0x00000004u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(3, this->_internal_time_created(), target);
   }
 
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
     target = stream->WriteRaw(_internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString).data(),
         static_cast<int>(_internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString).size()), target);
   }
-  // @@protoc_insertion_point(serialize_to_array_end:proto.Fs_state)
+  // @@protoc_insertion_point(serialize_to_array_end:proto.State_file)
   return target;
 }
 
-size_t Fs_state::ByteSizeLong() const {
-// @@protoc_insertion_point(message_byte_size_start:proto.Fs_state)
+size_t State_file::RequiredFieldsByteSizeFallback() const {
+// @@protoc_insertion_point(required_fields_byte_size_fallback_start:proto.State_file)
+  size_t total_size = 0;
+
+  if (_internal_has_name()) {
+    // required string name = 2;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_name());
+  }
+
+  if (_internal_has_time_created()) {
+    // required uint64 time_created = 3;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_time_created());
+  }
+
+  return total_size;
+}
+size_t State_file::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:proto.State_file)
   size_t total_size = 0;
 
+  if (((_has_bits_[0] & 0x00000005) ^ 0x00000005) == 0) {  // All required fields are present.
+    // required string name = 2;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_name());
+
+    // required uint64 time_created = 3;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_time_created());
+
+  } else {
+    total_size += RequiredFieldsByteSizeFallback();
+  }
   uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  // repeated .proto.Fs_record rec = 1;
-  total_size += 1UL * this->_internal_rec_size();
-  for (const auto& msg : this->rec_) {
-    total_size +=
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  // optional .proto.Filters filters = 1;
+  cached_has_bits = _has_bits_[0];
+  if (cached_has_bits & 0x00000002u) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *filters_);
   }
 
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
@@ -2188,79 +3786,112 @@ size_t Fs_state::ByteSizeLong() const {
   return total_size;
 }
 
-void Fs_state::CheckTypeAndMergeFrom(
+void State_file::CheckTypeAndMergeFrom(
     const ::PROTOBUF_NAMESPACE_ID::MessageLite& from) {
-  MergeFrom(*::_pbi::DownCast<const Fs_state*>(
+  MergeFrom(*::_pbi::DownCast<const State_file*>(
       &from));
 }
 
-void Fs_state::MergeFrom(const Fs_state& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:proto.Fs_state)
+void State_file::MergeFrom(const State_file& from) {
+// @@protoc_insertion_point(class_specific_merge_from_start:proto.State_file)
   GOOGLE_DCHECK_NE(&from, this);
   uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  rec_.MergeFrom(from.rec_);
+  cached_has_bits = from._has_bits_[0];
+  if (cached_has_bits & 0x00000007u) {
+    if (cached_has_bits & 0x00000001u) {
+      _internal_set_name(from._internal_name());
+    }
+    if (cached_has_bits & 0x00000002u) {
+      _internal_mutable_filters()->::proto::Filters::MergeFrom(from._internal_filters());
+    }
+    if (cached_has_bits & 0x00000004u) {
+      time_created_ = from.time_created_;
+    }
+    _has_bits_[0] |= cached_has_bits;
+  }
   _internal_metadata_.MergeFrom<std::string>(from._internal_metadata_);
 }
 
-void Fs_state::CopyFrom(const Fs_state& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:proto.Fs_state)
+void State_file::CopyFrom(const State_file& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:proto.State_file)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-bool Fs_state::IsInitialized() const {
-  if (!::PROTOBUF_NAMESPACE_ID::internal::AllAreInitialized(rec_))
-    return false;
+bool State_file::IsInitialized() const {
+  if (_Internal::MissingRequiredFields(_has_bits_)) return false;
+  if (_internal_has_filters()) {
+    if (!filters_->IsInitialized()) return false;
+  }
   return true;
 }
 
-void Fs_state::InternalSwap(Fs_state* other) {
+void State_file::InternalSwap(State_file* other) {
   using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
   _internal_metadata_.InternalSwap(&other->_internal_metadata_);
-  rec_.InternalSwap(&other->rec_);
+  swap(_has_bits_[0], other->_has_bits_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &name_, lhs_arena,
+      &other->name_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(State_file, time_created_)
+      + sizeof(State_file::time_created_)
+      - PROTOBUF_FIELD_OFFSET(State_file, filters_)>(
+          reinterpret_cast<char*>(&filters_),
+          reinterpret_cast<char*>(&other->filters_));
 }
 
-std::string Fs_state::GetTypeName() const {
-  return "proto.Fs_state";
+std::string State_file::GetTypeName() const {
+  return "proto.State_file";
 }
 
 
 // ===================================================================
 
-class State_file::_Internal {
+class Content_file::_Internal {
  public:
-  using HasBits = decltype(std::declval<State_file>()._has_bits_);
-  static const ::proto::Filters& filters(const State_file* msg);
+  using HasBits = decltype(std::declval<Content_file>()._has_bits_);
+  static const ::proto::Filters& filters(const Content_file* msg);
   static void set_has_filters(HasBits* has_bits) {
     (*has_bits)[0] |= 2u;
   }
   static void set_has_name(HasBits* has_bits) {
     (*has_bits)[0] |= 1u;
   }
-  static void set_has_time_created(HasBits* has_bits) {
+  static void set_has_size(HasBits* has_bits) {
     (*has_bits)[0] |= 4u;
   }
+  static void set_has_block_size(HasBits* has_bits) {
+    (*has_bits)[0] |= 8u;
+  }
   static bool MissingRequiredFields(const HasBits& has_bits) {
-    return ((has_bits[0] & 0x00000005) ^ 0x00000005) != 0;
+    return ((has_bits[0] & 0x00000001) ^ 0x00000001) != 0;
   }
 };
 
 const ::proto::Filters&
-State_file::_Internal::filters(const State_file* msg) {
+Content_file::_Internal::filters(const Content_file* msg) {
   return *msg->filters_;
 }
-State_file::State_file(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+Content_file::Content_file(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                          bool is_message_owned)
-  : ::PROTOBUF_NAMESPACE_ID::MessageLite(arena, is_message_owned) {
+  : ::PROTOBUF_NAMESPACE_ID::MessageLite(arena, is_message_owned),
+  refs_(arena),
+  block_xxhash_(arena) {
   SharedCtor();
-  // @@protoc_insertion_point(arena_constructor:proto.State_file)
+  // @@protoc_insertion_point(arena_constructor:proto.Content_file)
 }
-State_file::State_file(const State_file& from)
+Content_file::Content_file(const Content_file& from)
   : ::PROTOBUF_NAMESPACE_ID::MessageLite(),
-      _has_bits_(from._has_bits_) {
+      _has_bits_(from._has_bits_),
+      refs_(from.refs_),
+      block_xxhash_(from.block_xxhash_) {
   _internal_metadata_.MergeFrom<std::string>(from._internal_metadata_);
   name_.InitDefault();
   #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
@@ -2275,23 +3906,25 @@ State_file::State_file(const State_file& from)
   } else {
     filters_ = nullptr;
   }
-  time_created_ = from.time_created_;
-  // @@protoc_insertion_point(copy_constructor:proto.State_file)
+  ::memcpy(&size_, &from.size_,
+    static_cast<size_t>(reinterpret_cast<char*>(&block_size_) -
+    reinterpret_cast<char*>(&size_)) + sizeof(block_size_));
+  // @@protoc_insertion_point(copy_constructor:proto.Content_file)
 }
 
-inline void State_file::SharedCtor() {
+inline void Content_file::SharedCtor() {
 name_.InitDefault();
 #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
   name_.Set("", GetArenaForAllocation());
 #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
 ::memset(reinterpret_cast<char*>(this) + static_cast<size_t>(
     reinterpret_cast<char*>(&filters_) - reinterpret_cast<char*>(this)),
-    0, static_cast<size_t>(reinterpret_cast<char*>(&time_created_) -
-    reinterpret_cast<char*>(&filters_)) + sizeof(time_created_));
+    0, static_cast<size_t>(reinterpret_cast<char*>(&block_size_) -
+    reinterpret_cast<char*>(&filters_)) + sizeof(block_size_));
 }
 
-State_file::~State_file() {
-  // @@protoc_insertion_point(destructor:proto.State_file)
+Content_file::~Content_file() {
+  // @@protoc_insertion_point(destructor:proto.Content_file)
   if (auto *arena = _internal_metadata_.DeleteReturnArena<std::string>()) {
   (void)arena;
     return;
@@ -2299,22 +3932,24 @@ State_file::~State_file() {
   SharedDtor();
 }
 
-inline void State_file::SharedDtor() {
+inline void Content_file::SharedDtor() {
   GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
   name_.Destroy();
   if (this != internal_default_instance()) delete filters_;
 }
 
-void State_file::SetCachedSize(int size) const {
+void Content_file::SetCachedSize(int size) const {
   _cached_size_.Set(size);
 }
 
-void State_file::Clear() {
-// @@protoc_insertion_point(message_clear_start:proto.State_file)
+void Content_file::Clear() {
+// @@protoc_insertion_point(message_clear_start:proto.Content_file)
   uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
+  refs_.Clear();
+  block_xxhash_.Clear();
   cached_has_bits = _has_bits_[0];
   if (cached_has_bits & 0x00000003u) {
     if (cached_has_bits & 0x00000001u) {
@@ -2325,12 +3960,16 @@ void State_file::Clear() {
       filters_->Clear();
     }
   }
-  time_created_ = uint64_t{0u};
+  if (cached_has_bits & 0x0000000cu) {
+    ::memset(&size_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&block_size_) -
+        reinterpret_cast<char*>(&size_)) + sizeof(block_size_));
+  }
   _has_bits_.Clear();
   _internal_metadata_.Clear<std::string>();
 }
 
-const char* State_file::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+const char* Content_file::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
 #define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
   _Internal::HasBits has_bits{};
   while (!ctx->Done(&ptr)) {
@@ -2354,15 +3993,48 @@ const char* State_file::_InternalParse(const char* ptr, ::_pbi::ParseContext* ct
         } else
           goto handle_unusual;
         continue;
-      // required uint64 time_created = 3;
+      // repeated .proto.Ref_count refs = 3;
       case 3:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
-          _Internal::set_has_time_created(&has_bits);
-          time_created_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_refs(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<26>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      // optional uint64 size = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          _Internal::set_has_size(&has_bits);
+          size_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional uint64 block_size = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 40)) {
+          _Internal::set_has_block_size(&has_bits);
+          block_size_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
           CHK_(ptr);
         } else
           goto handle_unusual;
         continue;
+      // repeated fixed64 block_xxhash = 6 [packed = true];
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 50)) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedFixed64Parser(_internal_mutable_block_xxhash(), ptr, ctx);
+          CHK_(ptr);
+        } else if (static_cast<uint8_t>(tag) == 49) {
+          _internal_add_block_xxhash(::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<uint64_t>(ptr));
+          ptr += sizeof(uint64_t);
+        } else
+          goto handle_unusual;
+        continue;
       default:
         goto handle_unusual;
     }  // switch
@@ -2387,9 +4059,9 @@ failure:
 #undef CHK_
 }
 
-uint8_t* State_file::_InternalSerialize(
+uint8_t* Content_file::_InternalSerialize(
     uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
-  // @@protoc_insertion_point(serialize_to_array_start:proto.State_file)
+  // @@protoc_insertion_point(serialize_to_array_start:proto.Content_file)
   uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
@@ -2407,66 +4079,91 @@ uint8_t* State_file::_InternalSerialize(
         2, this->_internal_name(), target);
   }
 
-  // required uint64 time_created = 3;
+  // repeated .proto.Ref_count refs = 3;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_refs_size()); i < n; i++) {
+    const auto& repfield = this->_internal_refs(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(3, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  // optional uint64 size = 4;
   if (cached_has_bits & 0x00000004u) {
     target = stream->EnsureSpace(target);
-    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(3, this->_internal_time_created(), target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(4, this->_internal_size(), target);
+  }
+
+  // optional uint64 block_size = 5;
+  if (cached_has_bits & 0x00000008u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(5, this->_internal_block_size(), target);
+  }
+
+  // repeated fixed64 block_xxhash = 6 [packed = true];
+  if (this->_internal_block_xxhash_size() > 0) {
+    target = stream->WriteFixedPacked(6, _internal_block_xxhash(), target);
   }
 
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
     target = stream->WriteRaw(_internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString).data(),
         static_cast<int>(_internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString).size()), target);
   }
-  // @@protoc_insertion_point(serialize_to_array_end:proto.State_file)
+  // @@protoc_insertion_point(serialize_to_array_end:proto.Content_file)
   return target;
 }
 
-size_t State_file::RequiredFieldsByteSizeFallback() const {
-// @@protoc_insertion_point(required_fields_byte_size_fallback_start:proto.State_file)
+size_t Content_file::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:proto.Content_file)
   size_t total_size = 0;
 
+  // required string name = 2;
   if (_internal_has_name()) {
-    // required string name = 2;
     total_size += 1 +
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
         this->_internal_name());
   }
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
 
-  if (_internal_has_time_created()) {
-    // required uint64 time_created = 3;
-    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_time_created());
+  // repeated .proto.Ref_count refs = 3;
+  total_size += 1UL * this->_internal_refs_size();
+  for (const auto& msg : this->refs_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
   }
 
-  return total_size;
-}
-size_t State_file::ByteSizeLong() const {
-// @@protoc_insertion_point(message_byte_size_start:proto.State_file)
-  size_t total_size = 0;
-
-  if (((_has_bits_[0] & 0x00000005) ^ 0x00000005) == 0) {  // All required fields are present.
-    // required string name = 2;
-    total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
-        this->_internal_name());
-
-    // required uint64 time_created = 3;
-    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_time_created());
-
-  } else {
-    total_size += RequiredFieldsByteSizeFallback();
+  // repeated fixed64 block_xxhash = 6 [packed = true];
+  {
+    unsigned int count = static_cast<unsigned int>(this->_internal_block_xxhash_size());
+    size_t data_size = 8UL * count;
+    if (data_size > 0) {
+      total_size += 1 +
+        ::_pbi::WireFormatLite::Int32Size(static_cast<int32_t>(data_size));
+    }
+    total_size += data_size;
   }
-  uint32_t cached_has_bits = 0;
-  // Prevent compiler warnings about cached_has_bits being unused
-  (void) cached_has_bits;
 
-  // optional .proto.Filters filters = 1;
   cached_has_bits = _has_bits_[0];
-  if (cached_has_bits & 0x00000002u) {
-    total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
-        *filters_);
-  }
+  if (cached_has_bits & 0x0000000eu) {
+    // optional .proto.Filters filters = 1;
+    if (cached_has_bits & 0x00000002u) {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *filters_);
+    }
+
+    // optional uint64 size = 4;
+    if (cached_has_bits & 0x00000004u) {
+      total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_size());
+    }
 
+    // optional uint64 block_size = 5;
+    if (cached_has_bits & 0x00000008u) {
+      total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_block_size());
+    }
+
+  }
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
     total_size += _internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString).size();
   }
@@ -2475,20 +4172,22 @@ size_t State_file::ByteSizeLong() const {
   return total_size;
 }
 
-void State_file::CheckTypeAndMergeFrom(
+void Content_file::CheckTypeAndMergeFrom(
     const ::PROTOBUF_NAMESPACE_ID::MessageLite& from) {
-  MergeFrom(*::_pbi::DownCast<const State_file*>(
+  MergeFrom(*::_pbi::DownCast<const Content_file*>(
       &from));
 }
 
-void State_file::MergeFrom(const State_file& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:proto.State_file)
+void Content_file::MergeFrom(const Content_file& from) {
+// @@protoc_insertion_point(class_specific_merge_from_start:proto.Content_file)
   GOOGLE_DCHECK_NE(&from, this);
   uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
+  refs_.MergeFrom(from.refs_);
+  block_xxhash_.MergeFrom(from.block_xxhash_);
   cached_has_bits = from._has_bits_[0];
-  if (cached_has_bits & 0x00000007u) {
+  if (cached_has_bits & 0x0000000fu) {
     if (cached_has_bits & 0x00000001u) {
       _internal_set_name(from._internal_name());
     }
@@ -2496,110 +4195,149 @@ void State_file::MergeFrom(const State_file& from) {
       _internal_mutable_filters()->::proto::Filters::MergeFrom(from._internal_filters());
     }
     if (cached_has_bits & 0x00000004u) {
-      time_created_ = from.time_created_;
+      size_ = from.size_;
+    }
+    if (cached_has_bits & 0x00000008u) {
+      block_size_ = from.block_size_;
     }
     _has_bits_[0] |= cached_has_bits;
   }
   _internal_metadata_.MergeFrom<std::string>(from._internal_metadata_);
 }
 
-void State_file::CopyFrom(const State_file& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:proto.State_file)
+void Content_file::CopyFrom(const Content_file& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:proto.Content_file)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-bool State_file::IsInitialized() const {
+bool Content_file::IsInitialized() const {
   if (_Internal::MissingRequiredFields(_has_bits_)) return false;
+  if (!::PROTOBUF_NAMESPACE_ID::internal::AllAreInitialized(refs_))
+    return false;
   if (_internal_has_filters()) {
     if (!filters_->IsInitialized()) return false;
   }
   return true;
 }
 
-void State_file::InternalSwap(State_file* other) {
+void Content_file::InternalSwap(Content_file* other) {
   using std::swap;
   auto* lhs_arena = GetArenaForAllocation();
   auto* rhs_arena = other->GetArenaForAllocation();
   _internal_metadata_.InternalSwap(&other->_internal_metadata_);
   swap(_has_bits_[0], other->_has_bits_[0]);
+  refs_.InternalSwap(&other->refs_);
+  block_xxhash_.InternalSwap(&other->block_xxhash_);
   ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
       &name_, lhs_arena,
       &other->name_, rhs_arena
   );
   ::PROTOBUF_NAMESPACE_ID::internal::memswap<
-      PROTOBUF_FIELD_OFFSET(State_file, time_created_)
-      + sizeof(State_file::time_created_)
-      - PROTOBUF_FIELD_OFFSET(State_file, filters_)>(
+      PROTOBUF_FIELD_OFFSET(Content_file, block_size_)
+      + sizeof(Content_file::block_size_)
+      - PROTOBUF_FIELD_OFFSET(Content_file, filters_)>(
           reinterpret_cast<char*>(&filters_),
           reinterpret_cast<char*>(&other->filters_));
 }
 
-std::string State_file::GetTypeName() const {
-  return "proto.State_file";
+std::string Content_file::GetTypeName() const {
+  return "proto.Content_file";
 }
 
 
 // ===================================================================
 
-class Content_file::_Internal {
+class Ref_count::_Internal {
  public:
-  using HasBits = decltype(std::declval<Content_file>()._has_bits_);
-  static const ::proto::Filters& filters(const Content_file* msg);
-  static void set_has_filters(HasBits* has_bits) {
+  using HasBits = decltype(std::declval<Ref_count>()._has_bits_);
+  static void set_has_from(HasBits* has_bits) {
     (*has_bits)[0] |= 2u;
   }
-  static void set_has_name(HasBits* has_bits) {
+  static void set_has_to(HasBits* has_bits) {
+    (*has_bits)[0] |= 4u;
+  }
+  static void set_has_ref_count(HasBits* has_bits) {
+    (*has_bits)[0] |= 8u;
+  }
+  static void set_has_space_taken(HasBits* has_bits) {
+    (*has_bits)[0] |= 16u;
+  }
+  static void set_has_seek_offset(HasBits* has_bits) {
+    (*has_bits)[0] |= 32u;
+  }
+  static void set_has_seek_from(HasBits* has_bits) {
+    (*has_bits)[0] |= 64u;
+  }
+  static void set_has_content_id(HasBits* has_bits) {
     (*has_bits)[0] |= 1u;
   }
   static bool MissingRequiredFields(const HasBits& has_bits) {
-    return ((has_bits[0] & 0x00000001) ^ 0x00000001) != 0;
+    return ((has_bits[0] & 0x0000001e) ^ 0x0000001e) != 0;
   }
 };
 
-const ::proto::Filters&
-Content_file::_Internal::filters(const Content_file* msg) {
-  return *msg->filters_;
-}
-Content_file::Content_file(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+Ref_count::Ref_count(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                          bool is_message_owned)
-  : ::PROTOBUF_NAMESPACE_ID::MessageLite(arena, is_message_owned),
-  refs_(arena) {
+  : ::PROTOBUF_NAMESPACE_ID::MessageLite(arena, is_message_owned) {
   SharedCtor();
-  // @@protoc_insertion_point(arena_constructor:proto.Content_file)
+  // @@protoc_insertion_point(arena_constructor:proto.Ref_count)
 }
-Content_file::Content_file(const Content_file& from)
+Ref_count::Ref_count(const Ref_count& from)
   : ::PROTOBUF_NAMESPACE_ID::MessageLite(),
-      _has_bits_(from._has_bits_),
-      refs_(from.refs_) {
+      _has_bits_(from._has_bits_) {
   _internal_metadata_.MergeFrom<std::string>(from._internal_metadata_);
-  name_.InitDefault();
+  content_id_.InitDefault();
   #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-    name_.Set("", GetArenaForAllocation());
+    content_id_.Set("", GetArenaForAllocation());
   #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (from._internal_has_name()) {
-    name_.Set(from._internal_name(), 
+  if (from._internal_has_content_id()) {
+    content_id_.Set(from._internal_content_id(), 
       GetArenaForAllocation());
   }
-  if (from._internal_has_filters()) {
-    filters_ = new ::proto::Filters(*from.filters_);
-  } else {
-    filters_ = nullptr;
+  ::memcpy(&from_, &from.from_,
+    static_cast<size_t>(reinterpret_cast<char*>(&seek_from_) -
+    reinterpret_cast<char*>(&from_)) + sizeof(seek_from_));
+  clear_has_csum();
+  switch (from.csum_case()) {
+    case kXxhash: {
+      _internal_set_xxhash(from._internal_xxhash());
+      break;
+    }
+    case kBlake2B: {
+      _internal_set_blake2b(from._internal_blake2b());
+      break;
+    }
+    case kXxh3128: {
+      _internal_set_xxh3_128(from._internal_xxh3_128());
+      break;
+    }
+    case kBlake3: {
+      _internal_set_blake3(from._internal_blake3());
+      break;
+    }
+    case CSUM_NOT_SET: {
+      break;
+    }
   }
-  // @@protoc_insertion_point(copy_constructor:proto.Content_file)
+  // @@protoc_insertion_point(copy_constructor:proto.Ref_count)
 }
 
-inline void Content_file::SharedCtor() {
-name_.InitDefault();
+inline void Ref_count::SharedCtor() {
+content_id_.InitDefault();
 #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  name_.Set("", GetArenaForAllocation());
+  content_id_.Set("", GetArenaForAllocation());
 #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-filters_ = nullptr;
+::memset(reinterpret_cast<char*>(this) + static_cast<size_t>(
+    reinterpret_cast<char*>(&from_) - reinterpret_cast<char*>(this)),
+    0, static_cast<size_t>(reinterpret_cast<char*>(&seek_from_) -
+    reinterpret_cast<char*>(&from_)) + sizeof(seek_from_));
+clear_has_csum();
 }
 
-Content_file::~Content_file() {
-  // @@protoc_insertion_point(destructor:proto.Content_file)
+Ref_count::~Ref_count() {
+  // @@protoc_insertion_point(destructor:proto.Ref_count)
   if (auto *arena = _internal_metadata_.DeleteReturnArena<std::string>()) {
   (void)arena;
     return;
@@ -2607,71 +4345,167 @@ Content_file::~Content_file() {
   SharedDtor();
 }
 
-inline void Content_file::SharedDtor() {
+inline void Ref_count::SharedDtor() {
   GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
-  name_.Destroy();
-  if (this != internal_default_instance()) delete filters_;
+  content_id_.Destroy();
+  if (has_csum()) {
+    clear_csum();
+  }
 }
 
-void Content_file::SetCachedSize(int size) const {
+void Ref_count::SetCachedSize(int size) const {
   _cached_size_.Set(size);
 }
 
-void Content_file::Clear() {
-// @@protoc_insertion_point(message_clear_start:proto.Content_file)
+void Ref_count::clear_csum() {
+// @@protoc_insertion_point(one_of_clear_start:proto.Ref_count)
+  switch (csum_case()) {
+    case kXxhash: {
+      // No need to clear
+      break;
+    }
+    case kBlake2B: {
+      csum_.blake2b_.Destroy();
+      break;
+    }
+    case kXxh3128: {
+      csum_.xxh3_128_.Destroy();
+      break;
+    }
+    case kBlake3: {
+      csum_.blake3_.Destroy();
+      break;
+    }
+    case CSUM_NOT_SET: {
+      break;
+    }
+  }
+  _oneof_case_[0] = CSUM_NOT_SET;
+}
+
+
+void Ref_count::Clear() {
+// @@protoc_insertion_point(message_clear_start:proto.Ref_count)
   uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  refs_.Clear();
   cached_has_bits = _has_bits_[0];
-  if (cached_has_bits & 0x00000003u) {
-    if (cached_has_bits & 0x00000001u) {
-      name_.ClearNonDefaultToEmpty();
-    }
-    if (cached_has_bits & 0x00000002u) {
-      GOOGLE_DCHECK(filters_ != nullptr);
-      filters_->Clear();
-    }
+  if (cached_has_bits & 0x00000001u) {
+    content_id_.ClearNonDefaultToEmpty();
+  }
+  if (cached_has_bits & 0x0000007eu) {
+    ::memset(&from_, 0, static_cast<size_t>(
+        reinterpret_cast<char*>(&seek_from_) -
+        reinterpret_cast<char*>(&from_)) + sizeof(seek_from_));
   }
+  clear_csum();
   _has_bits_.Clear();
   _internal_metadata_.Clear<std::string>();
 }
 
-const char* Content_file::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+const char* Ref_count::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
 #define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
   _Internal::HasBits has_bits{};
   while (!ctx->Done(&ptr)) {
     uint32_t tag;
     ptr = ::_pbi::ReadTag(ptr, &tag);
     switch (tag >> 3) {
-      // optional .proto.Filters filters = 1;
+      // required uint64 from = 1;
       case 1:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
-          ptr = ctx->ParseMessage(_internal_mutable_filters(), ptr);
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _Internal::set_has_from(&has_bits);
+          from_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
           CHK_(ptr);
         } else
           goto handle_unusual;
         continue;
-      // required string name = 2;
+      // required uint64 to = 2;
       case 2:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
-          auto str = _internal_mutable_name();
-          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _Internal::set_has_to(&has_bits);
+          to_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
           CHK_(ptr);
         } else
           goto handle_unusual;
         continue;
-      // repeated .proto.Ref_count refs = 3;
+      // required uint64 ref_count = 3;
       case 3:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
-          ptr -= 1;
-          do {
-            ptr += 1;
-            ptr = ctx->ParseMessage(_internal_add_refs(), ptr);
-            CHK_(ptr);
-            if (!ctx->DataAvailable(ptr)) break;
-          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<26>(ptr));
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _Internal::set_has_ref_count(&has_bits);
+          ref_count_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // required uint64 space_taken = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          _Internal::set_has_space_taken(&has_bits);
+          space_taken_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 xxhash = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 40)) {
+          _internal_set_xxhash(::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr));
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // bytes blake2b = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 50)) {
+          auto str = _internal_mutable_blake2b();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional uint64 seek_offset = 7;
+      case 7:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 56)) {
+          _Internal::set_has_seek_offset(&has_bits);
+          seek_offset_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional uint64 seek_from = 8;
+      case 8:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 64)) {
+          _Internal::set_has_seek_from(&has_bits);
+          seek_from_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // bytes xxh3_128 = 9;
+      case 9:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 74)) {
+          auto str = _internal_mutable_xxh3_128();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // bytes blake3 = 10;
+      case 10:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 82)) {
+          auto str = _internal_mutable_blake3();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // optional bytes content_id = 11;
+      case 11:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 90)) {
+          auto str = _internal_mutable_content_id();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
         } else
           goto handle_unusual;
         continue;
@@ -2699,71 +4533,190 @@ failure:
 #undef CHK_
 }
 
-uint8_t* Content_file::_InternalSerialize(
+uint8_t* Ref_count::_InternalSerialize(
     uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
-  // @@protoc_insertion_point(serialize_to_array_start:proto.Content_file)
+  // @@protoc_insertion_point(serialize_to_array_start:proto.Ref_count)
   uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
   cached_has_bits = _has_bits_[0];
-  // optional .proto.Filters filters = 1;
+  // required uint64 from = 1;
   if (cached_has_bits & 0x00000002u) {
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
-      InternalWriteMessage(1, _Internal::filters(this),
-        _Internal::filters(this).GetCachedSize(), target, stream);
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(1, this->_internal_from(), target);
   }
 
-  // required string name = 2;
-  if (cached_has_bits & 0x00000001u) {
-    target = stream->WriteStringMaybeAliased(
-        2, this->_internal_name(), target);
+  // required uint64 to = 2;
+  if (cached_has_bits & 0x00000004u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(2, this->_internal_to(), target);
   }
 
-  // repeated .proto.Ref_count refs = 3;
-  for (unsigned i = 0,
-      n = static_cast<unsigned>(this->_internal_refs_size()); i < n; i++) {
-    const auto& repfield = this->_internal_refs(i);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
-        InternalWriteMessage(3, repfield, repfield.GetCachedSize(), target, stream);
+  // required uint64 ref_count = 3;
+  if (cached_has_bits & 0x00000008u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(3, this->_internal_ref_count(), target);
+  }
+
+  // required uint64 space_taken = 4;
+  if (cached_has_bits & 0x00000010u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(4, this->_internal_space_taken(), target);
+  }
+
+  switch (csum_case()) {
+    case kXxhash: {
+      target = stream->EnsureSpace(target);
+      target = ::_pbi::WireFormatLite::WriteUInt64ToArray(5, this->_internal_xxhash(), target);
+      break;
+    }
+    case kBlake2B: {
+      target = stream->WriteBytesMaybeAliased(
+          6, this->_internal_blake2b(), target);
+      break;
+    }
+    default: ;
+  }
+  // optional uint64 seek_offset = 7;
+  if (cached_has_bits & 0x00000020u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(7, this->_internal_seek_offset(), target);
+  }
+
+  // optional uint64 seek_from = 8;
+  if (cached_has_bits & 0x00000040u) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(8, this->_internal_seek_from(), target);
+  }
+
+  switch (csum_case()) {
+    case kXxh3128: {
+      target = stream->WriteBytesMaybeAliased(
+          9, this->_internal_xxh3_128(), target);
+      break;
+    }
+    case kBlake3: {
+      target = stream->WriteBytesMaybeAliased(
+          10, this->_internal_blake3(), target);
+      break;
+    }
+    default: ;
+  }
+  // optional bytes content_id = 11;
+  if (cached_has_bits & 0x00000001u) {
+    target = stream->WriteBytesMaybeAliased(
+        11, this->_internal_content_id(), target);
   }
 
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
     target = stream->WriteRaw(_internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString).data(),
         static_cast<int>(_internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString).size()), target);
   }
-  // @@protoc_insertion_point(serialize_to_array_end:proto.Content_file)
+  // @@protoc_insertion_point(serialize_to_array_end:proto.Ref_count)
   return target;
 }
 
-size_t Content_file::ByteSizeLong() const {
-// @@protoc_insertion_point(message_byte_size_start:proto.Content_file)
+size_t Ref_count::RequiredFieldsByteSizeFallback() const {
+// @@protoc_insertion_point(required_fields_byte_size_fallback_start:proto.Ref_count)
   size_t total_size = 0;
 
-  // required string name = 2;
-  if (_internal_has_name()) {
-    total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
-        this->_internal_name());
+  if (_internal_has_from()) {
+    // required uint64 from = 1;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_from());
+  }
+
+  if (_internal_has_to()) {
+    // required uint64 to = 2;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_to());
+  }
+
+  if (_internal_has_ref_count()) {
+    // required uint64 ref_count = 3;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_ref_count());
+  }
+
+  if (_internal_has_space_taken()) {
+    // required uint64 space_taken = 4;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_space_taken());
+  }
+
+  return total_size;
+}
+size_t Ref_count::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:proto.Ref_count)
+  size_t total_size = 0;
+
+  if (((_has_bits_[0] & 0x0000001e) ^ 0x0000001e) == 0) {  // All required fields are present.
+    // required uint64 from = 1;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_from());
+
+    // required uint64 to = 2;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_to());
+
+    // required uint64 ref_count = 3;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_ref_count());
+
+    // required uint64 space_taken = 4;
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_space_taken());
+
+  } else {
+    total_size += RequiredFieldsByteSizeFallback();
   }
   uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  // repeated .proto.Ref_count refs = 3;
-  total_size += 1UL * this->_internal_refs_size();
-  for (const auto& msg : this->refs_) {
-    total_size +=
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
-  }
-
-  // optional .proto.Filters filters = 1;
+  // optional bytes content_id = 11;
   cached_has_bits = _has_bits_[0];
-  if (cached_has_bits & 0x00000002u) {
+  if (cached_has_bits & 0x00000001u) {
     total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
-        *filters_);
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->_internal_content_id());
   }
 
+  if (cached_has_bits & 0x00000060u) {
+    // optional uint64 seek_offset = 7;
+    if (cached_has_bits & 0x00000020u) {
+      total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_seek_offset());
+    }
+
+    // optional uint64 seek_from = 8;
+    if (cached_has_bits & 0x00000040u) {
+      total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_seek_from());
+    }
+
+  }
+  switch (csum_case()) {
+    // uint64 xxhash = 5;
+    case kXxhash: {
+      total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_xxhash());
+      break;
+    }
+    // bytes blake2b = 6;
+    case kBlake2B: {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+          this->_internal_blake2b());
+      break;
+    }
+    // bytes xxh3_128 = 9;
+    case kXxh3128: {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+          this->_internal_xxh3_128());
+      break;
+    }
+    // bytes blake3 = 10;
+    case kBlake3: {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+          this->_internal_blake3());
+      break;
+    }
+    case CSUM_NOT_SET: {
+      break;
+    }
+  }
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
     total_size += _internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString).size();
   }
@@ -2772,129 +4725,152 @@ size_t Content_file::ByteSizeLong() const {
   return total_size;
 }
 
-void Content_file::CheckTypeAndMergeFrom(
+void Ref_count::CheckTypeAndMergeFrom(
     const ::PROTOBUF_NAMESPACE_ID::MessageLite& from) {
-  MergeFrom(*::_pbi::DownCast<const Content_file*>(
+  MergeFrom(*::_pbi::DownCast<const Ref_count*>(
       &from));
 }
 
-void Content_file::MergeFrom(const Content_file& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:proto.Content_file)
+void Ref_count::MergeFrom(const Ref_count& from) {
+// @@protoc_insertion_point(class_specific_merge_from_start:proto.Ref_count)
   GOOGLE_DCHECK_NE(&from, this);
   uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  refs_.MergeFrom(from.refs_);
   cached_has_bits = from._has_bits_[0];
-  if (cached_has_bits & 0x00000003u) {
+  if (cached_has_bits & 0x0000007fu) {
     if (cached_has_bits & 0x00000001u) {
-      _internal_set_name(from._internal_name());
+      _internal_set_content_id(from._internal_content_id());
     }
     if (cached_has_bits & 0x00000002u) {
-      _internal_mutable_filters()->::proto::Filters::MergeFrom(from._internal_filters());
+      from_ = from.from_;
+    }
+    if (cached_has_bits & 0x00000004u) {
+      to_ = from.to_;
+    }
+    if (cached_has_bits & 0x00000008u) {
+      ref_count_ = from.ref_count_;
+    }
+    if (cached_has_bits & 0x00000010u) {
+      space_taken_ = from.space_taken_;
+    }
+    if (cached_has_bits & 0x00000020u) {
+      seek_offset_ = from.seek_offset_;
+    }
+    if (cached_has_bits & 0x00000040u) {
+      seek_from_ = from.seek_from_;
+    }
+    _has_bits_[0] |= cached_has_bits;
+  }
+  switch (from.csum_case()) {
+    case kXxhash: {
+      _internal_set_xxhash(from._internal_xxhash());
+      break;
+    }
+    case kBlake2B: {
+      _internal_set_blake2b(from._internal_blake2b());
+      break;
+    }
+    case kXxh3128: {
+      _internal_set_xxh3_128(from._internal_xxh3_128());
+      break;
+    }
+    case kBlake3: {
+      _internal_set_blake3(from._internal_blake3());
+      break;
+    }
+    case CSUM_NOT_SET: {
+      break;
     }
   }
   _internal_metadata_.MergeFrom<std::string>(from._internal_metadata_);
 }
 
-void Content_file::CopyFrom(const Content_file& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:proto.Content_file)
+void Ref_count::CopyFrom(const Ref_count& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:proto.Ref_count)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-bool Content_file::IsInitialized() const {
+bool Ref_count::IsInitialized() const {
   if (_Internal::MissingRequiredFields(_has_bits_)) return false;
-  if (!::PROTOBUF_NAMESPACE_ID::internal::AllAreInitialized(refs_))
-    return false;
-  if (_internal_has_filters()) {
-    if (!filters_->IsInitialized()) return false;
-  }
   return true;
 }
 
-void Content_file::InternalSwap(Content_file* other) {
+void Ref_count::InternalSwap(Ref_count* other) {
   using std::swap;
   auto* lhs_arena = GetArenaForAllocation();
   auto* rhs_arena = other->GetArenaForAllocation();
   _internal_metadata_.InternalSwap(&other->_internal_metadata_);
   swap(_has_bits_[0], other->_has_bits_[0]);
-  refs_.InternalSwap(&other->refs_);
   ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
-      &name_, lhs_arena,
-      &other->name_, rhs_arena
+      &content_id_, lhs_arena,
+      &other->content_id_, rhs_arena
   );
-  swap(filters_, other->filters_);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(Ref_count, seek_from_)
+      + sizeof(Ref_count::seek_from_)
+      - PROTOBUF_FIELD_OFFSET(Ref_count, from_)>(
+          reinterpret_cast<char*>(&from_),
+          reinterpret_cast<char*>(&other->from_));
+  swap(csum_, other->csum_);
+  swap(_oneof_case_[0], other->_oneof_case_[0]);
 }
 
-std::string Content_file::GetTypeName() const {
-  return "proto.Content_file";
+std::string Ref_count::GetTypeName() const {
+  return "proto.Ref_count";
 }
 
 
 // ===================================================================
 
-class Ref_count::_Internal {
+class Zstd_dictionary::_Internal {
  public:
-  using HasBits = decltype(std::declval<Ref_count>()._has_bits_);
-  static void set_has_from(HasBits* has_bits) {
-    (*has_bits)[0] |= 1u;
-  }
-  static void set_has_to(HasBits* has_bits) {
+  using HasBits = decltype(std::declval<Zstd_dictionary>()._has_bits_);
+  static void set_has_id(HasBits* has_bits) {
     (*has_bits)[0] |= 2u;
   }
-  static void set_has_ref_count(HasBits* has_bits) {
-    (*has_bits)[0] |= 4u;
-  }
-  static void set_has_space_taken(HasBits* has_bits) {
-    (*has_bits)[0] |= 8u;
+  static void set_has_data(HasBits* has_bits) {
+    (*has_bits)[0] |= 1u;
   }
   static bool MissingRequiredFields(const HasBits& has_bits) {
-    return ((has_bits[0] & 0x0000000f) ^ 0x0000000f) != 0;
+    return ((has_bits[0] & 0x00000003) ^ 0x00000003) != 0;
   }
 };
 
-Ref_count::Ref_count(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+Zstd_dictionary::Zstd_dictionary(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                          bool is_message_owned)
   : ::PROTOBUF_NAMESPACE_ID::MessageLite(arena, is_message_owned) {
   SharedCtor();
-  // @@protoc_insertion_point(arena_constructor:proto.Ref_count)
+  // @@protoc_insertion_point(arena_constructor:proto.Zstd_dictionary)
 }
-Ref_count::Ref_count(const Ref_count& from)
+Zstd_dictionary::Zstd_dictionary(const Zstd_dictionary& from)
   : ::PROTOBUF_NAMESPACE_ID::MessageLite(),
       _has_bits_(from._has_bits_) {
   _internal_metadata_.MergeFrom<std::string>(from._internal_metadata_);
-  ::memcpy(&from_, &from.from_,
-    static_cast<size_t>(reinterpret_cast<char*>(&space_taken_) -
-    reinterpret_cast<char*>(&from_)) + sizeof(space_taken_));
-  clear_has_csum();
-  switch (from.csum_case()) {
-    case kXxhash: {
-      _internal_set_xxhash(from._internal_xxhash());
-      break;
-    }
-    case kBlake2B: {
-      _internal_set_blake2b(from._internal_blake2b());
-      break;
-    }
-    case CSUM_NOT_SET: {
-      break;
-    }
+  data_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    data_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (from._internal_has_data()) {
+    data_.Set(from._internal_data(), 
+      GetArenaForAllocation());
   }
-  // @@protoc_insertion_point(copy_constructor:proto.Ref_count)
+  id_ = from.id_;
+  // @@protoc_insertion_point(copy_constructor:proto.Zstd_dictionary)
 }
 
-inline void Ref_count::SharedCtor() {
-::memset(reinterpret_cast<char*>(this) + static_cast<size_t>(
-    reinterpret_cast<char*>(&from_) - reinterpret_cast<char*>(this)),
-    0, static_cast<size_t>(reinterpret_cast<char*>(&space_taken_) -
-    reinterpret_cast<char*>(&from_)) + sizeof(space_taken_));
-clear_has_csum();
+inline void Zstd_dictionary::SharedCtor() {
+data_.InitDefault();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  data_.Set("", GetArenaForAllocation());
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+id_ = 0u;
 }
 
-Ref_count::~Ref_count() {
-  // @@protoc_insertion_point(destructor:proto.Ref_count)
+Zstd_dictionary::~Zstd_dictionary() {
+  // @@protoc_insertion_point(destructor:proto.Zstd_dictionary)
   if (auto *arena = _internal_metadata_.DeleteReturnArena<std::string>()) {
   (void)arena;
     return;
@@ -2902,108 +4878,50 @@ Ref_count::~Ref_count() {
   SharedDtor();
 }
 
-inline void Ref_count::SharedDtor() {
+inline void Zstd_dictionary::SharedDtor() {
   GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
-  if (has_csum()) {
-    clear_csum();
-  }
+  data_.Destroy();
 }
 
-void Ref_count::SetCachedSize(int size) const {
+void Zstd_dictionary::SetCachedSize(int size) const {
   _cached_size_.Set(size);
 }
 
-void Ref_count::clear_csum() {
-// @@protoc_insertion_point(one_of_clear_start:proto.Ref_count)
-  switch (csum_case()) {
-    case kXxhash: {
-      // No need to clear
-      break;
-    }
-    case kBlake2B: {
-      csum_.blake2b_.Destroy();
-      break;
-    }
-    case CSUM_NOT_SET: {
-      break;
-    }
-  }
-  _oneof_case_[0] = CSUM_NOT_SET;
-}
-
-
-void Ref_count::Clear() {
-// @@protoc_insertion_point(message_clear_start:proto.Ref_count)
+void Zstd_dictionary::Clear() {
+// @@protoc_insertion_point(message_clear_start:proto.Zstd_dictionary)
   uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
   cached_has_bits = _has_bits_[0];
-  if (cached_has_bits & 0x0000000fu) {
-    ::memset(&from_, 0, static_cast<size_t>(
-        reinterpret_cast<char*>(&space_taken_) -
-        reinterpret_cast<char*>(&from_)) + sizeof(space_taken_));
+  if (cached_has_bits & 0x00000001u) {
+    data_.ClearNonDefaultToEmpty();
   }
-  clear_csum();
+  id_ = 0u;
   _has_bits_.Clear();
   _internal_metadata_.Clear<std::string>();
 }
 
-const char* Ref_count::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+const char* Zstd_dictionary::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
 #define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
   _Internal::HasBits has_bits{};
   while (!ctx->Done(&ptr)) {
     uint32_t tag;
     ptr = ::_pbi::ReadTag(ptr, &tag);
     switch (tag >> 3) {
-      // required uint64 from = 1;
+      // required uint32 id = 1;
       case 1:
         if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
-          _Internal::set_has_from(&has_bits);
-          from_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          _Internal::set_has_id(&has_bits);
+          id_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
           CHK_(ptr);
         } else
           goto handle_unusual;
         continue;
-      // required uint64 to = 2;
+      // required bytes data = 2;
       case 2:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
-          _Internal::set_has_to(&has_bits);
-          to_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
-          CHK_(ptr);
-        } else
-          goto handle_unusual;
-        continue;
-      // required uint64 ref_count = 3;
-      case 3:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
-          _Internal::set_has_ref_count(&has_bits);
-          ref_count_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
-          CHK_(ptr);
-        } else
-          goto handle_unusual;
-        continue;
-      // required uint64 space_taken = 4;
-      case 4:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
-          _Internal::set_has_space_taken(&has_bits);
-          space_taken_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
-          CHK_(ptr);
-        } else
-          goto handle_unusual;
-        continue;
-      // uint64 xxhash = 5;
-      case 5:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 40)) {
-          _internal_set_xxhash(::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr));
-          CHK_(ptr);
-        } else
-          goto handle_unusual;
-        continue;
-      // bytes blake2b = 6;
-      case 6:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 50)) {
-          auto str = _internal_mutable_blake2b();
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          auto str = _internal_mutable_data();
           ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
           CHK_(ptr);
         } else
@@ -3033,100 +4951,63 @@ failure:
 #undef CHK_
 }
 
-uint8_t* Ref_count::_InternalSerialize(
+uint8_t* Zstd_dictionary::_InternalSerialize(
     uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
-  // @@protoc_insertion_point(serialize_to_array_start:proto.Ref_count)
+  // @@protoc_insertion_point(serialize_to_array_start:proto.Zstd_dictionary)
   uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
   cached_has_bits = _has_bits_[0];
-  // required uint64 from = 1;
-  if (cached_has_bits & 0x00000001u) {
-    target = stream->EnsureSpace(target);
-    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(1, this->_internal_from(), target);
-  }
-
-  // required uint64 to = 2;
+  // required uint32 id = 1;
   if (cached_has_bits & 0x00000002u) {
     target = stream->EnsureSpace(target);
-    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(2, this->_internal_to(), target);
-  }
-
-  // required uint64 ref_count = 3;
-  if (cached_has_bits & 0x00000004u) {
-    target = stream->EnsureSpace(target);
-    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(3, this->_internal_ref_count(), target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(1, this->_internal_id(), target);
   }
 
-  // required uint64 space_taken = 4;
-  if (cached_has_bits & 0x00000008u) {
-    target = stream->EnsureSpace(target);
-    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(4, this->_internal_space_taken(), target);
+  // required bytes data = 2;
+  if (cached_has_bits & 0x00000001u) {
+    target = stream->WriteBytesMaybeAliased(
+        2, this->_internal_data(), target);
   }
 
-  switch (csum_case()) {
-    case kXxhash: {
-      target = stream->EnsureSpace(target);
-      target = ::_pbi::WireFormatLite::WriteUInt64ToArray(5, this->_internal_xxhash(), target);
-      break;
-    }
-    case kBlake2B: {
-      target = stream->WriteBytesMaybeAliased(
-          6, this->_internal_blake2b(), target);
-      break;
-    }
-    default: ;
-  }
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
     target = stream->WriteRaw(_internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString).data(),
         static_cast<int>(_internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString).size()), target);
   }
-  // @@protoc_insertion_point(serialize_to_array_end:proto.Ref_count)
+  // @@protoc_insertion_point(serialize_to_array_end:proto.Zstd_dictionary)
   return target;
 }
 
-size_t Ref_count::RequiredFieldsByteSizeFallback() const {
-// @@protoc_insertion_point(required_fields_byte_size_fallback_start:proto.Ref_count)
+size_t Zstd_dictionary::RequiredFieldsByteSizeFallback() const {
+// @@protoc_insertion_point(required_fields_byte_size_fallback_start:proto.Zstd_dictionary)
   size_t total_size = 0;
 
-  if (_internal_has_from()) {
-    // required uint64 from = 1;
-    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_from());
-  }
-
-  if (_internal_has_to()) {
-    // required uint64 to = 2;
-    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_to());
-  }
-
-  if (_internal_has_ref_count()) {
-    // required uint64 ref_count = 3;
-    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_ref_count());
+  if (_internal_has_data()) {
+    // required bytes data = 2;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->_internal_data());
   }
 
-  if (_internal_has_space_taken()) {
-    // required uint64 space_taken = 4;
-    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_space_taken());
+  if (_internal_has_id()) {
+    // required uint32 id = 1;
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_id());
   }
 
   return total_size;
 }
-size_t Ref_count::ByteSizeLong() const {
-// @@protoc_insertion_point(message_byte_size_start:proto.Ref_count)
+size_t Zstd_dictionary::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:proto.Zstd_dictionary)
   size_t total_size = 0;
 
-  if (((_has_bits_[0] & 0x0000000f) ^ 0x0000000f) == 0) {  // All required fields are present.
-    // required uint64 from = 1;
-    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_from());
-
-    // required uint64 to = 2;
-    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_to());
-
-    // required uint64 ref_count = 3;
-    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_ref_count());
+  if (((_has_bits_[0] & 0x00000003) ^ 0x00000003) == 0) {  // All required fields are present.
+    // required bytes data = 2;
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->_internal_data());
 
-    // required uint64 space_taken = 4;
-    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_space_taken());
+    // required uint32 id = 1;
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_id());
 
   } else {
     total_size += RequiredFieldsByteSizeFallback();
@@ -3135,23 +5016,6 @@ size_t Ref_count::ByteSizeLong() const {
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  switch (csum_case()) {
-    // uint64 xxhash = 5;
-    case kXxhash: {
-      total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_xxhash());
-      break;
-    }
-    // bytes blake2b = 6;
-    case kBlake2B: {
-      total_size += 1 +
-        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
-          this->_internal_blake2b());
-      break;
-    }
-    case CSUM_NOT_SET: {
-      break;
-    }
-  }
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
     total_size += _internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString).size();
   }
@@ -3160,78 +5024,58 @@ size_t Ref_count::ByteSizeLong() const {
   return total_size;
 }
 
-void Ref_count::CheckTypeAndMergeFrom(
+void Zstd_dictionary::CheckTypeAndMergeFrom(
     const ::PROTOBUF_NAMESPACE_ID::MessageLite& from) {
-  MergeFrom(*::_pbi::DownCast<const Ref_count*>(
+  MergeFrom(*::_pbi::DownCast<const Zstd_dictionary*>(
       &from));
 }
 
-void Ref_count::MergeFrom(const Ref_count& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:proto.Ref_count)
+void Zstd_dictionary::MergeFrom(const Zstd_dictionary& from) {
+// @@protoc_insertion_point(class_specific_merge_from_start:proto.Zstd_dictionary)
   GOOGLE_DCHECK_NE(&from, this);
   uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
   cached_has_bits = from._has_bits_[0];
-  if (cached_has_bits & 0x0000000fu) {
+  if (cached_has_bits & 0x00000003u) {
     if (cached_has_bits & 0x00000001u) {
-      from_ = from.from_;
+      _internal_set_data(from._internal_data());
     }
     if (cached_has_bits & 0x00000002u) {
-      to_ = from.to_;
-    }
-    if (cached_has_bits & 0x00000004u) {
-      ref_count_ = from.ref_count_;
-    }
-    if (cached_has_bits & 0x00000008u) {
-      space_taken_ = from.space_taken_;
+      id_ = from.id_;
     }
     _has_bits_[0] |= cached_has_bits;
   }
-  switch (from.csum_case()) {
-    case kXxhash: {
-      _internal_set_xxhash(from._internal_xxhash());
-      break;
-    }
-    case kBlake2B: {
-      _internal_set_blake2b(from._internal_blake2b());
-      break;
-    }
-    case CSUM_NOT_SET: {
-      break;
-    }
-  }
   _internal_metadata_.MergeFrom<std::string>(from._internal_metadata_);
 }
 
-void Ref_count::CopyFrom(const Ref_count& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:proto.Ref_count)
+void Zstd_dictionary::CopyFrom(const Zstd_dictionary& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:proto.Zstd_dictionary)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-bool Ref_count::IsInitialized() const {
+bool Zstd_dictionary::IsInitialized() const {
   if (_Internal::MissingRequiredFields(_has_bits_)) return false;
   return true;
 }
 
-void Ref_count::InternalSwap(Ref_count* other) {
+void Zstd_dictionary::InternalSwap(Zstd_dictionary* other) {
   using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
   _internal_metadata_.InternalSwap(&other->_internal_metadata_);
   swap(_has_bits_[0], other->_has_bits_[0]);
-  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
-      PROTOBUF_FIELD_OFFSET(Ref_count, space_taken_)
-      + sizeof(Ref_count::space_taken_)
-      - PROTOBUF_FIELD_OFFSET(Ref_count, from_)>(
-          reinterpret_cast<char*>(&from_),
-          reinterpret_cast<char*>(&other->from_));
-  swap(csum_, other->csum_);
-  swap(_oneof_case_[0], other->_oneof_case_[0]);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &data_, lhs_arena,
+      &other->data_, rhs_arena
+  );
+  swap(id_, other->id_);
 }
 
-std::string Ref_count::GetTypeName() const {
-  return "proto.Ref_count";
+std::string Zstd_dictionary::GetTypeName() const {
+  return "proto.Zstd_dictionary";
 }
 
 
@@ -3245,14 +5089,16 @@ Catalogue::Catalogue(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                          bool is_message_owned)
   : ::PROTOBUF_NAMESPACE_ID::MessageLite(arena, is_message_owned),
   state_files_(arena),
-  content_files_(arena) {
+  content_files_(arena),
+  dictionaries_(arena) {
   SharedCtor();
   // @@protoc_insertion_point(arena_constructor:proto.Catalogue)
 }
 Catalogue::Catalogue(const Catalogue& from)
   : ::PROTOBUF_NAMESPACE_ID::MessageLite(),
       state_files_(from.state_files_),
-      content_files_(from.content_files_) {
+      content_files_(from.content_files_),
+      dictionaries_(from.dictionaries_) {
   _internal_metadata_.MergeFrom<std::string>(from._internal_metadata_);
   // @@protoc_insertion_point(copy_constructor:proto.Catalogue)
 }
@@ -3285,6 +5131,7 @@ void Catalogue::Clear() {
 
   state_files_.Clear();
   content_files_.Clear();
+  dictionaries_.Clear();
   _internal_metadata_.Clear<std::string>();
 }
 
@@ -3320,6 +5167,19 @@ const char* Catalogue::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx
         } else
           goto handle_unusual;
         continue;
+      // repeated .proto.Zstd_dictionary dictionaries = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_dictionaries(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<26>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
       default:
         goto handle_unusual;
     }  // switch
@@ -3365,6 +5225,14 @@ uint8_t* Catalogue::_InternalSerialize(
         InternalWriteMessage(2, repfield, repfield.GetCachedSize(), target, stream);
   }
 
+  // repeated .proto.Zstd_dictionary dictionaries = 3;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_dictionaries_size()); i < n; i++) {
+    const auto& repfield = this->_internal_dictionaries(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(3, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
     target = stream->WriteRaw(_internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString).data(),
         static_cast<int>(_internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString).size()), target);
@@ -3395,6 +5263,13 @@ size_t Catalogue::ByteSizeLong() const {
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
   }
 
+  // repeated .proto.Zstd_dictionary dictionaries = 3;
+  total_size += 1UL * this->_internal_dictionaries_size();
+  for (const auto& msg : this->dictionaries_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
     total_size += _internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString).size();
   }
@@ -3417,6 +5292,7 @@ void Catalogue::MergeFrom(const Catalogue& from) {
 
   state_files_.MergeFrom(from.state_files_);
   content_files_.MergeFrom(from.content_files_);
+  dictionaries_.MergeFrom(from.dictionaries_);
   _internal_metadata_.MergeFrom<std::string>(from._internal_metadata_);
 }
 
@@ -3432,6 +5308,8 @@ bool Catalogue::IsInitialized() const {
     return false;
   if (!::PROTOBUF_NAMESPACE_ID::internal::AllAreInitialized(content_files_))
     return false;
+  if (!::PROTOBUF_NAMESPACE_ID::internal::AllAreInitialized(dictionaries_))
+    return false;
   return true;
 }
 
@@ -3440,6 +5318,7 @@ void Catalogue::InternalSwap(Catalogue* other) {
   _internal_metadata_.InternalSwap(&other->_internal_metadata_);
   state_files_.InternalSwap(&other->state_files_);
   content_files_.InternalSwap(&other->content_files_);
+  dictionaries_.InternalSwap(&other->dictionaries_);
 }
 
 std::string Catalogue::GetTypeName() const {
@@ -3661,6 +5540,10 @@ template<> PROTOBUF_NOINLINE ::proto::Chacha_Encryption_filter*
 Arena::CreateMaybeMessage< ::proto::Chacha_Encryption_filter >(Arena* arena) {
   return Arena::CreateMessageInternal< ::proto::Chacha_Encryption_filter >(arena);
 }
+template<> PROTOBUF_NOINLINE ::proto::Aes_Encryption_filter*
+Arena::CreateMaybeMessage< ::proto::Aes_Encryption_filter >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::proto::Aes_Encryption_filter >(arena);
+}
 template<> PROTOBUF_NOINLINE ::proto::Filters*
 Arena::CreateMaybeMessage< ::proto::Filters >(Arena* arena) {
   return Arena::CreateMessageInternal< ::proto::Filters >(arena);
@@ -3669,6 +5552,14 @@ template<> PROTOBUF_NOINLINE ::proto::Ref_to_refcount*
 Arena::CreateMaybeMessage< ::proto::Ref_to_refcount >(Arena* arena) {
   return Arena::CreateMessageInternal< ::proto::Ref_to_refcount >(arena);
 }
+template<> PROTOBUF_NOINLINE ::proto::Inode*
+Arena::CreateMaybeMessage< ::proto::Inode >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::proto::Inode >(arena);
+}
+template<> PROTOBUF_NOINLINE ::proto::Hole*
+Arena::CreateMaybeMessage< ::proto::Hole >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::proto::Hole >(arena);
+}
 template<> PROTOBUF_NOINLINE ::proto::Fs_record*
 Arena::CreateMaybeMessage< ::proto::Fs_record >(Arena* arena) {
   return Arena::CreateMessageInternal< ::proto::Fs_record >(arena);
@@ -3689,6 +5580,10 @@ template<> PROTOBUF_NOINLINE ::proto::Ref_count*
 Arena::CreateMaybeMessage< ::proto::Ref_count >(Arena* arena) {
   return Arena::CreateMessageInternal< ::proto::Ref_count >(arena);
 }
+template<> PROTOBUF_NOINLINE ::proto::Zstd_dictionary*
+Arena::CreateMaybeMessage< ::proto::Zstd_dictionary >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::proto::Zstd_dictionary >(arena);
+}
 template<> PROTOBUF_NOINLINE ::proto::Catalogue*
 Arena::CreateMaybeMessage< ::proto::Catalogue >(Arena* arena) {
   return Arena::CreateMessageInternal< ::proto::Catalogue >(arena);
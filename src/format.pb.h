@@ -43,6 +43,9 @@ struct TableStruct_format_2eproto {
   static const uint32_t offsets[];
 };
 namespace proto {
+class Aes_Encryption_filter;
+struct Aes_Encryption_filterDefaultTypeInternal;
+extern Aes_Encryption_filterDefaultTypeInternal _Aes_Encryption_filter_default_instance_;
 class Catalog_header;
 struct Catalog_headerDefaultTypeInternal;
 extern Catalog_headerDefaultTypeInternal _Catalog_header_default_instance_;
@@ -67,6 +70,12 @@ extern Fs_recordDefaultTypeInternal _Fs_record_default_instance_;
 class Fs_state;
 struct Fs_stateDefaultTypeInternal;
 extern Fs_stateDefaultTypeInternal _Fs_state_default_instance_;
+class Hole;
+struct HoleDefaultTypeInternal;
+extern HoleDefaultTypeInternal _Hole_default_instance_;
+class Inode;
+struct InodeDefaultTypeInternal;
+extern InodeDefaultTypeInternal _Inode_default_instance_;
 class Ref_count;
 struct Ref_countDefaultTypeInternal;
 extern Ref_countDefaultTypeInternal _Ref_count_default_instance_;
@@ -79,8 +88,12 @@ extern State_fileDefaultTypeInternal _State_file_default_instance_;
 class ZSTD_Compression_filter;
 struct ZSTD_Compression_filterDefaultTypeInternal;
 extern ZSTD_Compression_filterDefaultTypeInternal _ZSTD_Compression_filter_default_instance_;
+class Zstd_dictionary;
+struct Zstd_dictionaryDefaultTypeInternal;
+extern Zstd_dictionaryDefaultTypeInternal _Zstd_dictionary_default_instance_;
 }  // namespace proto
 PROTOBUF_NAMESPACE_OPEN
+template<> ::proto::Aes_Encryption_filter* Arena::CreateMaybeMessage<::proto::Aes_Encryption_filter>(Arena*);
 template<> ::proto::Catalog_header* Arena::CreateMaybeMessage<::proto::Catalog_header>(Arena*);
 template<> ::proto::Catalogue* Arena::CreateMaybeMessage<::proto::Catalogue>(Arena*);
 template<> ::proto::Chacha_Encryption_filter* Arena::CreateMaybeMessage<::proto::Chacha_Encryption_filter>(Arena*);
@@ -89,10 +102,13 @@ template<> ::proto::Content_file* Arena::CreateMaybeMessage<::proto::Content_fil
 template<> ::proto::Filters* Arena::CreateMaybeMessage<::proto::Filters>(Arena*);
 template<> ::proto::Fs_record* Arena::CreateMaybeMessage<::proto::Fs_record>(Arena*);
 template<> ::proto::Fs_state* Arena::CreateMaybeMessage<::proto::Fs_state>(Arena*);
+template<> ::proto::Hole* Arena::CreateMaybeMessage<::proto::Hole>(Arena*);
+template<> ::proto::Inode* Arena::CreateMaybeMessage<::proto::Inode>(Arena*);
 template<> ::proto::Ref_count* Arena::CreateMaybeMessage<::proto::Ref_count>(Arena*);
 template<> ::proto::Ref_to_refcount* Arena::CreateMaybeMessage<::proto::Ref_to_refcount>(Arena*);
 template<> ::proto::State_file* Arena::CreateMaybeMessage<::proto::State_file>(Arena*);
 template<> ::proto::ZSTD_Compression_filter* Arena::CreateMaybeMessage<::proto::ZSTD_Compression_filter>(Arena*);
+template<> ::proto::Zstd_dictionary* Arena::CreateMaybeMessage<::proto::Zstd_dictionary>(Arena*);
 PROTOBUF_NAMESPACE_CLOSE
 namespace proto {
 
@@ -227,6 +243,36 @@ class ZSTD_Compression_filter final :
 
   // accessors -------------------------------------------------------
 
+  enum : int {
+    kWindowLogFieldNumber = 1,
+    kDictionaryIdFieldNumber = 2,
+  };
+  // optional uint32 window_log = 1;
+  bool has_window_log() const;
+  private:
+  bool _internal_has_window_log() const;
+  public:
+  void clear_window_log();
+  uint32_t window_log() const;
+  void set_window_log(uint32_t value);
+  private:
+  uint32_t _internal_window_log() const;
+  void _internal_set_window_log(uint32_t value);
+  public:
+
+  // optional uint32 dictionary_id = 2;
+  bool has_dictionary_id() const;
+  private:
+  bool _internal_has_dictionary_id() const;
+  public:
+  void clear_dictionary_id();
+  uint32_t dictionary_id() const;
+  void set_dictionary_id(uint32_t value);
+  private:
+  uint32_t _internal_dictionary_id() const;
+  void _internal_set_dictionary_id(uint32_t value);
+  public:
+
   // @@protoc_insertion_point(class_scope:proto.ZSTD_Compression_filter)
  private:
   class _Internal;
@@ -234,7 +280,10 @@ class ZSTD_Compression_filter final :
   template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
+  ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
   mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  uint32_t window_log_;
+  uint32_t dictionary_id_;
   friend struct ::TableStruct_format_2eproto;
 };
 // -------------------------------------------------------------------
@@ -570,6 +619,170 @@ class Chacha_Encryption_filter final :
 };
 // -------------------------------------------------------------------
 
+class Aes_Encryption_filter final :
+    public ::PROTOBUF_NAMESPACE_ID::MessageLite /* @@protoc_insertion_point(class_definition:proto.Aes_Encryption_filter) */ {
+ public:
+  inline Aes_Encryption_filter() : Aes_Encryption_filter(nullptr) {}
+  ~Aes_Encryption_filter() override;
+  explicit PROTOBUF_CONSTEXPR Aes_Encryption_filter(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  Aes_Encryption_filter(const Aes_Encryption_filter& from);
+  Aes_Encryption_filter(Aes_Encryption_filter&& from) noexcept
+    : Aes_Encryption_filter() {
+    *this = ::std::move(from);
+  }
+
+  inline Aes_Encryption_filter& operator=(const Aes_Encryption_filter& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline Aes_Encryption_filter& operator=(Aes_Encryption_filter&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const std::string& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString);
+  }
+  inline std::string* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<std::string>();
+  }
+
+  static const Aes_Encryption_filter& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const Aes_Encryption_filter* internal_default_instance() {
+    return reinterpret_cast<const Aes_Encryption_filter*>(
+               &_Aes_Encryption_filter_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    3;
+
+  friend void swap(Aes_Encryption_filter& a, Aes_Encryption_filter& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(Aes_Encryption_filter* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(Aes_Encryption_filter* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  Aes_Encryption_filter* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<Aes_Encryption_filter>(arena);
+  }
+  void CheckTypeAndMergeFrom(const ::PROTOBUF_NAMESPACE_ID::MessageLite& from)  final;
+  void CopyFrom(const Aes_Encryption_filter& from);
+  void MergeFrom(const Aes_Encryption_filter& from);
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _cached_size_.Get(); }
+
+  private:
+  void SharedCtor();
+  void SharedDtor();
+  void SetCachedSize(int size) const;
+  void InternalSwap(Aes_Encryption_filter* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "proto.Aes_Encryption_filter";
+  }
+  protected:
+  explicit Aes_Encryption_filter(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  std::string GetTypeName() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kIvFieldNumber = 1,
+    kKeyFieldNumber = 2,
+  };
+  // required bytes iv = 1;
+  bool has_iv() const;
+  private:
+  bool _internal_has_iv() const;
+  public:
+  void clear_iv();
+  const std::string& iv() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_iv(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_iv();
+  PROTOBUF_NODISCARD std::string* release_iv();
+  void set_allocated_iv(std::string* iv);
+  private:
+  const std::string& _internal_iv() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_iv(const std::string& value);
+  std::string* _internal_mutable_iv();
+  public:
+
+  // optional bytes key = 2;
+  bool has_key() const;
+  private:
+  bool _internal_has_key() const;
+  public:
+  void clear_key();
+  const std::string& key() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_key(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_key();
+  PROTOBUF_NODISCARD std::string* release_key();
+  void set_allocated_key(std::string* key);
+  private:
+  const std::string& _internal_key() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_key(const std::string& value);
+  std::string* _internal_mutable_key();
+  public:
+
+  // @@protoc_insertion_point(class_scope:proto.Aes_Encryption_filter)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr iv_;
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr key_;
+  friend struct ::TableStruct_format_2eproto;
+};
+// -------------------------------------------------------------------
+
 class Filters final :
     public ::PROTOBUF_NAMESPACE_ID::MessageLite /* @@protoc_insertion_point(class_definition:proto.Filters) */ {
  public:
@@ -614,6 +827,9 @@ class Filters final :
   enum EncryptionCase {
     kChapolyEncryption = 2,
     kChachaEncryption = 3,
+    kChapolyStreamEncryption = 4,
+    kAesGcmStreamEncryption = 5,
+    kAesCtrEncryption = 6,
     ENCRYPTION_NOT_SET = 0,
   };
 
@@ -622,7 +838,7 @@ class Filters final :
                &_Filters_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
-    3;
+    4;
 
   friend void swap(Filters& a, Filters& b) {
     a.Swap(&b);
@@ -689,6 +905,9 @@ class Filters final :
     kZstdCompressionFieldNumber = 1,
     kChapolyEncryptionFieldNumber = 2,
     kChachaEncryptionFieldNumber = 3,
+    kChapolyStreamEncryptionFieldNumber = 4,
+    kAesGcmStreamEncryptionFieldNumber = 5,
+    kAesCtrEncryptionFieldNumber = 6,
   };
   // optional .proto.ZSTD_Compression_filter zstd_compression = 1;
   bool has_zstd_compression() const;
@@ -744,6 +963,60 @@ class Filters final :
       ::proto::Chacha_Encryption_filter* chacha_encryption);
   ::proto::Chacha_Encryption_filter* unsafe_arena_release_chacha_encryption();
 
+  // .proto.Chapoly_Encryption_filter chapoly_stream_encryption = 4;
+  bool has_chapoly_stream_encryption() const;
+  private:
+  bool _internal_has_chapoly_stream_encryption() const;
+  public:
+  void clear_chapoly_stream_encryption();
+  const ::proto::Chapoly_Encryption_filter& chapoly_stream_encryption() const;
+  PROTOBUF_NODISCARD ::proto::Chapoly_Encryption_filter* release_chapoly_stream_encryption();
+  ::proto::Chapoly_Encryption_filter* mutable_chapoly_stream_encryption();
+  void set_allocated_chapoly_stream_encryption(::proto::Chapoly_Encryption_filter* chapoly_stream_encryption);
+  private:
+  const ::proto::Chapoly_Encryption_filter& _internal_chapoly_stream_encryption() const;
+  ::proto::Chapoly_Encryption_filter* _internal_mutable_chapoly_stream_encryption();
+  public:
+  void unsafe_arena_set_allocated_chapoly_stream_encryption(
+      ::proto::Chapoly_Encryption_filter* chapoly_stream_encryption);
+  ::proto::Chapoly_Encryption_filter* unsafe_arena_release_chapoly_stream_encryption();
+
+  // .proto.Aes_Encryption_filter aes_gcm_stream_encryption = 5;
+  bool has_aes_gcm_stream_encryption() const;
+  private:
+  bool _internal_has_aes_gcm_stream_encryption() const;
+  public:
+  void clear_aes_gcm_stream_encryption();
+  const ::proto::Aes_Encryption_filter& aes_gcm_stream_encryption() const;
+  PROTOBUF_NODISCARD ::proto::Aes_Encryption_filter* release_aes_gcm_stream_encryption();
+  ::proto::Aes_Encryption_filter* mutable_aes_gcm_stream_encryption();
+  void set_allocated_aes_gcm_stream_encryption(::proto::Aes_Encryption_filter* aes_gcm_stream_encryption);
+  private:
+  const ::proto::Aes_Encryption_filter& _internal_aes_gcm_stream_encryption() const;
+  ::proto::Aes_Encryption_filter* _internal_mutable_aes_gcm_stream_encryption();
+  public:
+  void unsafe_arena_set_allocated_aes_gcm_stream_encryption(
+      ::proto::Aes_Encryption_filter* aes_gcm_stream_encryption);
+  ::proto::Aes_Encryption_filter* unsafe_arena_release_aes_gcm_stream_encryption();
+
+  // .proto.Aes_Encryption_filter aes_ctr_encryption = 6;
+  bool has_aes_ctr_encryption() const;
+  private:
+  bool _internal_has_aes_ctr_encryption() const;
+  public:
+  void clear_aes_ctr_encryption();
+  const ::proto::Aes_Encryption_filter& aes_ctr_encryption() const;
+  PROTOBUF_NODISCARD ::proto::Aes_Encryption_filter* release_aes_ctr_encryption();
+  ::proto::Aes_Encryption_filter* mutable_aes_ctr_encryption();
+  void set_allocated_aes_ctr_encryption(::proto::Aes_Encryption_filter* aes_ctr_encryption);
+  private:
+  const ::proto::Aes_Encryption_filter& _internal_aes_ctr_encryption() const;
+  ::proto::Aes_Encryption_filter* _internal_mutable_aes_ctr_encryption();
+  public:
+  void unsafe_arena_set_allocated_aes_ctr_encryption(
+      ::proto::Aes_Encryption_filter* aes_ctr_encryption);
+  ::proto::Aes_Encryption_filter* unsafe_arena_release_aes_ctr_encryption();
+
   void clear_encryption();
   EncryptionCase encryption_case() const;
   // @@protoc_insertion_point(class_scope:proto.Filters)
@@ -751,6 +1024,9 @@ class Filters final :
   class _Internal;
   void set_has_chapoly_encryption();
   void set_has_chacha_encryption();
+  void set_has_chapoly_stream_encryption();
+  void set_has_aes_gcm_stream_encryption();
+  void set_has_aes_ctr_encryption();
 
   inline bool has_encryption() const;
   inline void clear_has_encryption();
@@ -766,6 +1042,9 @@ class Filters final :
       ::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized _constinit_;
     ::proto::Chapoly_Encryption_filter* chapoly_encryption_;
     ::proto::Chacha_Encryption_filter* chacha_encryption_;
+    ::proto::Chapoly_Encryption_filter* chapoly_stream_encryption_;
+    ::proto::Aes_Encryption_filter* aes_gcm_stream_encryption_;
+    ::proto::Aes_Encryption_filter* aes_ctr_encryption_;
   } encryption_;
   uint32_t _oneof_case_[1];
 
@@ -819,7 +1098,7 @@ class Ref_to_refcount final :
                &_Ref_to_refcount_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
-    4;
+    5;
 
   friend void swap(Ref_to_refcount& a, Ref_to_refcount& b) {
     a.Swap(&b);
@@ -935,24 +1214,24 @@ class Ref_to_refcount final :
 };
 // -------------------------------------------------------------------
 
-class Fs_record final :
-    public ::PROTOBUF_NAMESPACE_ID::MessageLite /* @@protoc_insertion_point(class_definition:proto.Fs_record) */ {
+class Inode final :
+    public ::PROTOBUF_NAMESPACE_ID::MessageLite /* @@protoc_insertion_point(class_definition:proto.Inode) */ {
  public:
-  inline Fs_record() : Fs_record(nullptr) {}
-  ~Fs_record() override;
-  explicit PROTOBUF_CONSTEXPR Fs_record(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+  inline Inode() : Inode(nullptr) {}
+  ~Inode() override;
+  explicit PROTOBUF_CONSTEXPR Inode(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
-  Fs_record(const Fs_record& from);
-  Fs_record(Fs_record&& from) noexcept
-    : Fs_record() {
+  Inode(const Inode& from);
+  Inode(Inode&& from) noexcept
+    : Inode() {
     *this = ::std::move(from);
   }
 
-  inline Fs_record& operator=(const Fs_record& from) {
+  inline Inode& operator=(const Inode& from) {
     CopyFrom(from);
     return *this;
   }
-  inline Fs_record& operator=(Fs_record&& from) noexcept {
+  inline Inode& operator=(Inode&& from) noexcept {
     if (this == &from) return *this;
     if (GetOwningArena() == from.GetOwningArena()
   #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
@@ -973,20 +1252,20 @@ class Fs_record final :
     return _internal_metadata_.mutable_unknown_fields<std::string>();
   }
 
-  static const Fs_record& default_instance() {
+  static const Inode& default_instance() {
     return *internal_default_instance();
   }
-  static inline const Fs_record* internal_default_instance() {
-    return reinterpret_cast<const Fs_record*>(
-               &_Fs_record_default_instance_);
+  static inline const Inode* internal_default_instance() {
+    return reinterpret_cast<const Inode*>(
+               &_Inode_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
-    5;
+    6;
 
-  friend void swap(Fs_record& a, Fs_record& b) {
+  friend void swap(Inode& a, Inode& b) {
     a.Swap(&b);
   }
-  inline void Swap(Fs_record* other) {
+  inline void Swap(Inode* other) {
     if (other == this) return;
   #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
     if (GetOwningArena() != nullptr &&
@@ -999,7 +1278,7 @@ class Fs_record final :
       ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
     }
   }
-  void UnsafeArenaSwap(Fs_record* other) {
+  void UnsafeArenaSwap(Inode* other) {
     if (other == this) return;
     GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
@@ -1007,12 +1286,12 @@ class Fs_record final :
 
   // implements Message ----------------------------------------------
 
-  Fs_record* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
-    return CreateMaybeMessage<Fs_record>(arena);
+  Inode* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<Inode>(arena);
   }
   void CheckTypeAndMergeFrom(const ::PROTOBUF_NAMESPACE_ID::MessageLite& from)  final;
-  void CopyFrom(const Fs_record& from);
-  void MergeFrom(const Fs_record& from);
+  void CopyFrom(const Inode& from);
+  void MergeFrom(const Inode& from);
   PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
   bool IsInitialized() const final;
 
@@ -1026,15 +1305,15 @@ class Fs_record final :
   void SharedCtor();
   void SharedDtor();
   void SetCachedSize(int size) const;
-  void InternalSwap(Fs_record* other);
+  void InternalSwap(Inode* other);
 
   private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
-    return "proto.Fs_record";
+    return "proto.Inode";
   }
   protected:
-  explicit Fs_record(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+  explicit Inode(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                        bool is_message_owned = false);
   public:
 
@@ -1045,87 +1324,489 @@ class Fs_record final :
   // accessors -------------------------------------------------------
 
   enum : int {
-    kPathnameFieldNumber = 1,
-    kSymlinkTargetFieldNumber = 5,
-    kPosixAclFieldNumber = 7,
-    kPosixDefaultAclFieldNumber = 8,
-    kRefFieldNumber = 4,
-    kModifiedNanosecondsFieldNumber = 3,
-    kTypeFieldNumber = 2,
-    kUnixPermissionsFieldNumber = 6,
+    kDeviceFieldNumber = 1,
+    kNumberFieldNumber = 2,
+    kSizeFieldNumber = 3,
+    kChangedNanosecondsFieldNumber = 4,
   };
-  // required string pathname = 1;
-  bool has_pathname() const;
+  // required uint64 device = 1;
+  bool has_device() const;
   private:
-  bool _internal_has_pathname() const;
+  bool _internal_has_device() const;
   public:
-  void clear_pathname();
-  const std::string& pathname() const;
-  template <typename ArgT0 = const std::string&, typename... ArgT>
-  void set_pathname(ArgT0&& arg0, ArgT... args);
-  std::string* mutable_pathname();
-  PROTOBUF_NODISCARD std::string* release_pathname();
-  void set_allocated_pathname(std::string* pathname);
+  void clear_device();
+  uint64_t device() const;
+  void set_device(uint64_t value);
   private:
-  const std::string& _internal_pathname() const;
-  inline PROTOBUF_ALWAYS_INLINE void _internal_set_pathname(const std::string& value);
-  std::string* _internal_mutable_pathname();
+  uint64_t _internal_device() const;
+  void _internal_set_device(uint64_t value);
   public:
 
-  // optional string symlink_target = 5;
-  bool has_symlink_target() const;
+  // required uint64 number = 2;
+  bool has_number() const;
   private:
-  bool _internal_has_symlink_target() const;
+  bool _internal_has_number() const;
   public:
-  void clear_symlink_target();
-  const std::string& symlink_target() const;
-  template <typename ArgT0 = const std::string&, typename... ArgT>
-  void set_symlink_target(ArgT0&& arg0, ArgT... args);
-  std::string* mutable_symlink_target();
-  PROTOBUF_NODISCARD std::string* release_symlink_target();
-  void set_allocated_symlink_target(std::string* symlink_target);
+  void clear_number();
+  uint64_t number() const;
+  void set_number(uint64_t value);
   private:
-  const std::string& _internal_symlink_target() const;
-  inline PROTOBUF_ALWAYS_INLINE void _internal_set_symlink_target(const std::string& value);
-  std::string* _internal_mutable_symlink_target();
+  uint64_t _internal_number() const;
+  void _internal_set_number(uint64_t value);
   public:
 
-  // optional string posix_acl = 7;
-  bool has_posix_acl() const;
+  // required uint64 size = 3;
+  bool has_size() const;
   private:
-  bool _internal_has_posix_acl() const;
+  bool _internal_has_size() const;
   public:
-  void clear_posix_acl();
-  const std::string& posix_acl() const;
-  template <typename ArgT0 = const std::string&, typename... ArgT>
-  void set_posix_acl(ArgT0&& arg0, ArgT... args);
-  std::string* mutable_posix_acl();
-  PROTOBUF_NODISCARD std::string* release_posix_acl();
-  void set_allocated_posix_acl(std::string* posix_acl);
+  void clear_size();
+  uint64_t size() const;
+  void set_size(uint64_t value);
   private:
-  const std::string& _internal_posix_acl() const;
-  inline PROTOBUF_ALWAYS_INLINE void _internal_set_posix_acl(const std::string& value);
-  std::string* _internal_mutable_posix_acl();
+  uint64_t _internal_size() const;
+  void _internal_set_size(uint64_t value);
   public:
 
-  // optional string posix_default_acl = 8;
-  bool has_posix_default_acl() const;
+  // required uint64 changed_nanoseconds = 4;
+  bool has_changed_nanoseconds() const;
   private:
-  bool _internal_has_posix_default_acl() const;
+  bool _internal_has_changed_nanoseconds() const;
   public:
-  void clear_posix_default_acl();
-  const std::string& posix_default_acl() const;
-  template <typename ArgT0 = const std::string&, typename... ArgT>
-  void set_posix_default_acl(ArgT0&& arg0, ArgT... args);
-  std::string* mutable_posix_default_acl();
-  PROTOBUF_NODISCARD std::string* release_posix_default_acl();
-  void set_allocated_posix_default_acl(std::string* posix_default_acl);
+  void clear_changed_nanoseconds();
+  uint64_t changed_nanoseconds() const;
+  void set_changed_nanoseconds(uint64_t value);
   private:
-  const std::string& _internal_posix_default_acl() const;
-  inline PROTOBUF_ALWAYS_INLINE void _internal_set_posix_default_acl(const std::string& value);
+  uint64_t _internal_changed_nanoseconds() const;
+  void _internal_set_changed_nanoseconds(uint64_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:proto.Inode)
+ private:
+  class _Internal;
+
+  // helper for ByteSizeLong()
+  size_t RequiredFieldsByteSizeFallback() const;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  uint64_t device_;
+  uint64_t number_;
+  uint64_t size_;
+  uint64_t changed_nanoseconds_;
+  friend struct ::TableStruct_format_2eproto;
+};
+// -------------------------------------------------------------------
+
+class Hole final :
+    public ::PROTOBUF_NAMESPACE_ID::MessageLite /* @@protoc_insertion_point(class_definition:proto.Hole) */ {
+ public:
+  inline Hole() : Hole(nullptr) {}
+  ~Hole() override;
+  explicit PROTOBUF_CONSTEXPR Hole(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  Hole(const Hole& from);
+  Hole(Hole&& from) noexcept
+    : Hole() {
+    *this = ::std::move(from);
+  }
+
+  inline Hole& operator=(const Hole& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline Hole& operator=(Hole&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const std::string& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString);
+  }
+  inline std::string* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<std::string>();
+  }
+
+  static const Hole& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const Hole* internal_default_instance() {
+    return reinterpret_cast<const Hole*>(
+               &_Hole_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    7;
+
+  friend void swap(Hole& a, Hole& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(Hole* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(Hole* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  Hole* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<Hole>(arena);
+  }
+  void CheckTypeAndMergeFrom(const ::PROTOBUF_NAMESPACE_ID::MessageLite& from)  final;
+  void CopyFrom(const Hole& from);
+  void MergeFrom(const Hole& from);
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _cached_size_.Get(); }
+
+  private:
+  void SharedCtor();
+  void SharedDtor();
+  void SetCachedSize(int size) const;
+  void InternalSwap(Hole* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "proto.Hole";
+  }
+  protected:
+  explicit Hole(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  std::string GetTypeName() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kOffsetFieldNumber = 1,
+    kSizeFieldNumber = 2,
+  };
+  // required uint64 offset = 1;
+  bool has_offset() const;
+  private:
+  bool _internal_has_offset() const;
+  public:
+  void clear_offset();
+  uint64_t offset() const;
+  void set_offset(uint64_t value);
+  private:
+  uint64_t _internal_offset() const;
+  void _internal_set_offset(uint64_t value);
+  public:
+
+  // required uint64 size = 2;
+  bool has_size() const;
+  private:
+  bool _internal_has_size() const;
+  public:
+  void clear_size();
+  uint64_t size() const;
+  void set_size(uint64_t value);
+  private:
+  uint64_t _internal_size() const;
+  void _internal_set_size(uint64_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:proto.Hole)
+ private:
+  class _Internal;
+
+  // helper for ByteSizeLong()
+  size_t RequiredFieldsByteSizeFallback() const;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  uint64_t offset_;
+  uint64_t size_;
+  friend struct ::TableStruct_format_2eproto;
+};
+// -------------------------------------------------------------------
+
+class Fs_record final :
+    public ::PROTOBUF_NAMESPACE_ID::MessageLite /* @@protoc_insertion_point(class_definition:proto.Fs_record) */ {
+ public:
+  inline Fs_record() : Fs_record(nullptr) {}
+  ~Fs_record() override;
+  explicit PROTOBUF_CONSTEXPR Fs_record(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  Fs_record(const Fs_record& from);
+  Fs_record(Fs_record&& from) noexcept
+    : Fs_record() {
+    *this = ::std::move(from);
+  }
+
+  inline Fs_record& operator=(const Fs_record& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline Fs_record& operator=(Fs_record&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const std::string& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString);
+  }
+  inline std::string* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<std::string>();
+  }
+
+  static const Fs_record& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const Fs_record* internal_default_instance() {
+    return reinterpret_cast<const Fs_record*>(
+               &_Fs_record_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    8;
+
+  friend void swap(Fs_record& a, Fs_record& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(Fs_record* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(Fs_record* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  Fs_record* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<Fs_record>(arena);
+  }
+  void CheckTypeAndMergeFrom(const ::PROTOBUF_NAMESPACE_ID::MessageLite& from)  final;
+  void CopyFrom(const Fs_record& from);
+  void MergeFrom(const Fs_record& from);
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _cached_size_.Get(); }
+
+  private:
+  void SharedCtor();
+  void SharedDtor();
+  void SetCachedSize(int size) const;
+  void InternalSwap(Fs_record* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "proto.Fs_record";
+  }
+  protected:
+  explicit Fs_record(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  std::string GetTypeName() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kChunksFieldNumber = 9,
+    kHolesFieldNumber = 12,
+    kPathnameFieldNumber = 1,
+    kSymlinkTargetFieldNumber = 5,
+    kPosixAclFieldNumber = 7,
+    kPosixDefaultAclFieldNumber = 8,
+    kHardLinkFieldNumber = 11,
+    kRefFieldNumber = 4,
+    kInodeFieldNumber = 10,
+    kModifiedNanosecondsFieldNumber = 3,
+    kTypeFieldNumber = 2,
+    kUnixPermissionsFieldNumber = 6,
+  };
+  // repeated .proto.Ref_to_refcount chunks = 9;
+  int chunks_size() const;
+  private:
+  int _internal_chunks_size() const;
+  public:
+  void clear_chunks();
+  ::proto::Ref_to_refcount* mutable_chunks(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::proto::Ref_to_refcount >*
+      mutable_chunks();
+  private:
+  const ::proto::Ref_to_refcount& _internal_chunks(int index) const;
+  ::proto::Ref_to_refcount* _internal_add_chunks();
+  public:
+  const ::proto::Ref_to_refcount& chunks(int index) const;
+  ::proto::Ref_to_refcount* add_chunks();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::proto::Ref_to_refcount >&
+      chunks() const;
+
+  // repeated .proto.Hole holes = 12;
+  int holes_size() const;
+  private:
+  int _internal_holes_size() const;
+  public:
+  void clear_holes();
+  ::proto::Hole* mutable_holes(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::proto::Hole >*
+      mutable_holes();
+  private:
+  const ::proto::Hole& _internal_holes(int index) const;
+  ::proto::Hole* _internal_add_holes();
+  public:
+  const ::proto::Hole& holes(int index) const;
+  ::proto::Hole* add_holes();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::proto::Hole >&
+      holes() const;
+
+  // required string pathname = 1;
+  bool has_pathname() const;
+  private:
+  bool _internal_has_pathname() const;
+  public:
+  void clear_pathname();
+  const std::string& pathname() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_pathname(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_pathname();
+  PROTOBUF_NODISCARD std::string* release_pathname();
+  void set_allocated_pathname(std::string* pathname);
+  private:
+  const std::string& _internal_pathname() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_pathname(const std::string& value);
+  std::string* _internal_mutable_pathname();
+  public:
+
+  // optional string symlink_target = 5;
+  bool has_symlink_target() const;
+  private:
+  bool _internal_has_symlink_target() const;
+  public:
+  void clear_symlink_target();
+  const std::string& symlink_target() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_symlink_target(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_symlink_target();
+  PROTOBUF_NODISCARD std::string* release_symlink_target();
+  void set_allocated_symlink_target(std::string* symlink_target);
+  private:
+  const std::string& _internal_symlink_target() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_symlink_target(const std::string& value);
+  std::string* _internal_mutable_symlink_target();
+  public:
+
+  // optional string posix_acl = 7;
+  bool has_posix_acl() const;
+  private:
+  bool _internal_has_posix_acl() const;
+  public:
+  void clear_posix_acl();
+  const std::string& posix_acl() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_posix_acl(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_posix_acl();
+  PROTOBUF_NODISCARD std::string* release_posix_acl();
+  void set_allocated_posix_acl(std::string* posix_acl);
+  private:
+  const std::string& _internal_posix_acl() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_posix_acl(const std::string& value);
+  std::string* _internal_mutable_posix_acl();
+  public:
+
+  // optional string posix_default_acl = 8;
+  bool has_posix_default_acl() const;
+  private:
+  bool _internal_has_posix_default_acl() const;
+  public:
+  void clear_posix_default_acl();
+  const std::string& posix_default_acl() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_posix_default_acl(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_posix_default_acl();
+  PROTOBUF_NODISCARD std::string* release_posix_default_acl();
+  void set_allocated_posix_default_acl(std::string* posix_default_acl);
+  private:
+  const std::string& _internal_posix_default_acl() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_posix_default_acl(const std::string& value);
   std::string* _internal_mutable_posix_default_acl();
   public:
 
+  // optional string hard_link = 11;
+  bool has_hard_link() const;
+  private:
+  bool _internal_has_hard_link() const;
+  public:
+  void clear_hard_link();
+  const std::string& hard_link() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_hard_link(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_hard_link();
+  PROTOBUF_NODISCARD std::string* release_hard_link();
+  void set_allocated_hard_link(std::string* hard_link);
+  private:
+  const std::string& _internal_hard_link() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_hard_link(const std::string& value);
+  std::string* _internal_mutable_hard_link();
+  public:
+
   // optional .proto.Ref_to_refcount ref = 4;
   bool has_ref() const;
   private:
@@ -1144,6 +1825,24 @@ class Fs_record final :
       ::proto::Ref_to_refcount* ref);
   ::proto::Ref_to_refcount* unsafe_arena_release_ref();
 
+  // optional .proto.Inode inode = 10;
+  bool has_inode() const;
+  private:
+  bool _internal_has_inode() const;
+  public:
+  void clear_inode();
+  const ::proto::Inode& inode() const;
+  PROTOBUF_NODISCARD ::proto::Inode* release_inode();
+  ::proto::Inode* mutable_inode();
+  void set_allocated_inode(::proto::Inode* inode);
+  private:
+  const ::proto::Inode& _internal_inode() const;
+  ::proto::Inode* _internal_mutable_inode();
+  public:
+  void unsafe_arena_set_allocated_inode(
+      ::proto::Inode* inode);
+  ::proto::Inode* unsafe_arena_release_inode();
+
   // optional uint64 modified_nanoseconds = 3;
   bool has_modified_nanoseconds() const;
   private:
@@ -1195,11 +1894,15 @@ class Fs_record final :
   typedef void DestructorSkippable_;
   ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
   mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::proto::Ref_to_refcount > chunks_;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::proto::Hole > holes_;
   ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr pathname_;
   ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr symlink_target_;
   ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr posix_acl_;
   ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr posix_default_acl_;
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr hard_link_;
   ::proto::Ref_to_refcount* ref_;
+  ::proto::Inode* inode_;
   uint64_t modified_nanoseconds_;
   int type_;
   uint32_t unix_permissions_;
@@ -1253,7 +1956,7 @@ class Fs_state final :
                &_Fs_state_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
-    6;
+    9;
 
   friend void swap(Fs_state& a, Fs_state& b) {
     a.Swap(&b);
@@ -1396,7 +2099,7 @@ class State_file final :
                &_State_file_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
-    7;
+    10;
 
   friend void swap(State_file& a, State_file& b) {
     a.Swap(&b);
@@ -1578,7 +2281,7 @@ class Content_file final :
                &_Content_file_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
-    8;
+    11;
 
   friend void swap(Content_file& a, Content_file& b) {
     a.Swap(&b);
@@ -1643,8 +2346,11 @@ class Content_file final :
 
   enum : int {
     kRefsFieldNumber = 3,
+    kBlockXxhashFieldNumber = 6,
     kNameFieldNumber = 2,
     kFiltersFieldNumber = 1,
+    kSizeFieldNumber = 4,
+    kBlockSizeFieldNumber = 5,
   };
   // repeated .proto.Ref_count refs = 3;
   int refs_size() const;
@@ -1664,6 +2370,28 @@ class Content_file final :
   const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::proto::Ref_count >&
       refs() const;
 
+  // repeated fixed64 block_xxhash = 6 [packed = true];
+  int block_xxhash_size() const;
+  private:
+  int _internal_block_xxhash_size() const;
+  public:
+  void clear_block_xxhash();
+  private:
+  uint64_t _internal_block_xxhash(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >&
+      _internal_block_xxhash() const;
+  void _internal_add_block_xxhash(uint64_t value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >*
+      _internal_mutable_block_xxhash();
+  public:
+  uint64_t block_xxhash(int index) const;
+  void set_block_xxhash(int index, uint64_t value);
+  void add_block_xxhash(uint64_t value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >&
+      block_xxhash() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >*
+      mutable_block_xxhash();
+
   // required string name = 2;
   bool has_name() const;
   private:
@@ -1700,6 +2428,32 @@ class Content_file final :
       ::proto::Filters* filters);
   ::proto::Filters* unsafe_arena_release_filters();
 
+  // optional uint64 size = 4;
+  bool has_size() const;
+  private:
+  bool _internal_has_size() const;
+  public:
+  void clear_size();
+  uint64_t size() const;
+  void set_size(uint64_t value);
+  private:
+  uint64_t _internal_size() const;
+  void _internal_set_size(uint64_t value);
+  public:
+
+  // optional uint64 block_size = 5;
+  bool has_block_size() const;
+  private:
+  bool _internal_has_block_size() const;
+  public:
+  void clear_block_size();
+  uint64_t block_size() const;
+  void set_block_size(uint64_t value);
+  private:
+  uint64_t _internal_block_size() const;
+  void _internal_set_block_size(uint64_t value);
+  public:
+
   // @@protoc_insertion_point(class_scope:proto.Content_file)
  private:
   class _Internal;
@@ -1710,8 +2464,11 @@ class Content_file final :
   ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
   mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
   ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::proto::Ref_count > refs_;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t > block_xxhash_;
   ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr name_;
   ::proto::Filters* filters_;
+  uint64_t size_;
+  uint64_t block_size_;
   friend struct ::TableStruct_format_2eproto;
 };
 // -------------------------------------------------------------------
@@ -1760,6 +2517,8 @@ class Ref_count final :
   enum CsumCase {
     kXxhash = 5,
     kBlake2B = 6,
+    kXxh3128 = 9,
+    kBlake3 = 10,
     CSUM_NOT_SET = 0,
   };
 
@@ -1768,7 +2527,7 @@ class Ref_count final :
                &_Ref_count_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
-    9;
+    12;
 
   friend void swap(Ref_count& a, Ref_count& b) {
     a.Swap(&b);
@@ -1832,13 +2591,36 @@ class Ref_count final :
   // accessors -------------------------------------------------------
 
   enum : int {
+    kContentIdFieldNumber = 11,
     kFromFieldNumber = 1,
     kToFieldNumber = 2,
     kRefCountFieldNumber = 3,
     kSpaceTakenFieldNumber = 4,
+    kSeekOffsetFieldNumber = 7,
+    kSeekFromFieldNumber = 8,
     kXxhashFieldNumber = 5,
     kBlake2BFieldNumber = 6,
+    kXxh3128FieldNumber = 9,
+    kBlake3FieldNumber = 10,
   };
+  // optional bytes content_id = 11;
+  bool has_content_id() const;
+  private:
+  bool _internal_has_content_id() const;
+  public:
+  void clear_content_id();
+  const std::string& content_id() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_content_id(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_content_id();
+  PROTOBUF_NODISCARD std::string* release_content_id();
+  void set_allocated_content_id(std::string* content_id);
+  private:
+  const std::string& _internal_content_id() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_content_id(const std::string& value);
+  std::string* _internal_mutable_content_id();
+  public:
+
   // required uint64 from = 1;
   bool has_from() const;
   private:
@@ -1865,73 +2647,314 @@ class Ref_count final :
   void _internal_set_to(uint64_t value);
   public:
 
-  // required uint64 ref_count = 3;
-  bool has_ref_count() const;
-  private:
-  bool _internal_has_ref_count() const;
-  public:
-  void clear_ref_count();
-  uint64_t ref_count() const;
-  void set_ref_count(uint64_t value);
-  private:
-  uint64_t _internal_ref_count() const;
-  void _internal_set_ref_count(uint64_t value);
-  public:
+  // required uint64 ref_count = 3;
+  bool has_ref_count() const;
+  private:
+  bool _internal_has_ref_count() const;
+  public:
+  void clear_ref_count();
+  uint64_t ref_count() const;
+  void set_ref_count(uint64_t value);
+  private:
+  uint64_t _internal_ref_count() const;
+  void _internal_set_ref_count(uint64_t value);
+  public:
+
+  // required uint64 space_taken = 4;
+  bool has_space_taken() const;
+  private:
+  bool _internal_has_space_taken() const;
+  public:
+  void clear_space_taken();
+  uint64_t space_taken() const;
+  void set_space_taken(uint64_t value);
+  private:
+  uint64_t _internal_space_taken() const;
+  void _internal_set_space_taken(uint64_t value);
+  public:
+
+  // optional uint64 seek_offset = 7;
+  bool has_seek_offset() const;
+  private:
+  bool _internal_has_seek_offset() const;
+  public:
+  void clear_seek_offset();
+  uint64_t seek_offset() const;
+  void set_seek_offset(uint64_t value);
+  private:
+  uint64_t _internal_seek_offset() const;
+  void _internal_set_seek_offset(uint64_t value);
+  public:
+
+  // optional uint64 seek_from = 8;
+  bool has_seek_from() const;
+  private:
+  bool _internal_has_seek_from() const;
+  public:
+  void clear_seek_from();
+  uint64_t seek_from() const;
+  void set_seek_from(uint64_t value);
+  private:
+  uint64_t _internal_seek_from() const;
+  void _internal_set_seek_from(uint64_t value);
+  public:
+
+  // uint64 xxhash = 5;
+  bool has_xxhash() const;
+  private:
+  bool _internal_has_xxhash() const;
+  public:
+  void clear_xxhash();
+  uint64_t xxhash() const;
+  void set_xxhash(uint64_t value);
+  private:
+  uint64_t _internal_xxhash() const;
+  void _internal_set_xxhash(uint64_t value);
+  public:
+
+  // bytes blake2b = 6;
+  bool has_blake2b() const;
+  private:
+  bool _internal_has_blake2b() const;
+  public:
+  void clear_blake2b();
+  const std::string& blake2b() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_blake2b(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_blake2b();
+  PROTOBUF_NODISCARD std::string* release_blake2b();
+  void set_allocated_blake2b(std::string* blake2b);
+  private:
+  const std::string& _internal_blake2b() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_blake2b(const std::string& value);
+  std::string* _internal_mutable_blake2b();
+  public:
+
+  // bytes xxh3_128 = 9;
+  bool has_xxh3_128() const;
+  private:
+  bool _internal_has_xxh3_128() const;
+  public:
+  void clear_xxh3_128();
+  const std::string& xxh3_128() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_xxh3_128(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_xxh3_128();
+  PROTOBUF_NODISCARD std::string* release_xxh3_128();
+  void set_allocated_xxh3_128(std::string* xxh3_128);
+  private:
+  const std::string& _internal_xxh3_128() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_xxh3_128(const std::string& value);
+  std::string* _internal_mutable_xxh3_128();
+  public:
+
+  // bytes blake3 = 10;
+  bool has_blake3() const;
+  private:
+  bool _internal_has_blake3() const;
+  public:
+  void clear_blake3();
+  const std::string& blake3() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_blake3(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_blake3();
+  PROTOBUF_NODISCARD std::string* release_blake3();
+  void set_allocated_blake3(std::string* blake3);
+  private:
+  const std::string& _internal_blake3() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_blake3(const std::string& value);
+  std::string* _internal_mutable_blake3();
+  public:
+
+  void clear_csum();
+  CsumCase csum_case() const;
+  // @@protoc_insertion_point(class_scope:proto.Ref_count)
+ private:
+  class _Internal;
+  void set_has_xxhash();
+  void set_has_blake2b();
+  void set_has_xxh3_128();
+  void set_has_blake3();
+
+  inline bool has_csum() const;
+  inline void clear_has_csum();
+
+  // helper for ByteSizeLong()
+  size_t RequiredFieldsByteSizeFallback() const;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
+  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr content_id_;
+  uint64_t from_;
+  uint64_t to_;
+  uint64_t ref_count_;
+  uint64_t space_taken_;
+  uint64_t seek_offset_;
+  uint64_t seek_from_;
+  union CsumUnion {
+    constexpr CsumUnion() : _constinit_{} {}
+      ::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized _constinit_;
+    uint64_t xxhash_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr blake2b_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr xxh3_128_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr blake3_;
+  } csum_;
+  uint32_t _oneof_case_[1];
+
+  friend struct ::TableStruct_format_2eproto;
+};
+// -------------------------------------------------------------------
+
+class Zstd_dictionary final :
+    public ::PROTOBUF_NAMESPACE_ID::MessageLite /* @@protoc_insertion_point(class_definition:proto.Zstd_dictionary) */ {
+ public:
+  inline Zstd_dictionary() : Zstd_dictionary(nullptr) {}
+  ~Zstd_dictionary() override;
+  explicit PROTOBUF_CONSTEXPR Zstd_dictionary(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  Zstd_dictionary(const Zstd_dictionary& from);
+  Zstd_dictionary(Zstd_dictionary&& from) noexcept
+    : Zstd_dictionary() {
+    *this = ::std::move(from);
+  }
+
+  inline Zstd_dictionary& operator=(const Zstd_dictionary& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline Zstd_dictionary& operator=(Zstd_dictionary&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  inline const std::string& unknown_fields() const {
+    return _internal_metadata_.unknown_fields<std::string>(::PROTOBUF_NAMESPACE_ID::internal::GetEmptyString);
+  }
+  inline std::string* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields<std::string>();
+  }
+
+  static const Zstd_dictionary& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const Zstd_dictionary* internal_default_instance() {
+    return reinterpret_cast<const Zstd_dictionary*>(
+               &_Zstd_dictionary_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    13;
+
+  friend void swap(Zstd_dictionary& a, Zstd_dictionary& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(Zstd_dictionary* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(Zstd_dictionary* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  Zstd_dictionary* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<Zstd_dictionary>(arena);
+  }
+  void CheckTypeAndMergeFrom(const ::PROTOBUF_NAMESPACE_ID::MessageLite& from)  final;
+  void CopyFrom(const Zstd_dictionary& from);
+  void MergeFrom(const Zstd_dictionary& from);
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _cached_size_.Get(); }
 
-  // required uint64 space_taken = 4;
-  bool has_space_taken() const;
   private:
-  bool _internal_has_space_taken() const;
-  public:
-  void clear_space_taken();
-  uint64_t space_taken() const;
-  void set_space_taken(uint64_t value);
+  void SharedCtor();
+  void SharedDtor();
+  void SetCachedSize(int size) const;
+  void InternalSwap(Zstd_dictionary* other);
+
   private:
-  uint64_t _internal_space_taken() const;
-  void _internal_set_space_taken(uint64_t value);
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "proto.Zstd_dictionary";
+  }
+  protected:
+  explicit Zstd_dictionary(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
   public:
 
-  // uint64 xxhash = 5;
-  bool has_xxhash() const;
+  std::string GetTypeName() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kDataFieldNumber = 2,
+    kIdFieldNumber = 1,
+  };
+  // required bytes data = 2;
+  bool has_data() const;
   private:
-  bool _internal_has_xxhash() const;
+  bool _internal_has_data() const;
   public:
-  void clear_xxhash();
-  uint64_t xxhash() const;
-  void set_xxhash(uint64_t value);
+  void clear_data();
+  const std::string& data() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_data(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_data();
+  PROTOBUF_NODISCARD std::string* release_data();
+  void set_allocated_data(std::string* data);
   private:
-  uint64_t _internal_xxhash() const;
-  void _internal_set_xxhash(uint64_t value);
+  const std::string& _internal_data() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_data(const std::string& value);
+  std::string* _internal_mutable_data();
   public:
 
-  // bytes blake2b = 6;
-  bool has_blake2b() const;
+  // required uint32 id = 1;
+  bool has_id() const;
   private:
-  bool _internal_has_blake2b() const;
+  bool _internal_has_id() const;
   public:
-  void clear_blake2b();
-  const std::string& blake2b() const;
-  template <typename ArgT0 = const std::string&, typename... ArgT>
-  void set_blake2b(ArgT0&& arg0, ArgT... args);
-  std::string* mutable_blake2b();
-  PROTOBUF_NODISCARD std::string* release_blake2b();
-  void set_allocated_blake2b(std::string* blake2b);
+  void clear_id();
+  uint32_t id() const;
+  void set_id(uint32_t value);
   private:
-  const std::string& _internal_blake2b() const;
-  inline PROTOBUF_ALWAYS_INLINE void _internal_set_blake2b(const std::string& value);
-  std::string* _internal_mutable_blake2b();
+  uint32_t _internal_id() const;
+  void _internal_set_id(uint32_t value);
   public:
 
-  void clear_csum();
-  CsumCase csum_case() const;
-  // @@protoc_insertion_point(class_scope:proto.Ref_count)
+  // @@protoc_insertion_point(class_scope:proto.Zstd_dictionary)
  private:
   class _Internal;
-  void set_has_xxhash();
-  void set_has_blake2b();
-
-  inline bool has_csum() const;
-  inline void clear_has_csum();
 
   // helper for ByteSizeLong()
   size_t RequiredFieldsByteSizeFallback() const;
@@ -1941,18 +2964,8 @@ class Ref_count final :
   typedef void DestructorSkippable_;
   ::PROTOBUF_NAMESPACE_ID::internal::HasBits<1> _has_bits_;
   mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
-  uint64_t from_;
-  uint64_t to_;
-  uint64_t ref_count_;
-  uint64_t space_taken_;
-  union CsumUnion {
-    constexpr CsumUnion() : _constinit_{} {}
-      ::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized _constinit_;
-    uint64_t xxhash_;
-    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr blake2b_;
-  } csum_;
-  uint32_t _oneof_case_[1];
-
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr data_;
+  uint32_t id_;
   friend struct ::TableStruct_format_2eproto;
 };
 // -------------------------------------------------------------------
@@ -2003,7 +3016,7 @@ class Catalogue final :
                &_Catalogue_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
-    10;
+    14;
 
   friend void swap(Catalogue& a, Catalogue& b) {
     a.Swap(&b);
@@ -2069,6 +3082,7 @@ class Catalogue final :
   enum : int {
     kStateFilesFieldNumber = 1,
     kContentFilesFieldNumber = 2,
+    kDictionariesFieldNumber = 3,
   };
   // repeated .proto.State_file state_files = 1;
   int state_files_size() const;
@@ -2106,6 +3120,24 @@ class Catalogue final :
   const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::proto::Content_file >&
       content_files() const;
 
+  // repeated .proto.Zstd_dictionary dictionaries = 3;
+  int dictionaries_size() const;
+  private:
+  int _internal_dictionaries_size() const;
+  public:
+  void clear_dictionaries();
+  ::proto::Zstd_dictionary* mutable_dictionaries(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::proto::Zstd_dictionary >*
+      mutable_dictionaries();
+  private:
+  const ::proto::Zstd_dictionary& _internal_dictionaries(int index) const;
+  ::proto::Zstd_dictionary* _internal_add_dictionaries();
+  public:
+  const ::proto::Zstd_dictionary& dictionaries(int index) const;
+  ::proto::Zstd_dictionary* add_dictionaries();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::proto::Zstd_dictionary >&
+      dictionaries() const;
+
   // @@protoc_insertion_point(class_scope:proto.Catalogue)
  private:
   class _Internal;
@@ -2115,6 +3147,7 @@ class Catalogue final :
   typedef void DestructorSkippable_;
   ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::proto::State_file > state_files_;
   ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::proto::Content_file > content_files_;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::proto::Zstd_dictionary > dictionaries_;
   mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
   friend struct ::TableStruct_format_2eproto;
 };
@@ -2166,7 +3199,7 @@ class Catalog_header final :
                &_Catalog_header_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
-    11;
+    15;
 
   friend void swap(Catalog_header& a, Catalog_header& b) {
     a.Swap(&b);
@@ -2273,51 +3306,247 @@ class Catalog_header final :
 #endif  // __GNUC__
 // ZSTD_Compression_filter
 
+// optional uint32 window_log = 1;
+inline bool ZSTD_Compression_filter::_internal_has_window_log() const {
+  bool value = (_has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool ZSTD_Compression_filter::has_window_log() const {
+  return _internal_has_window_log();
+}
+inline void ZSTD_Compression_filter::clear_window_log() {
+  window_log_ = 0u;
+  _has_bits_[0] &= ~0x00000001u;
+}
+inline uint32_t ZSTD_Compression_filter::_internal_window_log() const {
+  return window_log_;
+}
+inline uint32_t ZSTD_Compression_filter::window_log() const {
+  // @@protoc_insertion_point(field_get:proto.ZSTD_Compression_filter.window_log)
+  return _internal_window_log();
+}
+inline void ZSTD_Compression_filter::_internal_set_window_log(uint32_t value) {
+  _has_bits_[0] |= 0x00000001u;
+  window_log_ = value;
+}
+inline void ZSTD_Compression_filter::set_window_log(uint32_t value) {
+  _internal_set_window_log(value);
+  // @@protoc_insertion_point(field_set:proto.ZSTD_Compression_filter.window_log)
+}
+
+// optional uint32 dictionary_id = 2;
+inline bool ZSTD_Compression_filter::_internal_has_dictionary_id() const {
+  bool value = (_has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool ZSTD_Compression_filter::has_dictionary_id() const {
+  return _internal_has_dictionary_id();
+}
+inline void ZSTD_Compression_filter::clear_dictionary_id() {
+  dictionary_id_ = 0u;
+  _has_bits_[0] &= ~0x00000002u;
+}
+inline uint32_t ZSTD_Compression_filter::_internal_dictionary_id() const {
+  return dictionary_id_;
+}
+inline uint32_t ZSTD_Compression_filter::dictionary_id() const {
+  // @@protoc_insertion_point(field_get:proto.ZSTD_Compression_filter.dictionary_id)
+  return _internal_dictionary_id();
+}
+inline void ZSTD_Compression_filter::_internal_set_dictionary_id(uint32_t value) {
+  _has_bits_[0] |= 0x00000002u;
+  dictionary_id_ = value;
+}
+inline void ZSTD_Compression_filter::set_dictionary_id(uint32_t value) {
+  _internal_set_dictionary_id(value);
+  // @@protoc_insertion_point(field_set:proto.ZSTD_Compression_filter.dictionary_id)
+}
+
 // -------------------------------------------------------------------
 
 // Chapoly_Encryption_filter
 
 // required bytes iv = 1;
-inline bool Chapoly_Encryption_filter::_internal_has_iv() const {
+inline bool Chapoly_Encryption_filter::_internal_has_iv() const {
+  bool value = (_has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool Chapoly_Encryption_filter::has_iv() const {
+  return _internal_has_iv();
+}
+inline void Chapoly_Encryption_filter::clear_iv() {
+  iv_.ClearToEmpty();
+  _has_bits_[0] &= ~0x00000001u;
+}
+inline const std::string& Chapoly_Encryption_filter::iv() const {
+  // @@protoc_insertion_point(field_get:proto.Chapoly_Encryption_filter.iv)
+  return _internal_iv();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void Chapoly_Encryption_filter::set_iv(ArgT0&& arg0, ArgT... args) {
+ _has_bits_[0] |= 0x00000001u;
+ iv_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:proto.Chapoly_Encryption_filter.iv)
+}
+inline std::string* Chapoly_Encryption_filter::mutable_iv() {
+  std::string* _s = _internal_mutable_iv();
+  // @@protoc_insertion_point(field_mutable:proto.Chapoly_Encryption_filter.iv)
+  return _s;
+}
+inline const std::string& Chapoly_Encryption_filter::_internal_iv() const {
+  return iv_.Get();
+}
+inline void Chapoly_Encryption_filter::_internal_set_iv(const std::string& value) {
+  _has_bits_[0] |= 0x00000001u;
+  iv_.Set(value, GetArenaForAllocation());
+}
+inline std::string* Chapoly_Encryption_filter::_internal_mutable_iv() {
+  _has_bits_[0] |= 0x00000001u;
+  return iv_.Mutable(GetArenaForAllocation());
+}
+inline std::string* Chapoly_Encryption_filter::release_iv() {
+  // @@protoc_insertion_point(field_release:proto.Chapoly_Encryption_filter.iv)
+  if (!_internal_has_iv()) {
+    return nullptr;
+  }
+  _has_bits_[0] &= ~0x00000001u;
+  auto* p = iv_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (iv_.IsDefault()) {
+    iv_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void Chapoly_Encryption_filter::set_allocated_iv(std::string* iv) {
+  if (iv != nullptr) {
+    _has_bits_[0] |= 0x00000001u;
+  } else {
+    _has_bits_[0] &= ~0x00000001u;
+  }
+  iv_.SetAllocated(iv, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (iv_.IsDefault()) {
+    iv_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:proto.Chapoly_Encryption_filter.iv)
+}
+
+// optional bytes key = 2;
+inline bool Chapoly_Encryption_filter::_internal_has_key() const {
+  bool value = (_has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool Chapoly_Encryption_filter::has_key() const {
+  return _internal_has_key();
+}
+inline void Chapoly_Encryption_filter::clear_key() {
+  key_.ClearToEmpty();
+  _has_bits_[0] &= ~0x00000002u;
+}
+inline const std::string& Chapoly_Encryption_filter::key() const {
+  // @@protoc_insertion_point(field_get:proto.Chapoly_Encryption_filter.key)
+  return _internal_key();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void Chapoly_Encryption_filter::set_key(ArgT0&& arg0, ArgT... args) {
+ _has_bits_[0] |= 0x00000002u;
+ key_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:proto.Chapoly_Encryption_filter.key)
+}
+inline std::string* Chapoly_Encryption_filter::mutable_key() {
+  std::string* _s = _internal_mutable_key();
+  // @@protoc_insertion_point(field_mutable:proto.Chapoly_Encryption_filter.key)
+  return _s;
+}
+inline const std::string& Chapoly_Encryption_filter::_internal_key() const {
+  return key_.Get();
+}
+inline void Chapoly_Encryption_filter::_internal_set_key(const std::string& value) {
+  _has_bits_[0] |= 0x00000002u;
+  key_.Set(value, GetArenaForAllocation());
+}
+inline std::string* Chapoly_Encryption_filter::_internal_mutable_key() {
+  _has_bits_[0] |= 0x00000002u;
+  return key_.Mutable(GetArenaForAllocation());
+}
+inline std::string* Chapoly_Encryption_filter::release_key() {
+  // @@protoc_insertion_point(field_release:proto.Chapoly_Encryption_filter.key)
+  if (!_internal_has_key()) {
+    return nullptr;
+  }
+  _has_bits_[0] &= ~0x00000002u;
+  auto* p = key_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (key_.IsDefault()) {
+    key_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void Chapoly_Encryption_filter::set_allocated_key(std::string* key) {
+  if (key != nullptr) {
+    _has_bits_[0] |= 0x00000002u;
+  } else {
+    _has_bits_[0] &= ~0x00000002u;
+  }
+  key_.SetAllocated(key, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (key_.IsDefault()) {
+    key_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:proto.Chapoly_Encryption_filter.key)
+}
+
+// -------------------------------------------------------------------
+
+// Chacha_Encryption_filter
+
+// required bytes iv = 1;
+inline bool Chacha_Encryption_filter::_internal_has_iv() const {
   bool value = (_has_bits_[0] & 0x00000001u) != 0;
   return value;
 }
-inline bool Chapoly_Encryption_filter::has_iv() const {
+inline bool Chacha_Encryption_filter::has_iv() const {
   return _internal_has_iv();
 }
-inline void Chapoly_Encryption_filter::clear_iv() {
+inline void Chacha_Encryption_filter::clear_iv() {
   iv_.ClearToEmpty();
   _has_bits_[0] &= ~0x00000001u;
 }
-inline const std::string& Chapoly_Encryption_filter::iv() const {
-  // @@protoc_insertion_point(field_get:proto.Chapoly_Encryption_filter.iv)
+inline const std::string& Chacha_Encryption_filter::iv() const {
+  // @@protoc_insertion_point(field_get:proto.Chacha_Encryption_filter.iv)
   return _internal_iv();
 }
 template <typename ArgT0, typename... ArgT>
 inline PROTOBUF_ALWAYS_INLINE
-void Chapoly_Encryption_filter::set_iv(ArgT0&& arg0, ArgT... args) {
+void Chacha_Encryption_filter::set_iv(ArgT0&& arg0, ArgT... args) {
  _has_bits_[0] |= 0x00000001u;
  iv_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
-  // @@protoc_insertion_point(field_set:proto.Chapoly_Encryption_filter.iv)
+  // @@protoc_insertion_point(field_set:proto.Chacha_Encryption_filter.iv)
 }
-inline std::string* Chapoly_Encryption_filter::mutable_iv() {
+inline std::string* Chacha_Encryption_filter::mutable_iv() {
   std::string* _s = _internal_mutable_iv();
-  // @@protoc_insertion_point(field_mutable:proto.Chapoly_Encryption_filter.iv)
+  // @@protoc_insertion_point(field_mutable:proto.Chacha_Encryption_filter.iv)
   return _s;
 }
-inline const std::string& Chapoly_Encryption_filter::_internal_iv() const {
+inline const std::string& Chacha_Encryption_filter::_internal_iv() const {
   return iv_.Get();
 }
-inline void Chapoly_Encryption_filter::_internal_set_iv(const std::string& value) {
+inline void Chacha_Encryption_filter::_internal_set_iv(const std::string& value) {
   _has_bits_[0] |= 0x00000001u;
   iv_.Set(value, GetArenaForAllocation());
 }
-inline std::string* Chapoly_Encryption_filter::_internal_mutable_iv() {
+inline std::string* Chacha_Encryption_filter::_internal_mutable_iv() {
   _has_bits_[0] |= 0x00000001u;
   return iv_.Mutable(GetArenaForAllocation());
 }
-inline std::string* Chapoly_Encryption_filter::release_iv() {
-  // @@protoc_insertion_point(field_release:proto.Chapoly_Encryption_filter.iv)
+inline std::string* Chacha_Encryption_filter::release_iv() {
+  // @@protoc_insertion_point(field_release:proto.Chacha_Encryption_filter.iv)
   if (!_internal_has_iv()) {
     return nullptr;
   }
@@ -2330,7 +3559,7 @@ inline std::string* Chapoly_Encryption_filter::release_iv() {
 #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   return p;
 }
-inline void Chapoly_Encryption_filter::set_allocated_iv(std::string* iv) {
+inline void Chacha_Encryption_filter::set_allocated_iv(std::string* iv) {
   if (iv != nullptr) {
     _has_bits_[0] |= 0x00000001u;
   } else {
@@ -2342,50 +3571,50 @@ inline void Chapoly_Encryption_filter::set_allocated_iv(std::string* iv) {
     iv_.Set("", GetArenaForAllocation());
   }
 #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  // @@protoc_insertion_point(field_set_allocated:proto.Chapoly_Encryption_filter.iv)
+  // @@protoc_insertion_point(field_set_allocated:proto.Chacha_Encryption_filter.iv)
 }
 
-// optional bytes key = 2;
-inline bool Chapoly_Encryption_filter::_internal_has_key() const {
+// required bytes key = 2;
+inline bool Chacha_Encryption_filter::_internal_has_key() const {
   bool value = (_has_bits_[0] & 0x00000002u) != 0;
   return value;
 }
-inline bool Chapoly_Encryption_filter::has_key() const {
+inline bool Chacha_Encryption_filter::has_key() const {
   return _internal_has_key();
 }
-inline void Chapoly_Encryption_filter::clear_key() {
+inline void Chacha_Encryption_filter::clear_key() {
   key_.ClearToEmpty();
   _has_bits_[0] &= ~0x00000002u;
 }
-inline const std::string& Chapoly_Encryption_filter::key() const {
-  // @@protoc_insertion_point(field_get:proto.Chapoly_Encryption_filter.key)
+inline const std::string& Chacha_Encryption_filter::key() const {
+  // @@protoc_insertion_point(field_get:proto.Chacha_Encryption_filter.key)
   return _internal_key();
 }
 template <typename ArgT0, typename... ArgT>
 inline PROTOBUF_ALWAYS_INLINE
-void Chapoly_Encryption_filter::set_key(ArgT0&& arg0, ArgT... args) {
+void Chacha_Encryption_filter::set_key(ArgT0&& arg0, ArgT... args) {
  _has_bits_[0] |= 0x00000002u;
  key_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
-  // @@protoc_insertion_point(field_set:proto.Chapoly_Encryption_filter.key)
+  // @@protoc_insertion_point(field_set:proto.Chacha_Encryption_filter.key)
 }
-inline std::string* Chapoly_Encryption_filter::mutable_key() {
+inline std::string* Chacha_Encryption_filter::mutable_key() {
   std::string* _s = _internal_mutable_key();
-  // @@protoc_insertion_point(field_mutable:proto.Chapoly_Encryption_filter.key)
+  // @@protoc_insertion_point(field_mutable:proto.Chacha_Encryption_filter.key)
   return _s;
 }
-inline const std::string& Chapoly_Encryption_filter::_internal_key() const {
+inline const std::string& Chacha_Encryption_filter::_internal_key() const {
   return key_.Get();
 }
-inline void Chapoly_Encryption_filter::_internal_set_key(const std::string& value) {
+inline void Chacha_Encryption_filter::_internal_set_key(const std::string& value) {
   _has_bits_[0] |= 0x00000002u;
   key_.Set(value, GetArenaForAllocation());
 }
-inline std::string* Chapoly_Encryption_filter::_internal_mutable_key() {
+inline std::string* Chacha_Encryption_filter::_internal_mutable_key() {
   _has_bits_[0] |= 0x00000002u;
   return key_.Mutable(GetArenaForAllocation());
 }
-inline std::string* Chapoly_Encryption_filter::release_key() {
-  // @@protoc_insertion_point(field_release:proto.Chapoly_Encryption_filter.key)
+inline std::string* Chacha_Encryption_filter::release_key() {
+  // @@protoc_insertion_point(field_release:proto.Chacha_Encryption_filter.key)
   if (!_internal_has_key()) {
     return nullptr;
   }
@@ -2398,7 +3627,7 @@ inline std::string* Chapoly_Encryption_filter::release_key() {
 #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   return p;
 }
-inline void Chapoly_Encryption_filter::set_allocated_key(std::string* key) {
+inline void Chacha_Encryption_filter::set_allocated_key(std::string* key) {
   if (key != nullptr) {
     _has_bits_[0] |= 0x00000002u;
   } else {
@@ -2410,54 +3639,54 @@ inline void Chapoly_Encryption_filter::set_allocated_key(std::string* key) {
     key_.Set("", GetArenaForAllocation());
   }
 #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  // @@protoc_insertion_point(field_set_allocated:proto.Chapoly_Encryption_filter.key)
+  // @@protoc_insertion_point(field_set_allocated:proto.Chacha_Encryption_filter.key)
 }
 
 // -------------------------------------------------------------------
 
-// Chacha_Encryption_filter
+// Aes_Encryption_filter
 
 // required bytes iv = 1;
-inline bool Chacha_Encryption_filter::_internal_has_iv() const {
+inline bool Aes_Encryption_filter::_internal_has_iv() const {
   bool value = (_has_bits_[0] & 0x00000001u) != 0;
   return value;
 }
-inline bool Chacha_Encryption_filter::has_iv() const {
+inline bool Aes_Encryption_filter::has_iv() const {
   return _internal_has_iv();
 }
-inline void Chacha_Encryption_filter::clear_iv() {
+inline void Aes_Encryption_filter::clear_iv() {
   iv_.ClearToEmpty();
   _has_bits_[0] &= ~0x00000001u;
 }
-inline const std::string& Chacha_Encryption_filter::iv() const {
-  // @@protoc_insertion_point(field_get:proto.Chacha_Encryption_filter.iv)
+inline const std::string& Aes_Encryption_filter::iv() const {
+  // @@protoc_insertion_point(field_get:proto.Aes_Encryption_filter.iv)
   return _internal_iv();
 }
 template <typename ArgT0, typename... ArgT>
 inline PROTOBUF_ALWAYS_INLINE
-void Chacha_Encryption_filter::set_iv(ArgT0&& arg0, ArgT... args) {
+void Aes_Encryption_filter::set_iv(ArgT0&& arg0, ArgT... args) {
  _has_bits_[0] |= 0x00000001u;
  iv_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
-  // @@protoc_insertion_point(field_set:proto.Chacha_Encryption_filter.iv)
+  // @@protoc_insertion_point(field_set:proto.Aes_Encryption_filter.iv)
 }
-inline std::string* Chacha_Encryption_filter::mutable_iv() {
+inline std::string* Aes_Encryption_filter::mutable_iv() {
   std::string* _s = _internal_mutable_iv();
-  // @@protoc_insertion_point(field_mutable:proto.Chacha_Encryption_filter.iv)
+  // @@protoc_insertion_point(field_mutable:proto.Aes_Encryption_filter.iv)
   return _s;
 }
-inline const std::string& Chacha_Encryption_filter::_internal_iv() const {
+inline const std::string& Aes_Encryption_filter::_internal_iv() const {
   return iv_.Get();
 }
-inline void Chacha_Encryption_filter::_internal_set_iv(const std::string& value) {
+inline void Aes_Encryption_filter::_internal_set_iv(const std::string& value) {
   _has_bits_[0] |= 0x00000001u;
   iv_.Set(value, GetArenaForAllocation());
 }
-inline std::string* Chacha_Encryption_filter::_internal_mutable_iv() {
+inline std::string* Aes_Encryption_filter::_internal_mutable_iv() {
   _has_bits_[0] |= 0x00000001u;
   return iv_.Mutable(GetArenaForAllocation());
 }
-inline std::string* Chacha_Encryption_filter::release_iv() {
-  // @@protoc_insertion_point(field_release:proto.Chacha_Encryption_filter.iv)
+inline std::string* Aes_Encryption_filter::release_iv() {
+  // @@protoc_insertion_point(field_release:proto.Aes_Encryption_filter.iv)
   if (!_internal_has_iv()) {
     return nullptr;
   }
@@ -2470,7 +3699,7 @@ inline std::string* Chacha_Encryption_filter::release_iv() {
 #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   return p;
 }
-inline void Chacha_Encryption_filter::set_allocated_iv(std::string* iv) {
+inline void Aes_Encryption_filter::set_allocated_iv(std::string* iv) {
   if (iv != nullptr) {
     _has_bits_[0] |= 0x00000001u;
   } else {
@@ -2482,50 +3711,50 @@ inline void Chacha_Encryption_filter::set_allocated_iv(std::string* iv) {
     iv_.Set("", GetArenaForAllocation());
   }
 #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  // @@protoc_insertion_point(field_set_allocated:proto.Chacha_Encryption_filter.iv)
+  // @@protoc_insertion_point(field_set_allocated:proto.Aes_Encryption_filter.iv)
 }
 
-// required bytes key = 2;
-inline bool Chacha_Encryption_filter::_internal_has_key() const {
+// optional bytes key = 2;
+inline bool Aes_Encryption_filter::_internal_has_key() const {
   bool value = (_has_bits_[0] & 0x00000002u) != 0;
   return value;
 }
-inline bool Chacha_Encryption_filter::has_key() const {
+inline bool Aes_Encryption_filter::has_key() const {
   return _internal_has_key();
 }
-inline void Chacha_Encryption_filter::clear_key() {
+inline void Aes_Encryption_filter::clear_key() {
   key_.ClearToEmpty();
   _has_bits_[0] &= ~0x00000002u;
 }
-inline const std::string& Chacha_Encryption_filter::key() const {
-  // @@protoc_insertion_point(field_get:proto.Chacha_Encryption_filter.key)
+inline const std::string& Aes_Encryption_filter::key() const {
+  // @@protoc_insertion_point(field_get:proto.Aes_Encryption_filter.key)
   return _internal_key();
 }
 template <typename ArgT0, typename... ArgT>
 inline PROTOBUF_ALWAYS_INLINE
-void Chacha_Encryption_filter::set_key(ArgT0&& arg0, ArgT... args) {
+void Aes_Encryption_filter::set_key(ArgT0&& arg0, ArgT... args) {
  _has_bits_[0] |= 0x00000002u;
  key_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
-  // @@protoc_insertion_point(field_set:proto.Chacha_Encryption_filter.key)
+  // @@protoc_insertion_point(field_set:proto.Aes_Encryption_filter.key)
 }
-inline std::string* Chacha_Encryption_filter::mutable_key() {
+inline std::string* Aes_Encryption_filter::mutable_key() {
   std::string* _s = _internal_mutable_key();
-  // @@protoc_insertion_point(field_mutable:proto.Chacha_Encryption_filter.key)
+  // @@protoc_insertion_point(field_mutable:proto.Aes_Encryption_filter.key)
   return _s;
 }
-inline const std::string& Chacha_Encryption_filter::_internal_key() const {
+inline const std::string& Aes_Encryption_filter::_internal_key() const {
   return key_.Get();
 }
-inline void Chacha_Encryption_filter::_internal_set_key(const std::string& value) {
+inline void Aes_Encryption_filter::_internal_set_key(const std::string& value) {
   _has_bits_[0] |= 0x00000002u;
   key_.Set(value, GetArenaForAllocation());
 }
-inline std::string* Chacha_Encryption_filter::_internal_mutable_key() {
+inline std::string* Aes_Encryption_filter::_internal_mutable_key() {
   _has_bits_[0] |= 0x00000002u;
   return key_.Mutable(GetArenaForAllocation());
 }
-inline std::string* Chacha_Encryption_filter::release_key() {
-  // @@protoc_insertion_point(field_release:proto.Chacha_Encryption_filter.key)
+inline std::string* Aes_Encryption_filter::release_key() {
+  // @@protoc_insertion_point(field_release:proto.Aes_Encryption_filter.key)
   if (!_internal_has_key()) {
     return nullptr;
   }
@@ -2538,7 +3767,7 @@ inline std::string* Chacha_Encryption_filter::release_key() {
 #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
   return p;
 }
-inline void Chacha_Encryption_filter::set_allocated_key(std::string* key) {
+inline void Aes_Encryption_filter::set_allocated_key(std::string* key) {
   if (key != nullptr) {
     _has_bits_[0] |= 0x00000002u;
   } else {
@@ -2550,7 +3779,7 @@ inline void Chacha_Encryption_filter::set_allocated_key(std::string* key) {
     key_.Set("", GetArenaForAllocation());
   }
 #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  // @@protoc_insertion_point(field_set_allocated:proto.Chacha_Encryption_filter.key)
+  // @@protoc_insertion_point(field_set_allocated:proto.Aes_Encryption_filter.key)
 }
 
 // -------------------------------------------------------------------
@@ -2701,97 +3930,319 @@ inline ::proto::Chapoly_Encryption_filter* Filters::unsafe_arena_release_chapoly
 }
 inline void Filters::unsafe_arena_set_allocated_chapoly_encryption(::proto::Chapoly_Encryption_filter* chapoly_encryption) {
   clear_encryption();
-  if (chapoly_encryption) {
-    set_has_chapoly_encryption();
-    encryption_.chapoly_encryption_ = chapoly_encryption;
+  if (chapoly_encryption) {
+    set_has_chapoly_encryption();
+    encryption_.chapoly_encryption_ = chapoly_encryption;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:proto.Filters.chapoly_encryption)
+}
+inline ::proto::Chapoly_Encryption_filter* Filters::_internal_mutable_chapoly_encryption() {
+  if (!_internal_has_chapoly_encryption()) {
+    clear_encryption();
+    set_has_chapoly_encryption();
+    encryption_.chapoly_encryption_ = CreateMaybeMessage< ::proto::Chapoly_Encryption_filter >(GetArenaForAllocation());
+  }
+  return encryption_.chapoly_encryption_;
+}
+inline ::proto::Chapoly_Encryption_filter* Filters::mutable_chapoly_encryption() {
+  ::proto::Chapoly_Encryption_filter* _msg = _internal_mutable_chapoly_encryption();
+  // @@protoc_insertion_point(field_mutable:proto.Filters.chapoly_encryption)
+  return _msg;
+}
+
+// .proto.Chacha_Encryption_filter chacha_encryption = 3;
+inline bool Filters::_internal_has_chacha_encryption() const {
+  return encryption_case() == kChachaEncryption;
+}
+inline bool Filters::has_chacha_encryption() const {
+  return _internal_has_chacha_encryption();
+}
+inline void Filters::set_has_chacha_encryption() {
+  _oneof_case_[0] = kChachaEncryption;
+}
+inline void Filters::clear_chacha_encryption() {
+  if (_internal_has_chacha_encryption()) {
+    if (GetArenaForAllocation() == nullptr) {
+      delete encryption_.chacha_encryption_;
+    }
+    clear_has_encryption();
+  }
+}
+inline ::proto::Chacha_Encryption_filter* Filters::release_chacha_encryption() {
+  // @@protoc_insertion_point(field_release:proto.Filters.chacha_encryption)
+  if (_internal_has_chacha_encryption()) {
+    clear_has_encryption();
+    ::proto::Chacha_Encryption_filter* temp = encryption_.chacha_encryption_;
+    if (GetArenaForAllocation() != nullptr) {
+      temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+    }
+    encryption_.chacha_encryption_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline const ::proto::Chacha_Encryption_filter& Filters::_internal_chacha_encryption() const {
+  return _internal_has_chacha_encryption()
+      ? *encryption_.chacha_encryption_
+      : reinterpret_cast< ::proto::Chacha_Encryption_filter&>(::proto::_Chacha_Encryption_filter_default_instance_);
+}
+inline const ::proto::Chacha_Encryption_filter& Filters::chacha_encryption() const {
+  // @@protoc_insertion_point(field_get:proto.Filters.chacha_encryption)
+  return _internal_chacha_encryption();
+}
+inline ::proto::Chacha_Encryption_filter* Filters::unsafe_arena_release_chacha_encryption() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:proto.Filters.chacha_encryption)
+  if (_internal_has_chacha_encryption()) {
+    clear_has_encryption();
+    ::proto::Chacha_Encryption_filter* temp = encryption_.chacha_encryption_;
+    encryption_.chacha_encryption_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline void Filters::unsafe_arena_set_allocated_chacha_encryption(::proto::Chacha_Encryption_filter* chacha_encryption) {
+  clear_encryption();
+  if (chacha_encryption) {
+    set_has_chacha_encryption();
+    encryption_.chacha_encryption_ = chacha_encryption;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:proto.Filters.chacha_encryption)
+}
+inline ::proto::Chacha_Encryption_filter* Filters::_internal_mutable_chacha_encryption() {
+  if (!_internal_has_chacha_encryption()) {
+    clear_encryption();
+    set_has_chacha_encryption();
+    encryption_.chacha_encryption_ = CreateMaybeMessage< ::proto::Chacha_Encryption_filter >(GetArenaForAllocation());
+  }
+  return encryption_.chacha_encryption_;
+}
+inline ::proto::Chacha_Encryption_filter* Filters::mutable_chacha_encryption() {
+  ::proto::Chacha_Encryption_filter* _msg = _internal_mutable_chacha_encryption();
+  // @@protoc_insertion_point(field_mutable:proto.Filters.chacha_encryption)
+  return _msg;
+}
+
+// .proto.Chapoly_Encryption_filter chapoly_stream_encryption = 4;
+inline bool Filters::_internal_has_chapoly_stream_encryption() const {
+  return encryption_case() == kChapolyStreamEncryption;
+}
+inline bool Filters::has_chapoly_stream_encryption() const {
+  return _internal_has_chapoly_stream_encryption();
+}
+inline void Filters::set_has_chapoly_stream_encryption() {
+  _oneof_case_[0] = kChapolyStreamEncryption;
+}
+inline void Filters::clear_chapoly_stream_encryption() {
+  if (_internal_has_chapoly_stream_encryption()) {
+    if (GetArenaForAllocation() == nullptr) {
+      delete encryption_.chapoly_stream_encryption_;
+    }
+    clear_has_encryption();
+  }
+}
+inline ::proto::Chapoly_Encryption_filter* Filters::release_chapoly_stream_encryption() {
+  // @@protoc_insertion_point(field_release:proto.Filters.chapoly_stream_encryption)
+  if (_internal_has_chapoly_stream_encryption()) {
+    clear_has_encryption();
+    ::proto::Chapoly_Encryption_filter* temp = encryption_.chapoly_stream_encryption_;
+    if (GetArenaForAllocation() != nullptr) {
+      temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+    }
+    encryption_.chapoly_stream_encryption_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline const ::proto::Chapoly_Encryption_filter& Filters::_internal_chapoly_stream_encryption() const {
+  return _internal_has_chapoly_stream_encryption()
+      ? *encryption_.chapoly_stream_encryption_
+      : reinterpret_cast< ::proto::Chapoly_Encryption_filter&>(::proto::_Chapoly_Encryption_filter_default_instance_);
+}
+inline const ::proto::Chapoly_Encryption_filter& Filters::chapoly_stream_encryption() const {
+  // @@protoc_insertion_point(field_get:proto.Filters.chapoly_stream_encryption)
+  return _internal_chapoly_stream_encryption();
+}
+inline ::proto::Chapoly_Encryption_filter* Filters::unsafe_arena_release_chapoly_stream_encryption() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:proto.Filters.chapoly_stream_encryption)
+  if (_internal_has_chapoly_stream_encryption()) {
+    clear_has_encryption();
+    ::proto::Chapoly_Encryption_filter* temp = encryption_.chapoly_stream_encryption_;
+    encryption_.chapoly_stream_encryption_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline void Filters::unsafe_arena_set_allocated_chapoly_stream_encryption(::proto::Chapoly_Encryption_filter* chapoly_stream_encryption) {
+  clear_encryption();
+  if (chapoly_stream_encryption) {
+    set_has_chapoly_stream_encryption();
+    encryption_.chapoly_stream_encryption_ = chapoly_stream_encryption;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:proto.Filters.chapoly_stream_encryption)
+}
+inline ::proto::Chapoly_Encryption_filter* Filters::_internal_mutable_chapoly_stream_encryption() {
+  if (!_internal_has_chapoly_stream_encryption()) {
+    clear_encryption();
+    set_has_chapoly_stream_encryption();
+    encryption_.chapoly_stream_encryption_ = CreateMaybeMessage< ::proto::Chapoly_Encryption_filter >(GetArenaForAllocation());
+  }
+  return encryption_.chapoly_stream_encryption_;
+}
+inline ::proto::Chapoly_Encryption_filter* Filters::mutable_chapoly_stream_encryption() {
+  ::proto::Chapoly_Encryption_filter* _msg = _internal_mutable_chapoly_stream_encryption();
+  // @@protoc_insertion_point(field_mutable:proto.Filters.chapoly_stream_encryption)
+  return _msg;
+}
+
+// .proto.Aes_Encryption_filter aes_gcm_stream_encryption = 5;
+inline bool Filters::_internal_has_aes_gcm_stream_encryption() const {
+  return encryption_case() == kAesGcmStreamEncryption;
+}
+inline bool Filters::has_aes_gcm_stream_encryption() const {
+  return _internal_has_aes_gcm_stream_encryption();
+}
+inline void Filters::set_has_aes_gcm_stream_encryption() {
+  _oneof_case_[0] = kAesGcmStreamEncryption;
+}
+inline void Filters::clear_aes_gcm_stream_encryption() {
+  if (_internal_has_aes_gcm_stream_encryption()) {
+    if (GetArenaForAllocation() == nullptr) {
+      delete encryption_.aes_gcm_stream_encryption_;
+    }
+    clear_has_encryption();
+  }
+}
+inline ::proto::Aes_Encryption_filter* Filters::release_aes_gcm_stream_encryption() {
+  // @@protoc_insertion_point(field_release:proto.Filters.aes_gcm_stream_encryption)
+  if (_internal_has_aes_gcm_stream_encryption()) {
+    clear_has_encryption();
+    ::proto::Aes_Encryption_filter* temp = encryption_.aes_gcm_stream_encryption_;
+    if (GetArenaForAllocation() != nullptr) {
+      temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+    }
+    encryption_.aes_gcm_stream_encryption_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline const ::proto::Aes_Encryption_filter& Filters::_internal_aes_gcm_stream_encryption() const {
+  return _internal_has_aes_gcm_stream_encryption()
+      ? *encryption_.aes_gcm_stream_encryption_
+      : reinterpret_cast< ::proto::Aes_Encryption_filter&>(::proto::_Aes_Encryption_filter_default_instance_);
+}
+inline const ::proto::Aes_Encryption_filter& Filters::aes_gcm_stream_encryption() const {
+  // @@protoc_insertion_point(field_get:proto.Filters.aes_gcm_stream_encryption)
+  return _internal_aes_gcm_stream_encryption();
+}
+inline ::proto::Aes_Encryption_filter* Filters::unsafe_arena_release_aes_gcm_stream_encryption() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:proto.Filters.aes_gcm_stream_encryption)
+  if (_internal_has_aes_gcm_stream_encryption()) {
+    clear_has_encryption();
+    ::proto::Aes_Encryption_filter* temp = encryption_.aes_gcm_stream_encryption_;
+    encryption_.aes_gcm_stream_encryption_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline void Filters::unsafe_arena_set_allocated_aes_gcm_stream_encryption(::proto::Aes_Encryption_filter* aes_gcm_stream_encryption) {
+  clear_encryption();
+  if (aes_gcm_stream_encryption) {
+    set_has_aes_gcm_stream_encryption();
+    encryption_.aes_gcm_stream_encryption_ = aes_gcm_stream_encryption;
   }
-  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:proto.Filters.chapoly_encryption)
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:proto.Filters.aes_gcm_stream_encryption)
 }
-inline ::proto::Chapoly_Encryption_filter* Filters::_internal_mutable_chapoly_encryption() {
-  if (!_internal_has_chapoly_encryption()) {
+inline ::proto::Aes_Encryption_filter* Filters::_internal_mutable_aes_gcm_stream_encryption() {
+  if (!_internal_has_aes_gcm_stream_encryption()) {
     clear_encryption();
-    set_has_chapoly_encryption();
-    encryption_.chapoly_encryption_ = CreateMaybeMessage< ::proto::Chapoly_Encryption_filter >(GetArenaForAllocation());
+    set_has_aes_gcm_stream_encryption();
+    encryption_.aes_gcm_stream_encryption_ = CreateMaybeMessage< ::proto::Aes_Encryption_filter >(GetArenaForAllocation());
   }
-  return encryption_.chapoly_encryption_;
+  return encryption_.aes_gcm_stream_encryption_;
 }
-inline ::proto::Chapoly_Encryption_filter* Filters::mutable_chapoly_encryption() {
-  ::proto::Chapoly_Encryption_filter* _msg = _internal_mutable_chapoly_encryption();
-  // @@protoc_insertion_point(field_mutable:proto.Filters.chapoly_encryption)
+inline ::proto::Aes_Encryption_filter* Filters::mutable_aes_gcm_stream_encryption() {
+  ::proto::Aes_Encryption_filter* _msg = _internal_mutable_aes_gcm_stream_encryption();
+  // @@protoc_insertion_point(field_mutable:proto.Filters.aes_gcm_stream_encryption)
   return _msg;
 }
 
-// .proto.Chacha_Encryption_filter chacha_encryption = 3;
-inline bool Filters::_internal_has_chacha_encryption() const {
-  return encryption_case() == kChachaEncryption;
+// .proto.Aes_Encryption_filter aes_ctr_encryption = 6;
+inline bool Filters::_internal_has_aes_ctr_encryption() const {
+  return encryption_case() == kAesCtrEncryption;
 }
-inline bool Filters::has_chacha_encryption() const {
-  return _internal_has_chacha_encryption();
+inline bool Filters::has_aes_ctr_encryption() const {
+  return _internal_has_aes_ctr_encryption();
 }
-inline void Filters::set_has_chacha_encryption() {
-  _oneof_case_[0] = kChachaEncryption;
+inline void Filters::set_has_aes_ctr_encryption() {
+  _oneof_case_[0] = kAesCtrEncryption;
 }
-inline void Filters::clear_chacha_encryption() {
-  if (_internal_has_chacha_encryption()) {
+inline void Filters::clear_aes_ctr_encryption() {
+  if (_internal_has_aes_ctr_encryption()) {
     if (GetArenaForAllocation() == nullptr) {
-      delete encryption_.chacha_encryption_;
+      delete encryption_.aes_ctr_encryption_;
     }
     clear_has_encryption();
   }
 }
-inline ::proto::Chacha_Encryption_filter* Filters::release_chacha_encryption() {
-  // @@protoc_insertion_point(field_release:proto.Filters.chacha_encryption)
-  if (_internal_has_chacha_encryption()) {
+inline ::proto::Aes_Encryption_filter* Filters::release_aes_ctr_encryption() {
+  // @@protoc_insertion_point(field_release:proto.Filters.aes_ctr_encryption)
+  if (_internal_has_aes_ctr_encryption()) {
     clear_has_encryption();
-    ::proto::Chacha_Encryption_filter* temp = encryption_.chacha_encryption_;
+    ::proto::Aes_Encryption_filter* temp = encryption_.aes_ctr_encryption_;
     if (GetArenaForAllocation() != nullptr) {
       temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
     }
-    encryption_.chacha_encryption_ = nullptr;
+    encryption_.aes_ctr_encryption_ = nullptr;
     return temp;
   } else {
     return nullptr;
   }
 }
-inline const ::proto::Chacha_Encryption_filter& Filters::_internal_chacha_encryption() const {
-  return _internal_has_chacha_encryption()
-      ? *encryption_.chacha_encryption_
-      : reinterpret_cast< ::proto::Chacha_Encryption_filter&>(::proto::_Chacha_Encryption_filter_default_instance_);
+inline const ::proto::Aes_Encryption_filter& Filters::_internal_aes_ctr_encryption() const {
+  return _internal_has_aes_ctr_encryption()
+      ? *encryption_.aes_ctr_encryption_
+      : reinterpret_cast< ::proto::Aes_Encryption_filter&>(::proto::_Aes_Encryption_filter_default_instance_);
 }
-inline const ::proto::Chacha_Encryption_filter& Filters::chacha_encryption() const {
-  // @@protoc_insertion_point(field_get:proto.Filters.chacha_encryption)
-  return _internal_chacha_encryption();
+inline const ::proto::Aes_Encryption_filter& Filters::aes_ctr_encryption() const {
+  // @@protoc_insertion_point(field_get:proto.Filters.aes_ctr_encryption)
+  return _internal_aes_ctr_encryption();
 }
-inline ::proto::Chacha_Encryption_filter* Filters::unsafe_arena_release_chacha_encryption() {
-  // @@protoc_insertion_point(field_unsafe_arena_release:proto.Filters.chacha_encryption)
-  if (_internal_has_chacha_encryption()) {
+inline ::proto::Aes_Encryption_filter* Filters::unsafe_arena_release_aes_ctr_encryption() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:proto.Filters.aes_ctr_encryption)
+  if (_internal_has_aes_ctr_encryption()) {
     clear_has_encryption();
-    ::proto::Chacha_Encryption_filter* temp = encryption_.chacha_encryption_;
-    encryption_.chacha_encryption_ = nullptr;
+    ::proto::Aes_Encryption_filter* temp = encryption_.aes_ctr_encryption_;
+    encryption_.aes_ctr_encryption_ = nullptr;
     return temp;
   } else {
     return nullptr;
   }
 }
-inline void Filters::unsafe_arena_set_allocated_chacha_encryption(::proto::Chacha_Encryption_filter* chacha_encryption) {
+inline void Filters::unsafe_arena_set_allocated_aes_ctr_encryption(::proto::Aes_Encryption_filter* aes_ctr_encryption) {
   clear_encryption();
-  if (chacha_encryption) {
-    set_has_chacha_encryption();
-    encryption_.chacha_encryption_ = chacha_encryption;
+  if (aes_ctr_encryption) {
+    set_has_aes_ctr_encryption();
+    encryption_.aes_ctr_encryption_ = aes_ctr_encryption;
   }
-  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:proto.Filters.chacha_encryption)
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:proto.Filters.aes_ctr_encryption)
 }
-inline ::proto::Chacha_Encryption_filter* Filters::_internal_mutable_chacha_encryption() {
-  if (!_internal_has_chacha_encryption()) {
+inline ::proto::Aes_Encryption_filter* Filters::_internal_mutable_aes_ctr_encryption() {
+  if (!_internal_has_aes_ctr_encryption()) {
     clear_encryption();
-    set_has_chacha_encryption();
-    encryption_.chacha_encryption_ = CreateMaybeMessage< ::proto::Chacha_Encryption_filter >(GetArenaForAllocation());
+    set_has_aes_ctr_encryption();
+    encryption_.aes_ctr_encryption_ = CreateMaybeMessage< ::proto::Aes_Encryption_filter >(GetArenaForAllocation());
   }
-  return encryption_.chacha_encryption_;
+  return encryption_.aes_ctr_encryption_;
 }
-inline ::proto::Chacha_Encryption_filter* Filters::mutable_chacha_encryption() {
-  ::proto::Chacha_Encryption_filter* _msg = _internal_mutable_chacha_encryption();
-  // @@protoc_insertion_point(field_mutable:proto.Filters.chacha_encryption)
+inline ::proto::Aes_Encryption_filter* Filters::mutable_aes_ctr_encryption() {
+  ::proto::Aes_Encryption_filter* _msg = _internal_mutable_aes_ctr_encryption();
+  // @@protoc_insertion_point(field_mutable:proto.Filters.aes_ctr_encryption)
   return _msg;
 }
 
@@ -2906,6 +4357,182 @@ inline void Ref_to_refcount::set_from(uint64_t value) {
 
 // -------------------------------------------------------------------
 
+// Inode
+
+// required uint64 device = 1;
+inline bool Inode::_internal_has_device() const {
+  bool value = (_has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool Inode::has_device() const {
+  return _internal_has_device();
+}
+inline void Inode::clear_device() {
+  device_ = uint64_t{0u};
+  _has_bits_[0] &= ~0x00000001u;
+}
+inline uint64_t Inode::_internal_device() const {
+  return device_;
+}
+inline uint64_t Inode::device() const {
+  // @@protoc_insertion_point(field_get:proto.Inode.device)
+  return _internal_device();
+}
+inline void Inode::_internal_set_device(uint64_t value) {
+  _has_bits_[0] |= 0x00000001u;
+  device_ = value;
+}
+inline void Inode::set_device(uint64_t value) {
+  _internal_set_device(value);
+  // @@protoc_insertion_point(field_set:proto.Inode.device)
+}
+
+// required uint64 number = 2;
+inline bool Inode::_internal_has_number() const {
+  bool value = (_has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool Inode::has_number() const {
+  return _internal_has_number();
+}
+inline void Inode::clear_number() {
+  number_ = uint64_t{0u};
+  _has_bits_[0] &= ~0x00000002u;
+}
+inline uint64_t Inode::_internal_number() const {
+  return number_;
+}
+inline uint64_t Inode::number() const {
+  // @@protoc_insertion_point(field_get:proto.Inode.number)
+  return _internal_number();
+}
+inline void Inode::_internal_set_number(uint64_t value) {
+  _has_bits_[0] |= 0x00000002u;
+  number_ = value;
+}
+inline void Inode::set_number(uint64_t value) {
+  _internal_set_number(value);
+  // @@protoc_insertion_point(field_set:proto.Inode.number)
+}
+
+// required uint64 size = 3;
+inline bool Inode::_internal_has_size() const {
+  bool value = (_has_bits_[0] & 0x00000004u) != 0;
+  return value;
+}
+inline bool Inode::has_size() const {
+  return _internal_has_size();
+}
+inline void Inode::clear_size() {
+  size_ = uint64_t{0u};
+  _has_bits_[0] &= ~0x00000004u;
+}
+inline uint64_t Inode::_internal_size() const {
+  return size_;
+}
+inline uint64_t Inode::size() const {
+  // @@protoc_insertion_point(field_get:proto.Inode.size)
+  return _internal_size();
+}
+inline void Inode::_internal_set_size(uint64_t value) {
+  _has_bits_[0] |= 0x00000004u;
+  size_ = value;
+}
+inline void Inode::set_size(uint64_t value) {
+  _internal_set_size(value);
+  // @@protoc_insertion_point(field_set:proto.Inode.size)
+}
+
+// required uint64 changed_nanoseconds = 4;
+inline bool Inode::_internal_has_changed_nanoseconds() const {
+  bool value = (_has_bits_[0] & 0x00000008u) != 0;
+  return value;
+}
+inline bool Inode::has_changed_nanoseconds() const {
+  return _internal_has_changed_nanoseconds();
+}
+inline void Inode::clear_changed_nanoseconds() {
+  changed_nanoseconds_ = uint64_t{0u};
+  _has_bits_[0] &= ~0x00000008u;
+}
+inline uint64_t Inode::_internal_changed_nanoseconds() const {
+  return changed_nanoseconds_;
+}
+inline uint64_t Inode::changed_nanoseconds() const {
+  // @@protoc_insertion_point(field_get:proto.Inode.changed_nanoseconds)
+  return _internal_changed_nanoseconds();
+}
+inline void Inode::_internal_set_changed_nanoseconds(uint64_t value) {
+  _has_bits_[0] |= 0x00000008u;
+  changed_nanoseconds_ = value;
+}
+inline void Inode::set_changed_nanoseconds(uint64_t value) {
+  _internal_set_changed_nanoseconds(value);
+  // @@protoc_insertion_point(field_set:proto.Inode.changed_nanoseconds)
+}
+
+// -------------------------------------------------------------------
+
+// Hole
+
+// required uint64 offset = 1;
+inline bool Hole::_internal_has_offset() const {
+  bool value = (_has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool Hole::has_offset() const {
+  return _internal_has_offset();
+}
+inline void Hole::clear_offset() {
+  offset_ = uint64_t{0u};
+  _has_bits_[0] &= ~0x00000001u;
+}
+inline uint64_t Hole::_internal_offset() const {
+  return offset_;
+}
+inline uint64_t Hole::offset() const {
+  // @@protoc_insertion_point(field_get:proto.Hole.offset)
+  return _internal_offset();
+}
+inline void Hole::_internal_set_offset(uint64_t value) {
+  _has_bits_[0] |= 0x00000001u;
+  offset_ = value;
+}
+inline void Hole::set_offset(uint64_t value) {
+  _internal_set_offset(value);
+  // @@protoc_insertion_point(field_set:proto.Hole.offset)
+}
+
+// required uint64 size = 2;
+inline bool Hole::_internal_has_size() const {
+  bool value = (_has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool Hole::has_size() const {
+  return _internal_has_size();
+}
+inline void Hole::clear_size() {
+  size_ = uint64_t{0u};
+  _has_bits_[0] &= ~0x00000002u;
+}
+inline uint64_t Hole::_internal_size() const {
+  return size_;
+}
+inline uint64_t Hole::size() const {
+  // @@protoc_insertion_point(field_get:proto.Hole.size)
+  return _internal_size();
+}
+inline void Hole::_internal_set_size(uint64_t value) {
+  _has_bits_[0] |= 0x00000002u;
+  size_ = value;
+}
+inline void Hole::set_size(uint64_t value) {
+  _internal_set_size(value);
+  // @@protoc_insertion_point(field_set:proto.Hole.size)
+}
+
+// -------------------------------------------------------------------
+
 // Fs_record
 
 // required string pathname = 1;
@@ -2978,7 +4605,7 @@ inline void Fs_record::set_allocated_pathname(std::string* pathname) {
 
 // required .proto.File_type type = 2;
 inline bool Fs_record::_internal_has_type() const {
-  bool value = (_has_bits_[0] & 0x00000040u) != 0;
+  bool value = (_has_bits_[0] & 0x00000100u) != 0;
   return value;
 }
 inline bool Fs_record::has_type() const {
@@ -2986,7 +4613,7 @@ inline bool Fs_record::has_type() const {
 }
 inline void Fs_record::clear_type() {
   type_ = 0;
-  _has_bits_[0] &= ~0x00000040u;
+  _has_bits_[0] &= ~0x00000100u;
 }
 inline ::proto::File_type Fs_record::_internal_type() const {
   return static_cast< ::proto::File_type >(type_);
@@ -2997,7 +4624,7 @@ inline ::proto::File_type Fs_record::type() const {
 }
 inline void Fs_record::_internal_set_type(::proto::File_type value) {
   assert(::proto::File_type_IsValid(value));
-  _has_bits_[0] |= 0x00000040u;
+  _has_bits_[0] |= 0x00000100u;
   type_ = value;
 }
 inline void Fs_record::set_type(::proto::File_type value) {
@@ -3007,7 +4634,7 @@ inline void Fs_record::set_type(::proto::File_type value) {
 
 // optional uint64 modified_nanoseconds = 3;
 inline bool Fs_record::_internal_has_modified_nanoseconds() const {
-  bool value = (_has_bits_[0] & 0x00000020u) != 0;
+  bool value = (_has_bits_[0] & 0x00000080u) != 0;
   return value;
 }
 inline bool Fs_record::has_modified_nanoseconds() const {
@@ -3015,7 +4642,7 @@ inline bool Fs_record::has_modified_nanoseconds() const {
 }
 inline void Fs_record::clear_modified_nanoseconds() {
   modified_nanoseconds_ = uint64_t{0u};
-  _has_bits_[0] &= ~0x00000020u;
+  _has_bits_[0] &= ~0x00000080u;
 }
 inline uint64_t Fs_record::_internal_modified_nanoseconds() const {
   return modified_nanoseconds_;
@@ -3025,7 +4652,7 @@ inline uint64_t Fs_record::modified_nanoseconds() const {
   return _internal_modified_nanoseconds();
 }
 inline void Fs_record::_internal_set_modified_nanoseconds(uint64_t value) {
-  _has_bits_[0] |= 0x00000020u;
+  _has_bits_[0] |= 0x00000080u;
   modified_nanoseconds_ = value;
 }
 inline void Fs_record::set_modified_nanoseconds(uint64_t value) {
@@ -3035,7 +4662,7 @@ inline void Fs_record::set_modified_nanoseconds(uint64_t value) {
 
 // optional .proto.Ref_to_refcount ref = 4;
 inline bool Fs_record::_internal_has_ref() const {
-  bool value = (_has_bits_[0] & 0x00000010u) != 0;
+  bool value = (_has_bits_[0] & 0x00000020u) != 0;
   PROTOBUF_ASSUME(!value || ref_ != nullptr);
   return value;
 }
@@ -3044,7 +4671,7 @@ inline bool Fs_record::has_ref() const {
 }
 inline void Fs_record::clear_ref() {
   if (ref_ != nullptr) ref_->Clear();
-  _has_bits_[0] &= ~0x00000010u;
+  _has_bits_[0] &= ~0x00000020u;
 }
 inline const ::proto::Ref_to_refcount& Fs_record::_internal_ref() const {
   const ::proto::Ref_to_refcount* p = ref_;
@@ -3062,14 +4689,14 @@ inline void Fs_record::unsafe_arena_set_allocated_ref(
   }
   ref_ = ref;
   if (ref) {
-    _has_bits_[0] |= 0x00000010u;
+    _has_bits_[0] |= 0x00000020u;
   } else {
-    _has_bits_[0] &= ~0x00000010u;
+    _has_bits_[0] &= ~0x00000020u;
   }
   // @@protoc_insertion_point(field_unsafe_arena_set_allocated:proto.Fs_record.ref)
 }
 inline ::proto::Ref_to_refcount* Fs_record::release_ref() {
-  _has_bits_[0] &= ~0x00000010u;
+  _has_bits_[0] &= ~0x00000020u;
   ::proto::Ref_to_refcount* temp = ref_;
   ref_ = nullptr;
 #ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
@@ -3085,13 +4712,13 @@ inline ::proto::Ref_to_refcount* Fs_record::release_ref() {
 }
 inline ::proto::Ref_to_refcount* Fs_record::unsafe_arena_release_ref() {
   // @@protoc_insertion_point(field_release:proto.Fs_record.ref)
-  _has_bits_[0] &= ~0x00000010u;
+  _has_bits_[0] &= ~0x00000020u;
   ::proto::Ref_to_refcount* temp = ref_;
   ref_ = nullptr;
   return temp;
 }
 inline ::proto::Ref_to_refcount* Fs_record::_internal_mutable_ref() {
-  _has_bits_[0] |= 0x00000010u;
+  _has_bits_[0] |= 0x00000020u;
   if (ref_ == nullptr) {
     auto* p = CreateMaybeMessage<::proto::Ref_to_refcount>(GetArenaForAllocation());
     ref_ = p;
@@ -3115,9 +4742,9 @@ inline void Fs_record::set_allocated_ref(::proto::Ref_to_refcount* ref) {
       ref = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
           message_arena, ref, submessage_arena);
     }
-    _has_bits_[0] |= 0x00000010u;
+    _has_bits_[0] |= 0x00000020u;
   } else {
-    _has_bits_[0] &= ~0x00000010u;
+    _has_bits_[0] &= ~0x00000020u;
   }
   ref_ = ref;
   // @@protoc_insertion_point(field_set_allocated:proto.Fs_record.ref)
@@ -3193,7 +4820,7 @@ inline void Fs_record::set_allocated_symlink_target(std::string* symlink_target)
 
 // optional uint32 unix_permissions = 6;
 inline bool Fs_record::_internal_has_unix_permissions() const {
-  bool value = (_has_bits_[0] & 0x00000080u) != 0;
+  bool value = (_has_bits_[0] & 0x00000200u) != 0;
   return value;
 }
 inline bool Fs_record::has_unix_permissions() const {
@@ -3201,7 +4828,7 @@ inline bool Fs_record::has_unix_permissions() const {
 }
 inline void Fs_record::clear_unix_permissions() {
   unix_permissions_ = 0u;
-  _has_bits_[0] &= ~0x00000080u;
+  _has_bits_[0] &= ~0x00000200u;
 }
 inline uint32_t Fs_record::_internal_unix_permissions() const {
   return unix_permissions_;
@@ -3211,7 +4838,7 @@ inline uint32_t Fs_record::unix_permissions() const {
   return _internal_unix_permissions();
 }
 inline void Fs_record::_internal_set_unix_permissions(uint32_t value) {
-  _has_bits_[0] |= 0x00000080u;
+  _has_bits_[0] |= 0x00000200u;
   unix_permissions_ = value;
 }
 inline void Fs_record::set_unix_permissions(uint32_t value) {
@@ -3355,6 +4982,244 @@ inline void Fs_record::set_allocated_posix_default_acl(std::string* posix_defaul
   // @@protoc_insertion_point(field_set_allocated:proto.Fs_record.posix_default_acl)
 }
 
+// repeated .proto.Ref_to_refcount chunks = 9;
+inline int Fs_record::_internal_chunks_size() const {
+  return chunks_.size();
+}
+inline int Fs_record::chunks_size() const {
+  return _internal_chunks_size();
+}
+inline void Fs_record::clear_chunks() {
+  chunks_.Clear();
+}
+inline ::proto::Ref_to_refcount* Fs_record::mutable_chunks(int index) {
+  // @@protoc_insertion_point(field_mutable:proto.Fs_record.chunks)
+  return chunks_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::proto::Ref_to_refcount >*
+Fs_record::mutable_chunks() {
+  // @@protoc_insertion_point(field_mutable_list:proto.Fs_record.chunks)
+  return &chunks_;
+}
+inline const ::proto::Ref_to_refcount& Fs_record::_internal_chunks(int index) const {
+  return chunks_.Get(index);
+}
+inline const ::proto::Ref_to_refcount& Fs_record::chunks(int index) const {
+  // @@protoc_insertion_point(field_get:proto.Fs_record.chunks)
+  return _internal_chunks(index);
+}
+inline ::proto::Ref_to_refcount* Fs_record::_internal_add_chunks() {
+  return chunks_.Add();
+}
+inline ::proto::Ref_to_refcount* Fs_record::add_chunks() {
+  ::proto::Ref_to_refcount* _add = _internal_add_chunks();
+  // @@protoc_insertion_point(field_add:proto.Fs_record.chunks)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::proto::Ref_to_refcount >&
+Fs_record::chunks() const {
+  // @@protoc_insertion_point(field_list:proto.Fs_record.chunks)
+  return chunks_;
+}
+
+// optional .proto.Inode inode = 10;
+inline bool Fs_record::_internal_has_inode() const {
+  bool value = (_has_bits_[0] & 0x00000040u) != 0;
+  PROTOBUF_ASSUME(!value || inode_ != nullptr);
+  return value;
+}
+inline bool Fs_record::has_inode() const {
+  return _internal_has_inode();
+}
+inline void Fs_record::clear_inode() {
+  if (inode_ != nullptr) inode_->Clear();
+  _has_bits_[0] &= ~0x00000040u;
+}
+inline const ::proto::Inode& Fs_record::_internal_inode() const {
+  const ::proto::Inode* p = inode_;
+  return p != nullptr ? *p : reinterpret_cast<const ::proto::Inode&>(
+      ::proto::_Inode_default_instance_);
+}
+inline const ::proto::Inode& Fs_record::inode() const {
+  // @@protoc_insertion_point(field_get:proto.Fs_record.inode)
+  return _internal_inode();
+}
+inline void Fs_record::unsafe_arena_set_allocated_inode(
+    ::proto::Inode* inode) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(inode_);
+  }
+  inode_ = inode;
+  if (inode) {
+    _has_bits_[0] |= 0x00000040u;
+  } else {
+    _has_bits_[0] &= ~0x00000040u;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:proto.Fs_record.inode)
+}
+inline ::proto::Inode* Fs_record::release_inode() {
+  _has_bits_[0] &= ~0x00000040u;
+  ::proto::Inode* temp = inode_;
+  inode_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::proto::Inode* Fs_record::unsafe_arena_release_inode() {
+  // @@protoc_insertion_point(field_release:proto.Fs_record.inode)
+  _has_bits_[0] &= ~0x00000040u;
+  ::proto::Inode* temp = inode_;
+  inode_ = nullptr;
+  return temp;
+}
+inline ::proto::Inode* Fs_record::_internal_mutable_inode() {
+  _has_bits_[0] |= 0x00000040u;
+  if (inode_ == nullptr) {
+    auto* p = CreateMaybeMessage<::proto::Inode>(GetArenaForAllocation());
+    inode_ = p;
+  }
+  return inode_;
+}
+inline ::proto::Inode* Fs_record::mutable_inode() {
+  ::proto::Inode* _msg = _internal_mutable_inode();
+  // @@protoc_insertion_point(field_mutable:proto.Fs_record.inode)
+  return _msg;
+}
+inline void Fs_record::set_allocated_inode(::proto::Inode* inode) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete inode_;
+  }
+  if (inode) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(inode);
+    if (message_arena != submessage_arena) {
+      inode = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, inode, submessage_arena);
+    }
+    _has_bits_[0] |= 0x00000040u;
+  } else {
+    _has_bits_[0] &= ~0x00000040u;
+  }
+  inode_ = inode;
+  // @@protoc_insertion_point(field_set_allocated:proto.Fs_record.inode)
+}
+
+// optional string hard_link = 11;
+inline bool Fs_record::_internal_has_hard_link() const {
+  bool value = (_has_bits_[0] & 0x00000010u) != 0;
+  return value;
+}
+inline bool Fs_record::has_hard_link() const {
+  return _internal_has_hard_link();
+}
+inline void Fs_record::clear_hard_link() {
+  hard_link_.ClearToEmpty();
+  _has_bits_[0] &= ~0x00000010u;
+}
+inline const std::string& Fs_record::hard_link() const {
+  // @@protoc_insertion_point(field_get:proto.Fs_record.hard_link)
+  return _internal_hard_link();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void Fs_record::set_hard_link(ArgT0&& arg0, ArgT... args) {
+ _has_bits_[0] |= 0x00000010u;
+ hard_link_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:proto.Fs_record.hard_link)
+}
+inline std::string* Fs_record::mutable_hard_link() {
+  std::string* _s = _internal_mutable_hard_link();
+  // @@protoc_insertion_point(field_mutable:proto.Fs_record.hard_link)
+  return _s;
+}
+inline const std::string& Fs_record::_internal_hard_link() const {
+  return hard_link_.Get();
+}
+inline void Fs_record::_internal_set_hard_link(const std::string& value) {
+  _has_bits_[0] |= 0x00000010u;
+  hard_link_.Set(value, GetArenaForAllocation());
+}
+inline std::string* Fs_record::_internal_mutable_hard_link() {
+  _has_bits_[0] |= 0x00000010u;
+  return hard_link_.Mutable(GetArenaForAllocation());
+}
+inline std::string* Fs_record::release_hard_link() {
+  // @@protoc_insertion_point(field_release:proto.Fs_record.hard_link)
+  if (!_internal_has_hard_link()) {
+    return nullptr;
+  }
+  _has_bits_[0] &= ~0x00000010u;
+  auto* p = hard_link_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (hard_link_.IsDefault()) {
+    hard_link_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void Fs_record::set_allocated_hard_link(std::string* hard_link) {
+  if (hard_link != nullptr) {
+    _has_bits_[0] |= 0x00000010u;
+  } else {
+    _has_bits_[0] &= ~0x00000010u;
+  }
+  hard_link_.SetAllocated(hard_link, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (hard_link_.IsDefault()) {
+    hard_link_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:proto.Fs_record.hard_link)
+}
+
+// repeated .proto.Hole holes = 12;
+inline int Fs_record::_internal_holes_size() const {
+  return holes_.size();
+}
+inline int Fs_record::holes_size() const {
+  return _internal_holes_size();
+}
+inline void Fs_record::clear_holes() {
+  holes_.Clear();
+}
+inline ::proto::Hole* Fs_record::mutable_holes(int index) {
+  // @@protoc_insertion_point(field_mutable:proto.Fs_record.holes)
+  return holes_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::proto::Hole >*
+Fs_record::mutable_holes() {
+  // @@protoc_insertion_point(field_mutable_list:proto.Fs_record.holes)
+  return &holes_;
+}
+inline const ::proto::Hole& Fs_record::_internal_holes(int index) const {
+  return holes_.Get(index);
+}
+inline const ::proto::Hole& Fs_record::holes(int index) const {
+  // @@protoc_insertion_point(field_get:proto.Fs_record.holes)
+  return _internal_holes(index);
+}
+inline ::proto::Hole* Fs_record::_internal_add_holes() {
+  return holes_.Add();
+}
+inline ::proto::Hole* Fs_record::add_holes() {
+  ::proto::Hole* _add = _internal_add_holes();
+  // @@protoc_insertion_point(field_add:proto.Fs_record.holes)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::proto::Hole >&
+Fs_record::holes() const {
+  // @@protoc_insertion_point(field_list:proto.Fs_record.holes)
+  return holes_;
+}
+
 // -------------------------------------------------------------------
 
 // Fs_state
@@ -3791,13 +5656,116 @@ Content_file::refs() const {
   return refs_;
 }
 
+// optional uint64 size = 4;
+inline bool Content_file::_internal_has_size() const {
+  bool value = (_has_bits_[0] & 0x00000004u) != 0;
+  return value;
+}
+inline bool Content_file::has_size() const {
+  return _internal_has_size();
+}
+inline void Content_file::clear_size() {
+  size_ = uint64_t{0u};
+  _has_bits_[0] &= ~0x00000004u;
+}
+inline uint64_t Content_file::_internal_size() const {
+  return size_;
+}
+inline uint64_t Content_file::size() const {
+  // @@protoc_insertion_point(field_get:proto.Content_file.size)
+  return _internal_size();
+}
+inline void Content_file::_internal_set_size(uint64_t value) {
+  _has_bits_[0] |= 0x00000004u;
+  size_ = value;
+}
+inline void Content_file::set_size(uint64_t value) {
+  _internal_set_size(value);
+  // @@protoc_insertion_point(field_set:proto.Content_file.size)
+}
+
+// optional uint64 block_size = 5;
+inline bool Content_file::_internal_has_block_size() const {
+  bool value = (_has_bits_[0] & 0x00000008u) != 0;
+  return value;
+}
+inline bool Content_file::has_block_size() const {
+  return _internal_has_block_size();
+}
+inline void Content_file::clear_block_size() {
+  block_size_ = uint64_t{0u};
+  _has_bits_[0] &= ~0x00000008u;
+}
+inline uint64_t Content_file::_internal_block_size() const {
+  return block_size_;
+}
+inline uint64_t Content_file::block_size() const {
+  // @@protoc_insertion_point(field_get:proto.Content_file.block_size)
+  return _internal_block_size();
+}
+inline void Content_file::_internal_set_block_size(uint64_t value) {
+  _has_bits_[0] |= 0x00000008u;
+  block_size_ = value;
+}
+inline void Content_file::set_block_size(uint64_t value) {
+  _internal_set_block_size(value);
+  // @@protoc_insertion_point(field_set:proto.Content_file.block_size)
+}
+
+// repeated fixed64 block_xxhash = 6 [packed = true];
+inline int Content_file::_internal_block_xxhash_size() const {
+  return block_xxhash_.size();
+}
+inline int Content_file::block_xxhash_size() const {
+  return _internal_block_xxhash_size();
+}
+inline void Content_file::clear_block_xxhash() {
+  block_xxhash_.Clear();
+}
+inline uint64_t Content_file::_internal_block_xxhash(int index) const {
+  return block_xxhash_.Get(index);
+}
+inline uint64_t Content_file::block_xxhash(int index) const {
+  // @@protoc_insertion_point(field_get:proto.Content_file.block_xxhash)
+  return _internal_block_xxhash(index);
+}
+inline void Content_file::set_block_xxhash(int index, uint64_t value) {
+  block_xxhash_.Set(index, value);
+  // @@protoc_insertion_point(field_set:proto.Content_file.block_xxhash)
+}
+inline void Content_file::_internal_add_block_xxhash(uint64_t value) {
+  block_xxhash_.Add(value);
+}
+inline void Content_file::add_block_xxhash(uint64_t value) {
+  _internal_add_block_xxhash(value);
+  // @@protoc_insertion_point(field_add:proto.Content_file.block_xxhash)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >&
+Content_file::_internal_block_xxhash() const {
+  return block_xxhash_;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >&
+Content_file::block_xxhash() const {
+  // @@protoc_insertion_point(field_list:proto.Content_file.block_xxhash)
+  return _internal_block_xxhash();
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >*
+Content_file::_internal_mutable_block_xxhash() {
+  return &block_xxhash_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint64_t >*
+Content_file::mutable_block_xxhash() {
+  // @@protoc_insertion_point(field_mutable_list:proto.Content_file.block_xxhash)
+  return _internal_mutable_block_xxhash();
+}
+
 // -------------------------------------------------------------------
 
 // Ref_count
 
 // required uint64 from = 1;
 inline bool Ref_count::_internal_has_from() const {
-  bool value = (_has_bits_[0] & 0x00000001u) != 0;
+  bool value = (_has_bits_[0] & 0x00000002u) != 0;
   return value;
 }
 inline bool Ref_count::has_from() const {
@@ -3805,7 +5773,7 @@ inline bool Ref_count::has_from() const {
 }
 inline void Ref_count::clear_from() {
   from_ = uint64_t{0u};
-  _has_bits_[0] &= ~0x00000001u;
+  _has_bits_[0] &= ~0x00000002u;
 }
 inline uint64_t Ref_count::_internal_from() const {
   return from_;
@@ -3815,7 +5783,7 @@ inline uint64_t Ref_count::from() const {
   return _internal_from();
 }
 inline void Ref_count::_internal_set_from(uint64_t value) {
-  _has_bits_[0] |= 0x00000001u;
+  _has_bits_[0] |= 0x00000002u;
   from_ = value;
 }
 inline void Ref_count::set_from(uint64_t value) {
@@ -3825,7 +5793,7 @@ inline void Ref_count::set_from(uint64_t value) {
 
 // required uint64 to = 2;
 inline bool Ref_count::_internal_has_to() const {
-  bool value = (_has_bits_[0] & 0x00000002u) != 0;
+  bool value = (_has_bits_[0] & 0x00000004u) != 0;
   return value;
 }
 inline bool Ref_count::has_to() const {
@@ -3833,7 +5801,7 @@ inline bool Ref_count::has_to() const {
 }
 inline void Ref_count::clear_to() {
   to_ = uint64_t{0u};
-  _has_bits_[0] &= ~0x00000002u;
+  _has_bits_[0] &= ~0x00000004u;
 }
 inline uint64_t Ref_count::_internal_to() const {
   return to_;
@@ -3843,7 +5811,7 @@ inline uint64_t Ref_count::to() const {
   return _internal_to();
 }
 inline void Ref_count::_internal_set_to(uint64_t value) {
-  _has_bits_[0] |= 0x00000002u;
+  _has_bits_[0] |= 0x00000004u;
   to_ = value;
 }
 inline void Ref_count::set_to(uint64_t value) {
@@ -3853,7 +5821,7 @@ inline void Ref_count::set_to(uint64_t value) {
 
 // required uint64 ref_count = 3;
 inline bool Ref_count::_internal_has_ref_count() const {
-  bool value = (_has_bits_[0] & 0x00000004u) != 0;
+  bool value = (_has_bits_[0] & 0x00000008u) != 0;
   return value;
 }
 inline bool Ref_count::has_ref_count() const {
@@ -3861,7 +5829,7 @@ inline bool Ref_count::has_ref_count() const {
 }
 inline void Ref_count::clear_ref_count() {
   ref_count_ = uint64_t{0u};
-  _has_bits_[0] &= ~0x00000004u;
+  _has_bits_[0] &= ~0x00000008u;
 }
 inline uint64_t Ref_count::_internal_ref_count() const {
   return ref_count_;
@@ -3871,7 +5839,7 @@ inline uint64_t Ref_count::ref_count() const {
   return _internal_ref_count();
 }
 inline void Ref_count::_internal_set_ref_count(uint64_t value) {
-  _has_bits_[0] |= 0x00000004u;
+  _has_bits_[0] |= 0x00000008u;
   ref_count_ = value;
 }
 inline void Ref_count::set_ref_count(uint64_t value) {
@@ -3881,7 +5849,7 @@ inline void Ref_count::set_ref_count(uint64_t value) {
 
 // required uint64 space_taken = 4;
 inline bool Ref_count::_internal_has_space_taken() const {
-  bool value = (_has_bits_[0] & 0x00000008u) != 0;
+  bool value = (_has_bits_[0] & 0x00000010u) != 0;
   return value;
 }
 inline bool Ref_count::has_space_taken() const {
@@ -3889,7 +5857,7 @@ inline bool Ref_count::has_space_taken() const {
 }
 inline void Ref_count::clear_space_taken() {
   space_taken_ = uint64_t{0u};
-  _has_bits_[0] &= ~0x00000008u;
+  _has_bits_[0] &= ~0x00000010u;
 }
 inline uint64_t Ref_count::_internal_space_taken() const {
   return space_taken_;
@@ -3899,7 +5867,7 @@ inline uint64_t Ref_count::space_taken() const {
   return _internal_space_taken();
 }
 inline void Ref_count::_internal_set_space_taken(uint64_t value) {
-  _has_bits_[0] |= 0x00000008u;
+  _has_bits_[0] |= 0x00000010u;
   space_taken_ = value;
 }
 inline void Ref_count::set_space_taken(uint64_t value) {
@@ -4022,6 +5990,284 @@ inline void Ref_count::set_allocated_blake2b(std::string* blake2b) {
   // @@protoc_insertion_point(field_set_allocated:proto.Ref_count.blake2b)
 }
 
+// bytes xxh3_128 = 9;
+inline bool Ref_count::_internal_has_xxh3_128() const {
+  return csum_case() == kXxh3128;
+}
+inline bool Ref_count::has_xxh3_128() const {
+  return _internal_has_xxh3_128();
+}
+inline void Ref_count::set_has_xxh3_128() {
+  _oneof_case_[0] = kXxh3128;
+}
+inline void Ref_count::clear_xxh3_128() {
+  if (_internal_has_xxh3_128()) {
+    csum_.xxh3_128_.Destroy();
+    clear_has_csum();
+  }
+}
+inline const std::string& Ref_count::xxh3_128() const {
+  // @@protoc_insertion_point(field_get:proto.Ref_count.xxh3_128)
+  return _internal_xxh3_128();
+}
+template <typename ArgT0, typename... ArgT>
+inline void Ref_count::set_xxh3_128(ArgT0&& arg0, ArgT... args) {
+  if (!_internal_has_xxh3_128()) {
+    clear_csum();
+    set_has_xxh3_128();
+    csum_.xxh3_128_.InitDefault();
+  }
+  csum_.xxh3_128_.SetBytes( static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:proto.Ref_count.xxh3_128)
+}
+inline std::string* Ref_count::mutable_xxh3_128() {
+  std::string* _s = _internal_mutable_xxh3_128();
+  // @@protoc_insertion_point(field_mutable:proto.Ref_count.xxh3_128)
+  return _s;
+}
+inline const std::string& Ref_count::_internal_xxh3_128() const {
+  if (_internal_has_xxh3_128()) {
+    return csum_.xxh3_128_.Get();
+  }
+  return ::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited();
+}
+inline void Ref_count::_internal_set_xxh3_128(const std::string& value) {
+  if (!_internal_has_xxh3_128()) {
+    clear_csum();
+    set_has_xxh3_128();
+    csum_.xxh3_128_.InitDefault();
+  }
+  csum_.xxh3_128_.Set(value, GetArenaForAllocation());
+}
+inline std::string* Ref_count::_internal_mutable_xxh3_128() {
+  if (!_internal_has_xxh3_128()) {
+    clear_csum();
+    set_has_xxh3_128();
+    csum_.xxh3_128_.InitDefault();
+  }
+  return csum_.xxh3_128_.Mutable(      GetArenaForAllocation());
+}
+inline std::string* Ref_count::release_xxh3_128() {
+  // @@protoc_insertion_point(field_release:proto.Ref_count.xxh3_128)
+  if (_internal_has_xxh3_128()) {
+    clear_has_csum();
+    return csum_.xxh3_128_.Release();
+  } else {
+    return nullptr;
+  }
+}
+inline void Ref_count::set_allocated_xxh3_128(std::string* xxh3_128) {
+  if (has_csum()) {
+    clear_csum();
+  }
+  if (xxh3_128 != nullptr) {
+    set_has_xxh3_128();
+    csum_.xxh3_128_.InitAllocated(xxh3_128, GetArenaForAllocation());
+  }
+  // @@protoc_insertion_point(field_set_allocated:proto.Ref_count.xxh3_128)
+}
+
+// bytes blake3 = 10;
+inline bool Ref_count::_internal_has_blake3() const {
+  return csum_case() == kBlake3;
+}
+inline bool Ref_count::has_blake3() const {
+  return _internal_has_blake3();
+}
+inline void Ref_count::set_has_blake3() {
+  _oneof_case_[0] = kBlake3;
+}
+inline void Ref_count::clear_blake3() {
+  if (_internal_has_blake3()) {
+    csum_.blake3_.Destroy();
+    clear_has_csum();
+  }
+}
+inline const std::string& Ref_count::blake3() const {
+  // @@protoc_insertion_point(field_get:proto.Ref_count.blake3)
+  return _internal_blake3();
+}
+template <typename ArgT0, typename... ArgT>
+inline void Ref_count::set_blake3(ArgT0&& arg0, ArgT... args) {
+  if (!_internal_has_blake3()) {
+    clear_csum();
+    set_has_blake3();
+    csum_.blake3_.InitDefault();
+  }
+  csum_.blake3_.SetBytes( static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:proto.Ref_count.blake3)
+}
+inline std::string* Ref_count::mutable_blake3() {
+  std::string* _s = _internal_mutable_blake3();
+  // @@protoc_insertion_point(field_mutable:proto.Ref_count.blake3)
+  return _s;
+}
+inline const std::string& Ref_count::_internal_blake3() const {
+  if (_internal_has_blake3()) {
+    return csum_.blake3_.Get();
+  }
+  return ::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited();
+}
+inline void Ref_count::_internal_set_blake3(const std::string& value) {
+  if (!_internal_has_blake3()) {
+    clear_csum();
+    set_has_blake3();
+    csum_.blake3_.InitDefault();
+  }
+  csum_.blake3_.Set(value, GetArenaForAllocation());
+}
+inline std::string* Ref_count::_internal_mutable_blake3() {
+  if (!_internal_has_blake3()) {
+    clear_csum();
+    set_has_blake3();
+    csum_.blake3_.InitDefault();
+  }
+  return csum_.blake3_.Mutable(      GetArenaForAllocation());
+}
+inline std::string* Ref_count::release_blake3() {
+  // @@protoc_insertion_point(field_release:proto.Ref_count.blake3)
+  if (_internal_has_blake3()) {
+    clear_has_csum();
+    return csum_.blake3_.Release();
+  } else {
+    return nullptr;
+  }
+}
+inline void Ref_count::set_allocated_blake3(std::string* blake3) {
+  if (has_csum()) {
+    clear_csum();
+  }
+  if (blake3 != nullptr) {
+    set_has_blake3();
+    csum_.blake3_.InitAllocated(blake3, GetArenaForAllocation());
+  }
+  // @@protoc_insertion_point(field_set_allocated:proto.Ref_count.blake3)
+}
+
+// optional uint64 seek_offset = 7;
+inline bool Ref_count::_internal_has_seek_offset() const {
+  bool value = (_has_bits_[0] & 0x00000020u) != 0;
+  return value;
+}
+inline bool Ref_count::has_seek_offset() const {
+  return _internal_has_seek_offset();
+}
+inline void Ref_count::clear_seek_offset() {
+  seek_offset_ = uint64_t{0u};
+  _has_bits_[0] &= ~0x00000020u;
+}
+inline uint64_t Ref_count::_internal_seek_offset() const {
+  return seek_offset_;
+}
+inline uint64_t Ref_count::seek_offset() const {
+  // @@protoc_insertion_point(field_get:proto.Ref_count.seek_offset)
+  return _internal_seek_offset();
+}
+inline void Ref_count::_internal_set_seek_offset(uint64_t value) {
+  _has_bits_[0] |= 0x00000020u;
+  seek_offset_ = value;
+}
+inline void Ref_count::set_seek_offset(uint64_t value) {
+  _internal_set_seek_offset(value);
+  // @@protoc_insertion_point(field_set:proto.Ref_count.seek_offset)
+}
+
+// optional uint64 seek_from = 8;
+inline bool Ref_count::_internal_has_seek_from() const {
+  bool value = (_has_bits_[0] & 0x00000040u) != 0;
+  return value;
+}
+inline bool Ref_count::has_seek_from() const {
+  return _internal_has_seek_from();
+}
+inline void Ref_count::clear_seek_from() {
+  seek_from_ = uint64_t{0u};
+  _has_bits_[0] &= ~0x00000040u;
+}
+inline uint64_t Ref_count::_internal_seek_from() const {
+  return seek_from_;
+}
+inline uint64_t Ref_count::seek_from() const {
+  // @@protoc_insertion_point(field_get:proto.Ref_count.seek_from)
+  return _internal_seek_from();
+}
+inline void Ref_count::_internal_set_seek_from(uint64_t value) {
+  _has_bits_[0] |= 0x00000040u;
+  seek_from_ = value;
+}
+inline void Ref_count::set_seek_from(uint64_t value) {
+  _internal_set_seek_from(value);
+  // @@protoc_insertion_point(field_set:proto.Ref_count.seek_from)
+}
+
+// optional bytes content_id = 11;
+inline bool Ref_count::_internal_has_content_id() const {
+  bool value = (_has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool Ref_count::has_content_id() const {
+  return _internal_has_content_id();
+}
+inline void Ref_count::clear_content_id() {
+  content_id_.ClearToEmpty();
+  _has_bits_[0] &= ~0x00000001u;
+}
+inline const std::string& Ref_count::content_id() const {
+  // @@protoc_insertion_point(field_get:proto.Ref_count.content_id)
+  return _internal_content_id();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void Ref_count::set_content_id(ArgT0&& arg0, ArgT... args) {
+ _has_bits_[0] |= 0x00000001u;
+ content_id_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:proto.Ref_count.content_id)
+}
+inline std::string* Ref_count::mutable_content_id() {
+  std::string* _s = _internal_mutable_content_id();
+  // @@protoc_insertion_point(field_mutable:proto.Ref_count.content_id)
+  return _s;
+}
+inline const std::string& Ref_count::_internal_content_id() const {
+  return content_id_.Get();
+}
+inline void Ref_count::_internal_set_content_id(const std::string& value) {
+  _has_bits_[0] |= 0x00000001u;
+  content_id_.Set(value, GetArenaForAllocation());
+}
+inline std::string* Ref_count::_internal_mutable_content_id() {
+  _has_bits_[0] |= 0x00000001u;
+  return content_id_.Mutable(GetArenaForAllocation());
+}
+inline std::string* Ref_count::release_content_id() {
+  // @@protoc_insertion_point(field_release:proto.Ref_count.content_id)
+  if (!_internal_has_content_id()) {
+    return nullptr;
+  }
+  _has_bits_[0] &= ~0x00000001u;
+  auto* p = content_id_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (content_id_.IsDefault()) {
+    content_id_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void Ref_count::set_allocated_content_id(std::string* content_id) {
+  if (content_id != nullptr) {
+    _has_bits_[0] |= 0x00000001u;
+  } else {
+    _has_bits_[0] &= ~0x00000001u;
+  }
+  content_id_.SetAllocated(content_id, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (content_id_.IsDefault()) {
+    content_id_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:proto.Ref_count.content_id)
+}
+
 inline bool Ref_count::has_csum() const {
   return csum_case() != CSUM_NOT_SET;
 }
@@ -4033,6 +6279,106 @@ inline Ref_count::CsumCase Ref_count::csum_case() const {
 }
 // -------------------------------------------------------------------
 
+// Zstd_dictionary
+
+// required uint32 id = 1;
+inline bool Zstd_dictionary::_internal_has_id() const {
+  bool value = (_has_bits_[0] & 0x00000002u) != 0;
+  return value;
+}
+inline bool Zstd_dictionary::has_id() const {
+  return _internal_has_id();
+}
+inline void Zstd_dictionary::clear_id() {
+  id_ = 0u;
+  _has_bits_[0] &= ~0x00000002u;
+}
+inline uint32_t Zstd_dictionary::_internal_id() const {
+  return id_;
+}
+inline uint32_t Zstd_dictionary::id() const {
+  // @@protoc_insertion_point(field_get:proto.Zstd_dictionary.id)
+  return _internal_id();
+}
+inline void Zstd_dictionary::_internal_set_id(uint32_t value) {
+  _has_bits_[0] |= 0x00000002u;
+  id_ = value;
+}
+inline void Zstd_dictionary::set_id(uint32_t value) {
+  _internal_set_id(value);
+  // @@protoc_insertion_point(field_set:proto.Zstd_dictionary.id)
+}
+
+// required bytes data = 2;
+inline bool Zstd_dictionary::_internal_has_data() const {
+  bool value = (_has_bits_[0] & 0x00000001u) != 0;
+  return value;
+}
+inline bool Zstd_dictionary::has_data() const {
+  return _internal_has_data();
+}
+inline void Zstd_dictionary::clear_data() {
+  data_.ClearToEmpty();
+  _has_bits_[0] &= ~0x00000001u;
+}
+inline const std::string& Zstd_dictionary::data() const {
+  // @@protoc_insertion_point(field_get:proto.Zstd_dictionary.data)
+  return _internal_data();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void Zstd_dictionary::set_data(ArgT0&& arg0, ArgT... args) {
+ _has_bits_[0] |= 0x00000001u;
+ data_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:proto.Zstd_dictionary.data)
+}
+inline std::string* Zstd_dictionary::mutable_data() {
+  std::string* _s = _internal_mutable_data();
+  // @@protoc_insertion_point(field_mutable:proto.Zstd_dictionary.data)
+  return _s;
+}
+inline const std::string& Zstd_dictionary::_internal_data() const {
+  return data_.Get();
+}
+inline void Zstd_dictionary::_internal_set_data(const std::string& value) {
+  _has_bits_[0] |= 0x00000001u;
+  data_.Set(value, GetArenaForAllocation());
+}
+inline std::string* Zstd_dictionary::_internal_mutable_data() {
+  _has_bits_[0] |= 0x00000001u;
+  return data_.Mutable(GetArenaForAllocation());
+}
+inline std::string* Zstd_dictionary::release_data() {
+  // @@protoc_insertion_point(field_release:proto.Zstd_dictionary.data)
+  if (!_internal_has_data()) {
+    return nullptr;
+  }
+  _has_bits_[0] &= ~0x00000001u;
+  auto* p = data_.Release();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (data_.IsDefault()) {
+    data_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  return p;
+}
+inline void Zstd_dictionary::set_allocated_data(std::string* data) {
+  if (data != nullptr) {
+    _has_bits_[0] |= 0x00000001u;
+  } else {
+    _has_bits_[0] &= ~0x00000001u;
+  }
+  data_.SetAllocated(data, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (data_.IsDefault()) {
+    data_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:proto.Zstd_dictionary.data)
+}
+
+// -------------------------------------------------------------------
+
 // Catalogue
 
 // repeated .proto.State_file state_files = 1;
@@ -4115,6 +6461,46 @@ Catalogue::content_files() const {
   return content_files_;
 }
 
+// repeated .proto.Zstd_dictionary dictionaries = 3;
+inline int Catalogue::_internal_dictionaries_size() const {
+  return dictionaries_.size();
+}
+inline int Catalogue::dictionaries_size() const {
+  return _internal_dictionaries_size();
+}
+inline void Catalogue::clear_dictionaries() {
+  dictionaries_.Clear();
+}
+inline ::proto::Zstd_dictionary* Catalogue::mutable_dictionaries(int index) {
+  // @@protoc_insertion_point(field_mutable:proto.Catalogue.dictionaries)
+  return dictionaries_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::proto::Zstd_dictionary >*
+Catalogue::mutable_dictionaries() {
+  // @@protoc_insertion_point(field_mutable_list:proto.Catalogue.dictionaries)
+  return &dictionaries_;
+}
+inline const ::proto::Zstd_dictionary& Catalogue::_internal_dictionaries(int index) const {
+  return dictionaries_.Get(index);
+}
+inline const ::proto::Zstd_dictionary& Catalogue::dictionaries(int index) const {
+  // @@protoc_insertion_point(field_get:proto.Catalogue.dictionaries)
+  return _internal_dictionaries(index);
+}
+inline ::proto::Zstd_dictionary* Catalogue::_internal_add_dictionaries() {
+  return dictionaries_.Add();
+}
+inline ::proto::Zstd_dictionary* Catalogue::add_dictionaries() {
+  ::proto::Zstd_dictionary* _add = _internal_add_dictionaries();
+  // @@protoc_insertion_point(field_add:proto.Catalogue.dictionaries)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::proto::Zstd_dictionary >&
+Catalogue::dictionaries() const {
+  // @@protoc_insertion_point(field_list:proto.Catalogue.dictionaries)
+  return dictionaries_;
+}
+
 // -------------------------------------------------------------------
 
 // Catalog_header
@@ -4234,6 +6620,14 @@ inline void Catalog_header::set_allocated_filters(::proto::Filters* filters) {
 
 // -------------------------------------------------------------------
 
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
 
 // @@protoc_insertion_point(namespace_scope)
 
@@ -22,6 +22,36 @@ struct Archive_params{
 	string password;
 };
 
+static
+void fill_budget(Test_action &to, const string &str){
+	u64 n = 0;
+	auto [end, ec] = from_chars(str.data(), str.data() + str.size(), n);
+	string_view suffix(end, str.data() + str.size());
+	if (ec != errc() or suffix.size() > 1)
+		throw Exception(tr_txt("Wrong 'budget' value {0}"))(str);
+	switch (suffix.empty() ? 'B' : suffix[0]){
+	case 'B': to.budget_bytes = n; break;
+	case 'K': to.budget_bytes = n << 10; break;
+	case 'M': to.budget_bytes = n << 20; break;
+	case 'G': to.budget_bytes = n << 30; break;
+	case 'T': to.budget_bytes = n << 40; break;
+	case 's': to.budget_time = chrono::seconds(n); break;
+	case 'm': to.budget_time = chrono::minutes(n); break;
+	case 'h': to.budget_time = chrono::hours(n); break;
+	default:
+		throw Exception(tr_txt("'budget' value must end on 'K', 'M', 'G', 'T', 's', 'm' or 'h'"));
+	}
+}
+
+/// 'threads' of restore and test. the same limit as 'scan-threads' has in the config
+static
+uint threads_param(Cmd_line &cmd_line){
+	auto n = cmd_line.param_uint_opt("threads").value_or(1);
+	if (n == 0 or n > 1024)
+		throw Exception(tr_txt("'threads' must be from 1 to 1024"));
+	return n;
+}
+
 Archive_params get_archive_params(Cmd_line &cmd_line, string &cfg_path){
 	auto arch = cmd_line.param_str_opt("archive");
 	auto name = cmd_line.param_str_opt("name");
@@ -100,6 +130,7 @@ int run(int argc, const char *argv[]){
 		  "		         a/b/c/d but not a/b/cd.\n"
 		  "		         in the above example, only the c will be restored, not a/b.\n"
 		  "		password\n"
+		  "		threads - number of threads restoring files in parallel, up to 1024. 1 by default\n"
 		  "	archive:\n"
 		  "		name - if not set, all tasks will be processed\n"
 		  "	list:\n"
@@ -113,7 +144,13 @@ int run(int argc, const char *argv[]){
 		  "		id\n"
 		  "	test:\n"
 		  "		archive\n"
-		  "		name\n\n"
+		  "		name\n"
+		  "		threads - number of threads checking content files in parallel, up to 1024. 1 by default\n"
+		  "		mode - 'deep' (default) decrypts and decompresses everything and checks files checksums.\n"
+		  "		       'storage' only checks that content files on disk did not change. much faster\n"
+		  "		budget - checks only a part of the content files, the least recently verified first.\n"
+		  "		         either size ('500G', 'K', 'M', 'T' suffixes) or duration ('90m', 's', 'h' suffixes).\n"
+		  "		         the time of verification is stored in the 'verified' file of the archive\n\n"
 
 		  "example:\n"
 		  "	archivarius restore archive=/nfs/backup target-dir=. password=\"qwerty asdfg\"\n"
@@ -164,15 +201,22 @@ int run(int argc, const char *argv[]){
 					arc.min_content_file_size = c.min_content_file_size;
 				else
 					arc.min_content_file_size = 2*1024*1024*1024ul;
+				arc.chunking_min_file_size = c.chunking_min_file_size;
 				if (c.max_storage_time_seconds)
 					arc.max_storage_time = *c.max_storage_time_seconds * Time_accuracy::period::den;
 				arc.password = c.enc.has_value() ? c.enc->password : "";
+				if (c.enc and c.enc->cipher == Config_enc::AES256)
+					arc.cipher = Cipher::AES256;
 				if (c.zstd){
 					arc.zstd.emplace();
-					arc.zstd->compression_level = 11;
+					arc.zstd->compression_level = c.zstd->level;
+					arc.zstd->threads = c.zstd->threads;
+					arc.zstd->window_log = c.zstd->window_log;
+					arc.zstd->long_distance_matching = c.zstd->long_distance_matching;
 				}
 				arc.warning = move(report_warning);
 				arc.process_acls = c.process_acl;
+				arc.scan_threads = c.scan_threads;
 				arc.archive();
 			} catch (std::exception &e) {
 				cprint(stderr, tr_txt("{fr}Stopped processing the task.{fd}\n"));
@@ -209,6 +253,12 @@ int run(int argc, const char *argv[]){
 				cprint(tr_txt("File\n"));
 				if (file.content_ref.has_value())
 					cprintln(tr_txt("Stored in: {}"), file.content_ref->fname);
+				if (!file.chunks.empty())
+					cprintln(tr_txt("Stored in {} chunks"), file.chunks.size());
+				if (!file.holes.empty())
+					cprintln(tr_txt("Sparse, with {} holes"), file.holes.size());
+				if (!file.hard_link.empty())
+					cprintln(tr_txt("Hard link to: {}"), file.hard_link.string());
 				break;
 			case Filesystem_state::File_type::DIR:
 				cprintln(tr_txt("Directory"));
@@ -242,6 +292,7 @@ int run(int argc, const char *argv[]){
 		rs.password = move(tp.password);
 		rs.to = cmd_line.param_str("target-dir");
 		rs.from_ndx = cmd_line.param_uint_opt("id").value_or(0);
+		rs.threads = threads_param(cmd_line);
 		if (auto pref = cmd_line.param_str_opt("prefix"); pref){
 			auto p = *pref;
 			while (!p.empty() and p.front() == '/')
@@ -263,6 +314,17 @@ int run(int argc, const char *argv[]){
 		ts.archive_path = move(tp.archive_path);
 		ts.name = move(tp.name);
 		ts.password = move(tp.password);
+		ts.threads = threads_param(cmd_line);
+		if (auto mode = cmd_line.param_str_opt("mode"); mode){
+			if (*mode == "storage")
+				ts.mode = Test_action::STORAGE;
+			else if (*mode == "deep")
+				ts.mode = Test_action::DEEP;
+			else
+				throw Exception(tr_txt("'mode' can only be 'storage' or 'deep'"));
+		}
+		if (auto budget = cmd_line.param_str_opt("budget"); budget)
+			fill_budget(ts, *budget);
 		cmd_line.check_unused_arguments();
 		ts.progress_status = [](std::string &&status_text){
 			println("{}", move(status_text));
@@ -0,0 +1,33 @@
+#include "parallel.h"
+
+using namespace std;
+
+namespace archi{
+
+
+void run_in_parallel(uint num_threads, const std::function<void()> &work)
+{
+	mutex mtx;
+	exception_ptr err;
+	auto guarded = [&]{
+		try{
+			work();
+		}
+		catch(...){
+			lock_guard lk(mtx);
+			if (!err)
+				err = current_exception();
+		}
+	};
+	vector<thread> threads;
+	for (uint i = 1; i < num_threads; i++)
+		threads.emplace_back(guarded);
+	guarded();
+	for (auto &t : threads)
+		t.join();
+	if (err)
+		rethrow_exception(err);
+}
+
+
+}
@@ -0,0 +1,12 @@
+#pragma once
+#include "precomp.h"
+
+namespace archi{
+
+
+/// runs `work` on `num_threads` threads, one of which is the calling one, and waits for all of them.
+/// the first exception thrown by any of them is rethrown
+void run_in_parallel(uint num_threads, const std::function<void()> &work);
+
+
+}
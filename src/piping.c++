@@ -2,6 +2,9 @@
 #include "exception.h"
 #include "globals.h"
 
+#include <fcntl.h>
+#include <unistd.h>
+
 using namespace std;
 namespace fs = std::filesystem;
 
@@ -43,16 +46,100 @@ File_source::File_source(const std::filesystem::path &path) : file_(fopen(path.c
 	}
 }
 
-Source::Pump_result File_source::pump(u8 *to, u64 size)
+File_source::File_source(int dir_fd, const std::filesystem::path &path) : file_(nullptr, fclose)
 {
-	Source::Pump_result res;
-	res.pumped_size = fread( to, 1, size , file_.get());
-	if (ferror(file_.get()))
+	try{
+		errno = 0;
+		auto fd = openat(dir_fd, path.filename().c_str(), O_RDONLY | O_CLOEXEC);
+		if (fd < 0)
+			throw_error();
+		file_.reset(fdopen(fd, "rb"));
+		if (!file_){
+			auto err = errno;
+			close(fd);
+			errno = err;
+			throw_error();
+		}
+	}
+	catch(...){
+		throw_with_nested( Exception("Couldn't open file {0} for reading")(path.native()) );
+	}
+}
+
+void File_source::seek(u64 pos)
+{
+	if (fseeko(file_.get(), pos, SEEK_SET) != 0)
 		throw_error();
-	res.eof = feof(file_.get());
+	pos_ = pos;
+}
+
+std::vector<Hole> File_source::find_holes(u64 size)
+{
+	vector<Hole> ret;
+	auto fd = fileno(file_.get());
+	for (u64 pos = 0; pos < size;){
+		errno = 0;
+		auto data = lseek(fd, pos, SEEK_DATA);
+		if (data < 0 and errno != ENXIO){ // not supported
+			ret.clear();
+			break;
+		}
+		u64 data_begin = data < 0 ? size : min<u64>(data, size); // ENXIO: only a hole is left
+		if (data_begin - pos >= min_hole_size)
+			ret.push_back({pos, data_begin - pos});
+		if (data_begin == size)
+			break;
+		auto hole = lseek(fd, data_begin, SEEK_HOLE);
+		if (hole < 0){
+			ret.clear();
+			break;
+		}
+		pos = hole;
+	}
+	errno = 0;
+	seek(0);
+	return ret;
+}
+
+void File_source::skip(std::vector<Hole> holes)
+{
+	holes_ = move(holes);
+	next_hole_ = 0;
+}
+
+Source::Pump_result File_source::pump(u8 *to, u64 size)
+{
+	Source::Pump_result res{0, false};
+	while (res.pumped_size < size and !res.eof){
+		auto n = size - res.pumped_size;
+		if (next_hole_ < holes_.size()){
+			auto &h = holes_[next_hole_];
+			if (pos_ >= h.offset){
+				next_hole_++;
+				seek(max(pos_, h.offset + h.size));
+				continue;
+			}
+			n = min(n, h.offset - pos_);
+		}
+		auto got = fread(to + res.pumped_size, 1, n, file_.get());
+		if (ferror(file_.get()))
+			throw_error();
+		pos_ += got;
+		res.pumped_size += got;
+		res.eof = feof(file_.get());
+	}
 	return res;
 }
 
+Source::Pump_result Memory_source::pump(u8 *to, u64 size)
+{
+	auto n = min(size, size_);
+	copy_n(data_, n, to);
+	data_ += n;
+	size_ -= n;
+	return {n, size_ == 0};
+}
+
 File_sink::File_sink() : file_(nullptr, fclose)
 {
 
@@ -69,15 +156,47 @@ File_sink::File_sink(const std::filesystem::path &path): file_(fopen(path.c_str(
 	}
 }
 
+void File_sink::skip(std::vector<Hole> holes)
+{
+	holes_ = move(holes);
+	next_hole_ = 0;
+}
+
 void File_sink::pump(u8 *to, u64 size)
 {
-	bytes_written_ += fwrite(to, 1, size , file_.get());
-	if (ferror(file_.get()))
-		throw_error();
+	while (size){
+		auto n = size;
+		if (next_hole_ < holes_.size()){
+			auto &h = holes_[next_hole_];
+			if (pos_ >= h.offset){
+				// seeking past the end makes a hole, instead of writing zeros
+				next_hole_++;
+				pos_ = max(pos_, h.offset + h.size);
+				if (fseeko(file_.get(), pos_, SEEK_SET) != 0)
+					throw_error();
+				continue;
+			}
+			n = min(n, h.offset - pos_);
+		}
+		auto written = fwrite(to, 1, n , file_.get());
+		bytes_written_ += written;
+		if (ferror(file_.get()))
+			throw_error();
+		to += written;
+		size -= written;
+		pos_ += written;
+	}
 }
 
 void File_sink::finish()
 {
+	if (file_ and !holes_.empty()){
+		// no data follows the last holes, so the file is extended over them
+		for (; next_hole_ < holes_.size(); next_hole_++)
+			pos_ = max(pos_, holes_[next_hole_].offset + holes_[next_hole_].size);
+		if (fflush(file_.get()) != 0 or ftruncate(fileno(file_.get()), pos_) != 0)
+			throw_error();
+	}
 	throwing_fclose(file_);
 }
 
@@ -98,21 +217,57 @@ void Pipe_out::pump_next(u8 *from, u64 size)
 		next_->pump(from, size);
 }
 
+void Pipe_out::pump_next_buffer(Buffer &buf)
+{
+	if (next_)
+		next_->pump_buffer(buf);
+}
+
 Source::~Source()
 {
 
 }
 
+Source::Pump_view Source::pump_view(u64 max_size, Buffer &scratch)
+{
+	ASSERT(scratch.size());
+	auto res = pump(scratch.raw(), std::min<u64>(max_size, scratch.size()));
+	return {scratch.raw(), res.pumped_size, res.eof};
+}
+
+Source::Pump_result Source::pump_buffer(Buffer &buf, u64 max_size)
+{
+	buf.resize(max_size);
+	auto res = pump(buf.raw(), max_size);
+	buf.resize(res.pumped_size);
+	return res;
+}
+
 Sink::~Sink()
 {
 
 }
 
+void Sink::pump_buffer(Buffer &buf)
+{
+	pump(buf.raw(), buf.size());
+}
+
 Source::Pump_result Pipe_in::pump_next(u8 *to, u64 size)
 {
 	return next_->pump(to, size);
 }
 
+Source::Pump_view Pipe_in::pump_next_view(u64 max_size, Buffer &scratch)
+{
+	return next_->pump_view(max_size, scratch);
+}
+
+Source::Pump_result Pipe_in::pump_next_buffer(Buffer &buf, u64 max_size)
+{
+	return next_->pump_buffer(buf, max_size);
+}
+
 
 
 }
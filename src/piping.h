@@ -1,5 +1,6 @@
 #pragma once
 #include "precomp.h"
+#include "buffer.h"
 
 namespace archi{
 
@@ -19,9 +20,24 @@ public:
 		u64 pumped_size;
 		bool eof;
 	};
+	/// data, which belongs to the source. it's valid till the next pump from the source,
+	/// and the one who pumped may change it in place
+	struct Pump_view{
+		u8 *data;
+		u64 size;
+		bool eof;
+	};
 private:
 	virtual
 	Pump_result pump(u8 *to, u64 size) = 0; // should pump exactly the size, if not eof
+	/// up to max_size of the next data. sources, which keep it in a buffer of their own, hand the buffer out.
+	/// the others pump into scratch. the view is empty only at eof
+	virtual
+	Pump_view pump_view(u64 max_size, Buffer &scratch);
+	/// up to max_size of the next data in buf. sources, which keep it in buffers of their own,
+	/// swap buf for one of them instead of copying. buf is empty only at eof
+	virtual
+	Pump_result pump_buffer(Buffer &buf, u64 max_size);
 
 	friend class Pipe_in;
 	friend class Stream_in;
@@ -31,13 +47,20 @@ class Pipe_in: public Source{
 public:
 	Pipe_in &operator <<(Pipe_in &s){
 		next_ = &s;
+		next_linked();
 		return s;
 	}
 	void operator <<(Source &s){
 		next_ = &s;
+		next_linked();
 	}
 protected:
+	/// stages, which read ahead, drop what they have from the previous source
+	virtual
+	void next_linked(){}
 	Pump_result pump_next(u8 *to, u64 size);
+	Pump_view pump_next_view(u64 max_size, Buffer &scratch);
+	Pump_result pump_next_buffer(Buffer &buf, u64 max_size);
 private:
 	Source *next_;
 };
@@ -55,6 +78,9 @@ public:
 private:
 	virtual
 	void pump(u8 *from, u64 size) = 0;
+	/// the data in buf. sinks, which queue it, swap buf for an empty buffer of their own instead of copying
+	virtual
+	void pump_buffer(Buffer &buf);
 	virtual
 	void finish() = 0;
 
@@ -73,6 +99,7 @@ public:
 	}
 protected:
 	void pump_next(u8 *from, u64 size);
+	void pump_next_buffer(Buffer &buf);
 	void finish_next();
 private:
 	Sink *next_ = nullptr;
@@ -82,15 +109,48 @@ private:
 
 typedef std::unique_ptr<std::FILE, decltype(&std::fclose)> File_ptr;
 
+/// a region of a sparse file, which reads as zeros and takes no space on disk
+struct Hole{
+	u64 offset;
+	u64 size;
+};
+
 class File_source : public Source{
 public:
 	File_source();
 	File_source(const std::filesystem::path &path);
+	/// opens path.filename() relative to the directory dir_fd
+	File_source(int dir_fd, const std::filesystem::path &path);
+	/// next pump() will read from the given position
+	void seek(u64 pos);
+	/// holes of the first `size` bytes, by SEEK_DATA/SEEK_HOLE. smaller ones are left to be read as zeros.
+	/// empty if the file system can't tell. must be called before reading
+	std::vector<Hole> find_holes(u64 size);
+	/// the holes are not read. only the data between them is pumped
+	void skip(std::vector<Hole> holes);
+
+	static constexpr u64 min_hole_size = 64*1024;
 private:
 	virtual
 	Pump_result pump(u8 *to, u64 size) override;
 
 	File_ptr file_;
+	u64 pos_ = 0;
+	std::vector<Hole> holes_;
+	size_t next_hole_ = 0;
+};
+
+
+/// data, which is already in memory. it's not copied, and has to outlive the source
+class Memory_source : public Source{
+public:
+	Memory_source(const u8 *data, u64 size) : data_(data), size_(size){}
+private:
+	virtual
+	Pump_result pump(u8 *to, u64 size) override;
+
+	const u8 *data_;
+	u64 size_;
 };
 
 
@@ -98,6 +158,8 @@ class File_sink : public Sink{
 public:
 	File_sink();
 	File_sink(const std::filesystem::path &path);
+	/// the holes are seeked over, the data goes between them. the file is extended to the end of the last one
+	void skip(std::vector<Hole> holes);
 
 	u64 bytes_written();
 	/// true if sink is associated with an open file and rdy to accept data
@@ -113,6 +175,9 @@ private:
 
 	File_ptr file_;
 	u64 bytes_written_ = 0;
+	u64 pos_ = 0;
+	std::vector<Hole> holes_;
+	size_t next_hole_ = 0;
 };
 
 static_assert (std::is_nothrow_move_constructible<File_sink>::value);
@@ -0,0 +1,143 @@
+#include "piping_aead_stream.h"
+#include "exception.h"
+
+
+namespace archi{
+
+
+size_t Aead_stream::nonce_size() const
+{
+	return algorithm == AES_256_GCM ? 12 : iv_size();
+}
+
+void Aead_stream::nonce(u8 *to, u32 n, bool last)
+{
+	auto size = nonce_size();
+	std::copy_n(iv(), size, to);
+	auto p = to + size - 5;
+	for (int i = 3; i >= 0; i--, n >>= 8)
+		p[i] = n;
+	p[4] = last;
+}
+
+const char *Aead_stream::algorithm_name() const
+{
+	return algorithm == AES_256_GCM ? "AES-256/GCM" : "ChaCha20Poly1305";
+}
+
+std::unique_ptr<Botan::AEAD_Mode> Aead_stream::create_mode(Botan::Cipher_Dir dir)
+{
+	auto mode = Botan::AEAD_Mode::create_or_throw(algorithm_name(), dir);
+	mode->set_key(key(), key_size());
+	return mode;
+}
+
+Pipe_aead_stream_in::Pipe_aead_stream_in(Aead_stream &p) : params_(p)
+{
+	decryptor_ = params_.create_mode(Botan::DECRYPTION);
+}
+
+Source::Pump_result Pipe_aead_stream_in::pump(u8 *to, u64 size)
+{
+	Source::Pump_result res{0, false};
+	while (res.pumped_size < size){
+		if (offset_ == buf_.size()){
+			if (last_)
+				break;
+			open_next_chunk();
+			continue;
+		}
+		auto n = std::min<u64>(size - res.pumped_size, buf_.size() - offset_);
+		std::copy_n(buf_.data() + offset_, n, to + res.pumped_size);
+		offset_ += n;
+		res.pumped_size += n;
+	}
+	res.eof = last_ and offset_ == buf_.size();
+	return res;
+}
+
+Source::Pump_view Pipe_aead_stream_in::pump_view(u64 max_size, Buffer &)
+{
+	while (offset_ == buf_.size() and !last_)
+		open_next_chunk();
+	auto size = std::min<u64>(max_size, buf_.size() - offset_);
+	Pump_view ret{buf_.data() + offset_, size, false};
+	offset_ += size;
+	ret.eof = last_ and offset_ == buf_.size();
+	return ret;
+}
+
+void Pipe_aead_stream_in::open_next_chunk()
+{
+	constexpr auto sealed_size = Aead_stream::chunk_size + Aead_stream::tag_size;
+	buf_.resize(sealed_size + 1);
+	size_t filled = 0;
+	if (next_byte_){
+		buf_[filled++] = *next_byte_;
+		next_byte_.reset();
+	}
+	while (filled < buf_.size() and !source_eof_){
+		auto res = pump_next(buf_.data() + filled, buf_.size() - filled);
+		filled += res.pumped_size;
+		source_eof_ = res.eof;
+	}
+	last_ = filled <= sealed_size;
+	if (!last_){
+		next_byte_ = buf_[sealed_size];
+		filled = sealed_size;
+	}
+	buf_.resize(filled);
+	offset_ = 0;
+	if (filled < Aead_stream::tag_size)
+		throw Exception("{0} stream is truncated. The file was altered or damaged.")(params_.algorithm_name());
+	u8 nonce[Aead_stream::max_nonce_size];
+	params_.nonce(nonce, num_chunks_++, last_);
+	try{
+		decryptor_->start(nonce, params_.nonce_size());
+		decryptor_->finish(buf_);
+	} catch(Botan::Integrity_Failure &ef){
+		throw Exception("{0} integrity check failed. Either wrong password, or the file was altered or damaged.")(params_.algorithm_name());
+	}
+	if (num_chunks_ == 0)
+		throw Exception("{0} stream is too long.")(params_.algorithm_name());
+}
+
+Pipe_aead_stream_out::Pipe_aead_stream_out(Aead_stream &p) : params_(p)
+{
+	encryptor_ = params_.create_mode(Botan::ENCRYPTION);
+	buf_.reserve(Aead_stream::chunk_size + Aead_stream::tag_size);
+}
+
+void Pipe_aead_stream_out::pump(u8 *from, u64 size)
+{
+	while (size){
+		// a full chunk is sealed only when more data comes, as the last chunk must be marked so
+		if (buf_.size() == Aead_stream::chunk_size)
+			seal_chunk(false);
+		auto n = std::min<u64>(size, Aead_stream::chunk_size - buf_.size());
+		buf_.insert(buf_.end(), from, from + n);
+		from += n;
+		size -= n;
+	}
+}
+
+void Pipe_aead_stream_out::finish()
+{
+	seal_chunk(true);
+	finish_next();
+}
+
+void Pipe_aead_stream_out::seal_chunk(bool last)
+{
+	u8 nonce[Aead_stream::max_nonce_size];
+	params_.nonce(nonce, num_chunks_++, last);
+	if (num_chunks_ == 0)
+		throw Exception("{0} stream is too long.")(params_.algorithm_name());
+	encryptor_->start(nonce, params_.nonce_size());
+	encryptor_->finish(buf_);
+	pump_next(buf_.data(), buf_.size());
+	buf_.clear();
+}
+
+
+}
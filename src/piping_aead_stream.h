@@ -0,0 +1,71 @@
+#pragma once
+#include "piping.h"
+#include "buffer.h"
+#include "encryption_params.h"
+
+namespace archi{
+
+
+/// parameters of chunked AEAD (STREAM construction).
+/// every chunk has its own tag, its nonce is made of the IV prefix, the chunk number and the final chunk flag
+class Aead_stream: public Encryption_params{
+public:
+	enum Algorithm{
+		CHACHA20_POLY1305,
+		AES_256_GCM
+	};
+	Aead_stream() = default;
+	explicit
+	Aead_stream(const Encryption_params &p, Algorithm a = CHACHA20_POLY1305): Encryption_params(p), algorithm(a){}
+	Algorithm algorithm = CHACHA20_POLY1305;
+
+	static constexpr size_t chunk_size = 64*1024;
+	static constexpr size_t tag_size = 16;
+	static constexpr size_t max_nonce_size = iv_size();
+	/// ChaCha20Poly1305 takes the whole IV (XChaCha20), GCM - 12 bytes
+	size_t nonce_size() const;
+	/// nonce of the chunk #n
+	void nonce(u8 *to, u32 n, bool last);
+	/// as Botan names it
+	const char *algorithm_name() const;
+	std::unique_ptr<Botan::AEAD_Mode> create_mode(Botan::Cipher_Dir dir);
+};
+
+/// authenticates and decrypts input chunk by chunk, so memory usage doesn't depend on the input size
+class Pipe_aead_stream_in: public Pipe_in{
+public:
+	Pipe_aead_stream_in(Aead_stream &p);
+private:
+	virtual
+	Pump_result pump(u8 *to, u64 size) override;
+	virtual
+	Pump_view pump_view(u64 max_size, Buffer &scratch) override;
+	void open_next_chunk();
+	Aead_stream params_;
+	std::unique_ptr<Botan::AEAD_Mode> decryptor_;
+	Botan::secure_vector<uint8_t> buf_;
+	size_t offset_ = 0;
+	u32 num_chunks_ = 0;
+	bool last_ = false;
+	bool source_eof_ = false;
+	std::optional<u8> next_byte_; // the first byte of the next chunk, read to know the current one isn't the last
+};
+
+/// encrypts and signs output chunk by chunk, so memory usage doesn't depend on the output size
+class Pipe_aead_stream_out: public Pipe_out{
+public:
+	Pipe_aead_stream_out(Aead_stream &p);
+private:
+	virtual
+	void pump(u8 *from, u64 size) override;
+	virtual
+	void finish() override;
+	void seal_chunk(bool last);
+	Aead_stream params_;
+	std::unique_ptr<Botan::AEAD_Mode> encryptor_;
+	Botan::secure_vector<uint8_t> buf_;
+	u32 num_chunks_ = 0;
+};
+
+
+}
@@ -0,0 +1,50 @@
+#include "piping_aes.h"
+#include "exception.h"
+
+namespace archi{
+
+
+static
+std::unique_ptr<Botan::StreamCipher> create_ctr(Aes_ctr &p)
+{
+	auto ret = Botan::StreamCipher::create_or_throw("CTR(AES-256)");
+	ret->set_key(p.key(), p.key_size());
+	ret->set_iv(p.iv(), Aes_ctr::block_iv_size);
+	return ret;
+}
+
+Pipe_aes_ctr_in::Pipe_aes_ctr_in(Aes_ctr &p) : ctr_(create_ctr(p))
+{
+}
+
+void Pipe_aes_ctr_in::seek(u64 pos)
+{
+	ctr_->seek(pos);
+}
+
+Source::Pump_result Pipe_aes_ctr_in::pump(u8 *to, u64 size)
+{
+	auto res = pump_next(to, size);
+	ctr_->cipher1(to, res.pumped_size);
+	return res;
+}
+
+Source::Pump_view Pipe_aes_ctr_in::pump_view(u64 max_size, Buffer &scratch)
+{
+	auto view = pump_next_view(max_size, scratch);
+	ctr_->cipher1(view.data, view.size);
+	return view;
+}
+
+Pipe_aes_ctr_out::Pipe_aes_ctr_out(Aes_ctr &p) : ctr_(create_ctr(p))
+{
+}
+
+void Pipe_aes_ctr_out::pump(u8 *to, u64 size)
+{
+	ctr_->cipher1(to, size);
+	pump_next(to, size);
+}
+
+
+}
@@ -0,0 +1,39 @@
+#pragma once
+#include "piping.h"
+#include "encryption_params.h"
+
+namespace archi{
+
+
+/// plain AES-256-CTR, with its own 16 byte IV as the initial counter block.
+/// like Chacha, it's for content files, which can be read from the middle, and whose content is checksummed anyway
+class Aes_ctr: public Encryption_params{
+public:
+	static constexpr size_t block_iv_size = 16;
+};
+
+class Pipe_aes_ctr_in: public Pipe_in{
+public:
+	Pipe_aes_ctr_in(Aes_ctr &p);
+	/// the next pump() decrypts data, which is at `pos` in the encrypted stream
+	void seek(u64 pos);
+private:
+	virtual
+	Pump_result pump(u8 *to, u64 size) override;
+	virtual
+	Pump_view pump_view(u64 max_size, Buffer &scratch) override;
+	std::unique_ptr<Botan::StreamCipher> ctr_;
+};
+
+
+class Pipe_aes_ctr_out: public Pipe_out{
+public:
+	Pipe_aes_ctr_out(Aes_ctr &p);
+private:
+	virtual
+	void pump(u8 *to, u64 size) override;
+	std::unique_ptr<Botan::StreamCipher> ctr_;
+};
+
+
+}
@@ -0,0 +1,285 @@
+#include "piping_async.h"
+#include "exception.h"
+
+using namespace std;
+
+namespace archi{
+
+
+Pipe_async_in::~Pipe_async_in()
+{
+	{
+		lock_guard lk(mtx_);
+		stop_ = true;
+	}
+	cv_.notify_all();
+	if (worker_.joinable())
+		worker_.join();
+}
+
+void Pipe_async_in::cancel()
+{
+	unique_lock lk(mtx_);
+	reading_ = false;
+	cv_.wait(lk, [this]{ return !busy_; });
+	for (auto &b : full_)
+		free_.push_back(move(b.buf));
+	full_.clear();
+	viewed_ = false;
+	error_ = nullptr;
+}
+
+void Pipe_async_in::drop_viewed()
+{
+	if (!viewed_)
+		return;
+	viewed_ = false;
+	free_.push_back(move(full_.front().buf));
+	full_.pop_front();
+	cv_.notify_all();
+}
+
+Pipe_async_in::Block &Pipe_async_in::front_block(std::unique_lock<std::mutex> &lk)
+{
+	if (!worker_.joinable())
+		worker_ = thread([this]{ work(); });
+	if (!reading_ and !busy_ and full_.empty() and !error_){
+		reading_ = true;
+		cv_.notify_all();
+	}
+	cv_.wait(lk, [this]{ return !full_.empty() or error_; });
+	if (full_.empty()){
+		auto err = error_;
+		error_ = nullptr;
+		rethrow_exception(err);
+	}
+	return full_.front();
+}
+
+Source::Pump_view Pipe_async_in::pump_view(u64 max_size, Buffer &)
+{
+	unique_lock lk(mtx_);
+	drop_viewed();
+	auto &b = front_block(lk);
+	auto n = min<u64>(max_size, b.buf.size() - b.pos);
+	Pump_view ret{b.buf.raw() + b.pos, n, false};
+	b.pos += n;
+	if (b.pos == b.buf.size()){
+		ret.eof = b.eof;
+		viewed_ = true;
+	}
+	return ret;
+}
+
+Source::Pump_result Pipe_async_in::pump(u8 *to, u64 size)
+{
+	Pump_result res{0, false};
+	unique_lock lk(mtx_);
+	drop_viewed();
+	while (res.pumped_size < size){
+		// the worker only appends, so the front block is safe to use without the lock
+		auto &b = front_block(lk);
+		lk.unlock();
+		auto n = min(size - res.pumped_size, b.buf.size() - b.pos);
+		copy_n(b.buf.raw() + b.pos, n, to + res.pumped_size);
+		b.pos += n;
+		res.pumped_size += n;
+		lk.lock();
+		if (b.pos == b.buf.size()){
+			res.eof = b.eof;
+			free_.push_back(move(b.buf));
+			full_.pop_front();
+			cv_.notify_all();
+			if (res.eof)
+				break;
+		}
+	}
+	return res;
+}
+
+Source::Pump_result Pipe_async_in::pump_buffer(Buffer &buf, u64 max_size)
+{
+	unique_lock lk(mtx_);
+	drop_viewed();
+	auto &b = front_block(lk);
+	if (b.pos or b.buf.size() > max_size){ // a part of a block is copied
+		lk.unlock();
+		buf.resize(max_size);
+		auto res = pump(buf.raw(), max_size);
+		buf.resize(res.pumped_size);
+		return res;
+	}
+	Pump_result res{b.buf.size(), b.eof};
+	swap(buf, b.buf);
+	free_.push_back(move(b.buf));
+	full_.pop_front();
+	cv_.notify_all();
+	return res;
+}
+
+void Pipe_async_in::work()
+{
+	unique_lock lk(mtx_);
+	while (true){
+		cv_.wait(lk, [this]{ return stop_ or (reading_ and full_.size() < queue_depth); });
+		if (stop_)
+			return;
+		Buffer b;
+		if (!free_.empty()){
+			b = move(free_.back());
+			free_.pop_back();
+		}
+		busy_ = true;
+		lk.unlock();
+		b.resize(block_size);
+		Pump_result res;
+		exception_ptr err;
+		try{
+			res = pump_next(b.raw(), block_size);
+		}
+		catch(...){
+			err = current_exception();
+		}
+		lk.lock();
+		busy_ = false;
+		if (!reading_){ // canceled meanwhile
+			free_.push_back(move(b));
+		}
+		else if (err){
+			error_ = err;
+			reading_ = false;
+		}
+		else{
+			b.resize(res.pumped_size);
+			full_.push_back({move(b), 0, res.eof});
+			if (res.eof)
+				reading_ = false;
+		}
+		cv_.notify_all();
+	}
+}
+
+Pipe_async_out::~Pipe_async_out()
+{
+	{
+		lock_guard lk(mtx_);
+		stop_ = true;
+	}
+	cv_.notify_all();
+	if (worker_.joinable())
+		worker_.join();
+}
+
+void Pipe_async_out::async(bool on)
+{
+	if (on == async_)
+		return;
+	async_ = on;
+	if (!on)
+		sync(); // the queue is drained even if it throws
+	else{
+		unique_lock lk(mtx_);
+		error_ = nullptr; // a failure of the previous use isn't this one's
+		if (!worker_.joinable())
+			worker_ = thread([this]{ work(); });
+	}
+}
+
+void Pipe_async_out::sync()
+{
+	unique_lock lk(mtx_);
+	cv_.wait(lk, [this]{ return full_.empty() and !busy_; });
+	throw_if_failed(lk);
+}
+
+void Pipe_async_out::pump(u8 *from, u64 size)
+{
+	if (!async_){
+		pump_next(from, size);
+		return;
+	}
+	unique_lock lk(mtx_);
+	cv_.wait(lk, [this]{ return full_.size() < queue_depth or error_; });
+	throw_if_failed(lk);
+	Buffer b;
+	if (!free_.empty()){
+		b = move(free_.back());
+		free_.pop_back();
+	}
+	lk.unlock();
+	b.resize(size);
+	copy_n(from, size, b.raw());
+	lk.lock();
+	full_.push_back(move(b));
+	cv_.notify_all();
+}
+
+void Pipe_async_out::pump_buffer(Buffer &buf)
+{
+	if (!async_){
+		pump_next_buffer(buf);
+		return;
+	}
+	unique_lock lk(mtx_);
+	cv_.wait(lk, [this]{ return full_.size() < queue_depth or error_; });
+	throw_if_failed(lk);
+	Buffer b;
+	if (!free_.empty()){
+		b = move(free_.back());
+		free_.pop_back();
+	}
+	swap(buf, b);
+	full_.push_back(move(b));
+	cv_.notify_all();
+}
+
+void Pipe_async_out::finish()
+{
+	sync();
+	finish_next();
+}
+
+void Pipe_async_out::work()
+{
+	unique_lock lk(mtx_);
+	while (true){
+		cv_.wait(lk, [this]{ return stop_ or !full_.empty(); });
+		if (stop_)
+			return;
+		auto b = move(full_.front());
+		full_.pop_front();
+		busy_ = true;
+		bool failed = error_ != nullptr;
+		lk.unlock();
+		exception_ptr err;
+		if (!failed){ // after a failure, the rest is dropped
+			try{
+				pump_next_buffer(b);
+			}
+			catch(...){
+				err = current_exception();
+			}
+		}
+		lk.lock();
+		busy_ = false;
+		if (err)
+			error_ = err;
+		free_.push_back(move(b));
+		cv_.notify_all();
+	}
+}
+
+void Pipe_async_out::throw_if_failed(std::unique_lock<std::mutex> &lk)
+{
+	if (!error_)
+		return;
+	// what's queued is dropped, and the stage can be used again
+	cv_.wait(lk, [this]{ return !busy_; });
+	for (auto &b : full_)
+		free_.push_back(move(b));
+	full_.clear();
+	rethrow_exception(exchange(error_, nullptr));
+}
+
+
+}
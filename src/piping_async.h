@@ -0,0 +1,92 @@
+#pragma once
+#include "piping.h"
+#include "buffer.h"
+
+namespace archi{
+
+
+/// reads the next source ahead, on a separate thread.
+/// starts reading at the first pump(), and stops at eof. After that, another source can be linked,
+/// and the next pump() starts reading it.
+class Pipe_async_in: public Pipe_in{
+public:
+	Pipe_async_in() = default;
+	Pipe_async_in(Pipe_async_in&) = delete;
+	~Pipe_async_in();
+	/// stops reading ahead and drops what was read.
+	/// must be called before the next source is destroyed or relinked, if eof wasn't reached
+	void cancel();
+private:
+	virtual
+	Pump_result pump(u8 *to, u64 size) override;
+	/// hands out the blocks read ahead
+	virtual
+	Pump_view pump_view(u64 max_size, Buffer &scratch) override;
+	/// swaps whole blocks read ahead for the given buffer
+	virtual
+	Pump_result pump_buffer(Buffer &buf, u64 max_size) override;
+	void work();
+
+	static constexpr size_t block_size = 128*1024;
+	static constexpr size_t queue_depth = 8;
+	struct Block{
+		Buffer buf;
+		size_t pos;
+		bool eof;
+	};
+	/// waits for a block, and starts reading if not yet. mtx_ must be locked
+	Block &front_block(std::unique_lock<std::mutex> &lk);
+	/// recycles the block, which the previous view ended
+	void drop_viewed();
+	std::mutex mtx_;
+	std::condition_variable cv_;
+	std::deque<Block> full_;
+	std::vector<Buffer> free_;
+	std::exception_ptr error_;
+	bool reading_ = false; // the worker is (going to be) reading the current source
+	bool busy_ = false;    // the worker is inside the next source
+	bool stop_ = false;
+	bool viewed_ = false;  // the front block is handed out till the next pump
+	std::thread worker_;
+};
+
+
+/// passes the data to the next stages on a separate thread.
+/// pump() blocks when too much data is queued already.
+/// exceptions thrown by the next stages are rethrown at the following pump(), sync() or finish(),
+/// once. the data queued after the failure is dropped
+class Pipe_async_out: public Pipe_out{
+public:
+	Pipe_async_out() = default;
+	Pipe_async_out(Pipe_async_out&) = delete;
+	~Pipe_async_out();
+	/// when off (by default), the data is pumped to the next stage directly on the calling thread
+	void async(bool on);
+	/// waits till everything pumped so far went through the next stages
+	void sync();
+private:
+	virtual
+	void pump(u8 *from, u64 size) override;
+	/// queues the buffer itself, and gives back one, that went through the next stages
+	virtual
+	void pump_buffer(Buffer &buf) override;
+	virtual
+	void finish() override;
+	void work();
+	/// rethrows the failure of the next stages once. mtx_ must be locked
+	void throw_if_failed(std::unique_lock<std::mutex> &lk);
+
+	static constexpr size_t queue_depth = 4;
+	std::mutex mtx_;
+	std::condition_variable cv_;
+	std::deque<Buffer> full_;
+	std::vector<Buffer> free_;
+	std::exception_ptr error_;
+	bool busy_ = false; // the worker is inside the next stage
+	bool stop_ = false;
+	bool async_ = false;
+	std::thread worker_;
+};
+
+
+}
@@ -0,0 +1,45 @@
+#include "piping_block_csum.h"
+
+using namespace std;
+
+namespace archi{
+
+
+Pipe_block_csum_out::Pipe_block_csum_out(u64 block_size)
+{
+	csums_.block_size = block_size;
+}
+
+Block_csums Pipe_block_csum_out::take()
+{
+	if (in_block_){
+		csums_.csums.push_back(get<Xx_hash>(csumer_.checksum()));
+		csumer_.reset();
+		in_block_ = 0;
+	}
+	Block_csums ret = move(csums_);
+	csums_ = Block_csums();
+	csums_.block_size = ret.block_size;
+	return ret;
+}
+
+void Pipe_block_csum_out::pump(u8 *from, u64 size)
+{
+	pump_next(from, size);
+	csums_.size += size;
+	while (size){
+		auto n = min(size, csums_.block_size - in_block_);
+		csumer_.update(from, n);
+		from += n;
+		size -= n;
+		in_block_ += n;
+		if (in_block_ == csums_.block_size){
+			csums_.csums.push_back(get<Xx_hash>(csumer_.checksum()));
+			csumer_.reset();
+			in_block_ = 0;
+		}
+	}
+}
+
+
+}
@@ -0,0 +1,32 @@
+#pragma once
+#include "piping.h"
+#include "checksumer_xxhash.h"
+
+namespace archi{
+
+
+/// checksums of a file as it is on disk, block by block.
+/// they allow checking the storage without decrypting and decompressing
+struct Block_csums{
+	u64 block_size = 0;
+	u64 size = 0; // of the whole file
+	std::vector<Xx_hash> csums;
+};
+
+class Pipe_block_csum_out: public Pipe_out{
+public:
+	explicit
+	Pipe_block_csum_out(u64 block_size = 1024*1024);
+	/// @returns checksums of everything pumped since the previous call
+	Block_csums take();
+private:
+	virtual
+	void pump(u8 *from, u64 size) override;
+
+	Checksumer_xxhash csumer_;
+	u64 in_block_ = 0;
+	Block_csums csums_;
+};
+
+
+}
@@ -10,6 +10,11 @@ Pipe_chacha_in::Pipe_chacha_in(Chacha &p)
 	chacha_.set_iv(p.iv(), p.iv_size());
 }
 
+void Pipe_chacha_in::seek(u64 pos)
+{
+	chacha_.seek(pos);
+}
+
 Source::Pump_result Pipe_chacha_in::pump(u8 *to, u64 size)
 {
 	auto res = pump_next(to, size);
@@ -17,6 +22,13 @@ Source::Pump_result Pipe_chacha_in::pump(u8 *to, u64 size)
 	return res;
 }
 
+Source::Pump_view Pipe_chacha_in::pump_view(u64 max_size, Buffer &scratch)
+{
+	auto view = pump_next_view(max_size, scratch);
+	chacha_.cipher1(view.data, view.size);
+	return view;
+}
+
 Pipe_chacha_out::Pipe_chacha_out(Chacha &p)
 {
 	chacha_.set_key(p.key(), p.key_size());
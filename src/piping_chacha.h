@@ -11,9 +11,13 @@ class Chacha: public Encryption_params{};
 class Pipe_chacha_in: public Pipe_in{
 public:
 	Pipe_chacha_in(Chacha &p);
+	/// the next pump() decrypts data, which is at `pos` in the encrypted stream
+	void seek(u64 pos);
 private:
 	virtual
 	Pump_result pump(u8 *to, u64 size) override;
+	virtual
+	Pump_view pump_view(u64 max_size, Buffer &scratch) override;
 	Botan::ChaCha chacha_{20};
 };
 
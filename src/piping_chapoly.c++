@@ -11,7 +11,7 @@ Pipe_chapoly_in::Pipe_chapoly_in(Chapoly &p)
 	decryptor_.start(p.iv(), p.iv_size());
 }
 
-Source::Pump_result Pipe_chapoly_in::pump(u8 *to, u64 size)
+void Pipe_chapoly_in::read_all()
 {
 	if (buf_.empty()){
 		try{
@@ -33,6 +33,11 @@ Source::Pump_result Pipe_chapoly_in::pump(u8 *to, u64 size)
 			throw Exception("ChaCha20Poly1305 integrity check failed. Either wrong password, or the file was altered or damaged.");
 		}
 	}
+}
+
+Source::Pump_result Pipe_chapoly_in::pump(u8 *to, u64 size)
+{
+	read_all();
 	auto reminder = buf_.size() - offset_;
 	if (size > reminder)
 		size = reminder;
@@ -47,6 +52,16 @@ Source::Pump_result Pipe_chapoly_in::pump(u8 *to, u64 size)
 	return res;
 }
 
+Source::Pump_view Pipe_chapoly_in::pump_view(u64 max_size, Buffer &)
+{
+	read_all();
+	auto size = std::min<u64>(max_size, buf_.size() - offset_);
+	Pump_view ret{buf_.data() + offset_, size, false};
+	offset_ += size;
+	ret.eof = offset_ == buf_.size();
+	return ret;
+}
+
 
 Pipe_chapoly_out::Pipe_chapoly_out(Chapoly &p)
 {
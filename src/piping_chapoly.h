@@ -17,6 +17,9 @@ public:
 private:
 	virtual
 	Pump_result pump(u8 *to, u64 size) override;
+	virtual
+	Pump_view pump_view(u64 max_size, Buffer &scratch) override;
+	void read_all();
 	Botan::ChaCha20Poly1305_Decryption decryptor_;
 	Botan::secure_vector<uint8_t> buf_;
 	size_t offset_ = 0;
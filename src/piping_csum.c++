@@ -1,17 +1,29 @@
 #include "piping_csum.h"
 #include "checksumer_blake2b.h"
 #include "checksumer_xxhash.h"
+#include "checksumer_xxh3.h"
+#include "checksumer_blake3.h"
+#include "exception.h"
 
 using namespace std;
 
 namespace archi{
 
-std::unique_ptr<Checksumer> make_csumer_for(const Checksum &csum)
+std::unique_ptr<Checksumer> make_csumer_for(const Checksum &csum, const Encryption_params *enc)
 {
 	if (holds_alternative<Xx_hash>(csum))
 		return make_unique<Checksumer_xxhash>();
 	if (holds_alternative<Blake2b_hash>(csum))
 		return make_unique<Checksumer_blake2b>();
+	if (holds_alternative<Xxh3_hash>(csum))
+		return make_unique<Checksumer_xxh3>();
+	if (holds_alternative<Blake3_hash>(csum)){
+		if (!enc)
+			throw Exception("BLAKE3 checksum requires the encryption key");
+		// a key of its own, so checksums of the content tell nothing without the encryption key
+		auto key = Checksumer_blake3::derive_key("archivarius 2025-06 content checksum", enc->key(), enc->key_size());
+		return make_unique<Checksumer_blake3>(key.data());
+	}
 	ASSERT(false);
 	std::unreachable();
 }
@@ -21,9 +33,9 @@ void Pipe_through_csumer::csumer(std::unique_ptr<Checksumer> &&cs)
 	csumer_ = move(cs);
 }
 
-void Pipe_through_csumer::csumer_for(const Checksum &csum)
+void Pipe_through_csumer::csumer_for(const Checksum &csum, const Encryption_params *enc)
 {
-	csumer_ = make_csumer_for(csum);
+	csumer_ = make_csumer_for(csum, enc);
 }
 
 Pipe_csum_out::Pipe_csum_out(const Checksum set_for)
@@ -41,6 +53,12 @@ void Pipe_csum_out::pump(u8 *from, u64 size)
 	pump_next(from, size);
 }
 
+void Pipe_csum_out::pump_buffer(Buffer &buf)
+{
+	csumer()->update(buf.raw(), buf.size());
+	pump_next_buffer(buf);
+}
+
 Pipe_csum_in::Pipe_csum_in(const Checksum set_for)
 {
 	csumer_for(set_for);
@@ -58,6 +76,13 @@ Source::Pump_result Pipe_csum_in::pump(u8 *to, u64 size)
 	return res;
 }
 
+Source::Pump_view Pipe_csum_in::pump_view(u64 max_size, Buffer &scratch)
+{
+	auto view = pump_next_view(max_size, scratch);
+	csumer()->update(view.data, view.size);
+	return view;
+}
+
 
 
 
@@ -1,6 +1,7 @@
 #pragma once
 #include "checksumer.h"
 #include "piping.h"
+#include "encryption_params.h"
 
 namespace archi{
 
@@ -10,7 +11,8 @@ public:
 		return csumer_.get();
 	}
 	void csumer(std::unique_ptr<Checksumer> &&cs);
-	void csumer_for(const Checksum &csum);
+	/// @param enc encryption params of the content, keyed checksums are derived from
+	void csumer_for(const Checksum &csum, const Encryption_params *enc = nullptr);
 private:
 	std::unique_ptr<Checksumer> csumer_;
 };
@@ -25,6 +27,8 @@ public:
 private:
 	virtual
 	Pump_result pump(u8 *to, u64 size) override;
+	virtual
+	Pump_view pump_view(u64 max_size, Buffer &scratch) override;
 };
 
 
@@ -37,6 +41,8 @@ public:
 private:
 	virtual
 	void pump(u8 *from, u64 size) override;
+	virtual
+	void pump_buffer(Buffer &buf) override;
 };
 
 
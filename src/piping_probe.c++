@@ -0,0 +1,102 @@
+#include "piping_probe.h"
+#include "exception.h"
+
+using namespace std;
+
+namespace archi{
+
+
+static const size_t head_size = 64*1024;
+// less than that can't be judged. and small files are cheap to compress anyway
+static const size_t min_head_size = 4*1024;
+// compressed head must be smaller than that, in percents
+static const size_t max_ratio = 97;
+
+struct Magic{
+	size_t offset;
+	string_view bytes;
+};
+
+// formats, which are compressed already
+static const Magic magics[] = {
+	{0, "\xFF\xD8\xFF"sv},                 // jpeg
+	{0, "\x89PNG\r\n\x1A\n"sv},            // png
+	{0, "GIF8"sv},                         // gif
+	{0, "PK\x03\x04"sv},                   // zip, jar, office documents
+	{0, "\x1F\x8B"sv},                     // gzip
+	{0, "BZh"sv},                          // bzip2
+	{0, "\xFD" "7zXZ\x00"sv},              // xz
+	{0, "\x28\xB5\x2F\xFD"sv},             // zstd
+	{0, "\x04\x22\x4D\x18"sv},             // lz4
+	{0, "7z\xBC\xAF\x27\x1C"sv},           // 7z
+	{0, "Rar!\x1A\x07"sv},                 // rar
+	{4, "ftyp"sv},                         // mp4, mov, heic
+	{0, "\x1A\x45\xDF\xA3"sv},             // mkv, webm
+	{0, "OggS"sv},                         // ogg
+	{0, "fLaC"sv},                         // flac
+	{0, "ID3"sv},                          // mp3
+	{8, "WEBP"sv},                         // webp
+};
+
+static
+bool has_known_magic(const u8 *data, size_t size)
+{
+	for (auto &m : magics){
+		if (size < m.offset + m.bytes.size())
+			continue;
+		if (equal(m.bytes.begin(), m.bytes.end(), data + m.offset))
+			return true;
+	}
+	return false;
+}
+
+Pipe_probe_in::Pipe_probe_in() : zctx_(pool::cctx())
+{
+	head_.resize(head_size);
+	trial_.resize(ZSTD_compressBound(head_size));
+}
+
+bool Pipe_probe_in::incompressible()
+{
+	head_size_ = head_pos_ = 0;
+	head_eof_ = false;
+	auto res = pump_next(head_.raw(), head_.size());
+	head_size_ = res.pumped_size;
+	head_pos_ = 0;
+	head_eof_ = res.eof;
+	if (head_size_ < min_head_size)
+		return false;
+	if (has_known_magic(head_.raw(), head_size_))
+		return true;
+	auto csize = ZSTD_compressCCtx(zctx_.get(), trial_.raw(), trial_.size(), head_.raw(), head_size_, 1);
+	if (ZSTD_isError(csize))
+		return false;
+	return csize * 100 >= head_size_ * max_ratio;
+}
+
+Source::Pump_result Pipe_probe_in::pump(u8 *to, u64 size)
+{
+	Pump_result res{0, false};
+	if (head_pos_ < head_size_){
+		res.pumped_size = min(size, head_size_ - head_pos_);
+		copy_n(head_.raw() + head_pos_, res.pumped_size, to);
+		head_pos_ += res.pumped_size;
+		if (head_pos_ == head_size_){
+			// the head is done. the next source starts from scratch
+			res.eof = head_eof_;
+			head_size_ = head_pos_ = 0;
+			head_eof_ = false;
+			if (res.eof)
+				return res;
+		}
+		if (res.pumped_size == size)
+			return res;
+	}
+	auto next = pump_next(to + res.pumped_size, size - res.pumped_size);
+	res.pumped_size += next.pumped_size;
+	res.eof = next.eof;
+	return res;
+}
+
+
+}
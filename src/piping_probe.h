@@ -0,0 +1,30 @@
+#pragma once
+#include "piping.h"
+#include "buffer.h"
+#include <zstd.h>
+
+namespace archi{
+
+
+/// looks at the beginning of the next source, to guess whether compressing it is worth the effort.
+/// what was looked at is pumped further as usual.
+class Pipe_probe_in: public Pipe_in{
+public:
+	Pipe_probe_in();
+	/// reads the head of the next source. must be called after linking it, before the first pump().
+	/// checks known formats of compressed data first, then tries to compress the head quickly
+	bool incompressible();
+private:
+	virtual
+	Pump_result pump(u8 *to, u64 size) override;
+
+	Buffer head_;
+	u64 head_size_ = 0;
+	u64 head_pos_ = 0;
+	bool head_eof_ = false;
+	Buffer trial_;
+	pool::Cctx zctx_;
+};
+
+
+}
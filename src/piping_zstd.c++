@@ -1,10 +1,16 @@
 #include "piping_zstd.h"
 #include "exception.h"
 
+#include <zdict.h>
+
+using namespace std;
 
 namespace archi{
 
 
+// ZSTD_WINDOWLOG_LIMIT_DEFAULT, which is only available with the experimental API
+static const uint default_window_log_limit = 27;
+
 static
 void check_error(size_t code)
 {
@@ -13,77 +19,105 @@ void check_error(size_t code)
 }
 
 
-Pipe_zstd_out::Pipe_zstd_out(Zstd_out zout) : zstream_(ZSTD_createCStream(), ZSTD_freeCStream)
+std::shared_ptr<const Zstd_dictionary> Zstd_dictionary::train(const std::string &samples, const std::vector<size_t> &sample_sizes)
+{
+	auto ret = make_shared<Zstd_dictionary>();
+	ret->data.resize(112*1024); // zstd's default
+	auto size = ZDICT_trainFromBuffer(ret->data.data(), ret->data.size(), samples.data(), sample_sizes.data(), sample_sizes.size());
+	if (ZDICT_isError(size))
+		return nullptr;
+	ret->data.resize(size);
+	ret->id = ZDICT_getDictID(ret->data.data(), ret->data.size());
+	if (ret->id == 0)
+		return nullptr;
+	return ret;
+}
+
+Zstd_in Zstd_out::decompression_params() const
+{
+	Zstd_in ret;
+	if (window_log > default_window_log_limit)
+		ret.window_log = window_log;
+	ret.dictionary = dictionary;
+	return ret;
+}
+
+Pipe_zstd_out::Pipe_zstd_out(Zstd_out zout) : zctx_(pool::cctx())
 {
-	if (!zstream_)
-		throw Exception("Can't initialize zstd compressor");
-	auto err = ZSTD_initCStream(zstream_.get(), zout.compression_level);
+	check_error(ZSTD_CCtx_setParameter(zctx_.get(), ZSTD_c_compressionLevel, zout.compression_level));
+	if (zout.window_log)
+		check_error(ZSTD_CCtx_setParameter(zctx_.get(), ZSTD_c_windowLog, zout.window_log));
+	if (zout.long_distance_matching)
+		check_error(ZSTD_CCtx_setParameter(zctx_.get(), ZSTD_c_enableLongDistanceMatching, 1));
+	if (zout.dictionary)
+		check_error(ZSTD_CCtx_loadDictionary(zctx_.get(), zout.dictionary->data.data(), zout.dictionary->data.size()));
+	if (zout.threads){
+		auto err = ZSTD_CCtx_setParameter(zctx_.get(), ZSTD_c_nbWorkers, zout.threads);
+		if (ZSTD_isError(err))
+			throw Exception("zstd can't use {0} threads: {1}")(zout.threads, ZSTD_getErrorName(err));
+	}
+}
+
+size_t Pipe_zstd_out::compress(ZSTD_inBuffer &zin, ZSTD_EndDirective mode)
+{
+	// enough to flush a block at once. bigger input is compressed in several steps.
+	// the next stage may take the buffer and give another one back, so it's sized each time
+	out_buffer_.resize(ZSTD_CStreamOutSize());
+	ZSTD_outBuffer zout{out_buffer_.raw(), out_buffer_.size(), 0};
+	auto err = ZSTD_compressStream2(zctx_.get(), &zout, &zin, mode);
 	check_error(err);
+	out_buffer_.resize(zout.pos);
+	pump_next_buffer(out_buffer_);
+	return err;
 }
 
 void Pipe_zstd_out::flush()
 {
-	ZSTD_outBuffer zout;
-	out_buffer_.resize(1024*1024);
-	while(true) {
-		zout.dst = out_buffer_.raw();
-		zout.pos = 0;
-		zout.size = out_buffer_.size();
-		auto err = ZSTD_flushStream(zstream_.get(), &zout);
-		check_error(err);
-		pump_next(out_buffer_.raw(), zout.pos);
-		if (err == 0)
-			break;
-	}
+	if (!i_pumped_)
+		return;
+	ZSTD_inBuffer zin{nullptr, 0, 0};
+	while (compress(zin, ZSTD_e_flush) != 0)
+		;
 }
 
 void Pipe_zstd_out::pump(u8 *from, u64 size)
 {
-	ZSTD_inBuffer zin;
-	ZSTD_outBuffer zout;
-	zin.pos = 0;
-	zin.src = from;
-	zin.size = size;
+	ZSTD_inBuffer zin{from, size, 0};
 	if (size)
 		i_pumped_ = true;
-	out_buffer_.resize(size);
-	zout.dst = out_buffer_.raw();
-	zout.size = out_buffer_.size();
 	do {
-		zout.pos = 0;
-		auto err = ZSTD_compressStream(zstream_.get(), &zout, &zin);
-		check_error(err);
-		pump_next(out_buffer_.raw(), zout.pos);
+		compress(zin, ZSTD_e_continue);
 	} while(zin.pos != zin.size);
 }
 
-void Pipe_zstd_out::finish()
+void Pipe_zstd_out::end_frame()
 {
-	if (!i_pumped_){
-		finish_next();
+	if (!i_pumped_)
 		return;
-	}
-	ZSTD_outBuffer zout;
-	zout.dst = out_buffer_.raw();
-	zout.size = out_buffer_.size();
-	size_t err;
-	do{
-		zout.pos = 0;
-		err = ZSTD_endStream(zstream_.get(), &zout);
-		check_error(err);
-		pump_next(out_buffer_.raw(), zout.pos);
-	} while(err != 0);
+	ZSTD_inBuffer zin{nullptr, 0, 0};
+	while (compress(zin, ZSTD_e_end) != 0)
+		;
 	i_pumped_ = false;
+}
+
+void Pipe_zstd_out::finish()
+{
+	end_frame();
 	finish_next();
 }
 
+Pipe_zstd_in::Pipe_zstd_in(Zstd_in zin) : zstream_(pool::dctx())
+{
+	if (zin.window_log > default_window_log_limit)
+		check_error(ZSTD_DCtx_setParameter(zstream_.get(), ZSTD_d_windowLogMax, zin.window_log));
+	if (zin.dictionary)
+		check_error(ZSTD_DCtx_loadDictionary(zstream_.get(), zin.dictionary->data.data(), zin.dictionary->data.size()));
+}
 
-Pipe_zstd_in::Pipe_zstd_in() : zstream_(ZSTD_createDStream(), ZSTD_freeDStream)
+void Pipe_zstd_in::reset()
 {
-	if (!zstream_)
-		throw Exception("Can't initialize zstd decompressor");
-	auto err = ZSTD_initDStream(zstream_.get());
-	check_error(err);
+	check_error(ZSTD_DCtx_reset(zstream_.get(), ZSTD_reset_session_only));
+	zin_.pos = zin_.size;
 }
 
 Source::Pump_result Pipe_zstd_in::pump(u8 *to, u64 size)
@@ -92,19 +126,18 @@ Source::Pump_result Pipe_zstd_in::pump(u8 *to, u64 size)
 	zout.dst = to;
 	zout.pos = 0;
 	zout.size = size;
-	if (buffer_.size() == 0){
-		buffer_.resize(10*1024*1024);
-		zin_.src = buffer_.raw();
-		zin_.size = buffer_.size();
-		zin_.pos = zin_.size;
-	}
+	if (buffer_.size() == 0)
+		buffer_.resize(1024*1024);
 	Source::Pump_result res;
 	res.eof = false;
 	while (true) {
 		if (zin_.pos == zin_.size){
-			res = pump_next(buffer_.raw(), buffer_.size());
+			// decompressed right from the buffer of the previous stage, if it has one
+			auto view = pump_next_view(buffer_.size(), buffer_);
+			zin_.src = view.data;
 			zin_.pos = 0;
-			zin_.size = res.pumped_size;
+			zin_.size = view.size;
+			res.eof = view.eof;
 		}
 		auto err = ZSTD_decompressStream(zstream_.get(), &zout, &zin_);
 		check_error(err);
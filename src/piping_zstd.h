@@ -1,17 +1,36 @@
 #pragma once
 #include "piping.h"
 #include "buffer.h"
+#include "pool.h"
 #include <zstd.h>
 
 namespace archi{
 
 
-struct Zstd_in{
+/// trained on samples of small files. it's stored in the catalogue
+struct Zstd_dictionary{
+	u32 id;
+	std::string data;
+
+	/// @returns nullptr if there is not enough samples to train on
+	static
+	std::shared_ptr<const Zstd_dictionary> train(const std::string &samples, const std::vector<size_t> &sample_sizes);
+};
 
+struct Zstd_in{
+	uint window_log = 0; // 0 means zstd default limit
+	std::shared_ptr<const Zstd_dictionary> dictionary;
 };
 
 struct Zstd_out{
-	int compression_level;
+	int compression_level; // negative levels are the fast ones
+	uint threads = 0; // 0 means compression on the calling thread. otherwise number of zstd workers
+	uint window_log = 0; // 0 means chosen by zstd from the level
+	bool long_distance_matching = false;
+	std::shared_ptr<const Zstd_dictionary> dictionary;
+
+	/// what a decompressor needs to know about this compression
+	Zstd_in decompression_params() const;
 };
 
 class Pipe_zstd_out: public Pipe_out{
@@ -19,31 +38,35 @@ public:
 	explicit
 	Pipe_zstd_out(Zstd_out zout);
 	void flush();
+	/// ends the current zstd frame. the data pumped after that can be decompressed on its own
+	void end_frame();
 private:
 	virtual
 	void pump(u8 *from, u64 size) override;
 	virtual
 	void finish() override;
-
-	typedef std::unique_ptr<ZSTD_CStream, decltype(&ZSTD_freeCStream)> Zc_stream_ptr;
+	/// one step of ZSTD_compressStream2(). its output goes to the next stage. returns what zstd did
+	size_t compress(ZSTD_inBuffer &zin, ZSTD_EndDirective mode);
 
 	Buffer out_buffer_;
-	Zc_stream_ptr zstream_;
+	pool::Cctx zctx_;
 	bool i_pumped_ = false;
 };
 
 
 class Pipe_zstd_in: public Pipe_in{
 public:
-	Pipe_zstd_in();
+	explicit
+	Pipe_zstd_in(Zstd_in zin);
+	/// forgets the state of the current frame and the buffered input.
+	/// the next pump() expects the beginning of a frame
+	void reset();
 private:
-	typedef std::unique_ptr<ZSTD_DStream, decltype(&ZSTD_freeDStream)> Zd_stream_ptr;
-
 	virtual
 	Pump_result pump(u8 *to, u64 size) override;
-	Buffer buffer_;
-	ZSTD_inBuffer zin_;
-	Zd_stream_ptr zstream_;
+	Buffer buffer_; // for the input, if the previous stage doesn't have a buffer of its own
+	ZSTD_inBuffer zin_{nullptr, 0, 0};
+	pool::Dctx zstream_;
 };
 
 
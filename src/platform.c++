@@ -2,6 +2,10 @@
 #include "exception.h"
 
 #include <sys/acl.h>
+#include <sys/stat.h>
+#include <sys/sysmacros.h>
+#include <sys/syscall.h>
+#include <dirent.h>
 #include <fcntl.h>
 #include <unistd.h>
 
@@ -22,24 +26,47 @@ void check_error(){
 typedef unique_ptr<remove_pointer_t<acl_t>, decltype(&acl_free)> acl_ptr;
 typedef unique_ptr<char, decltype(&acl_free)> acl_txt_ptr;
 
+static
+std::string read_acl(const char *path, acl_type_t type)
+{
+	errno = 0;
+	acl_ptr acl( acl_get_file(path, type), acl_free);
+	if (errno == ENOTSUP or errno == ENODATA)
+		return string();
+	check_error();
+	acl_txt_ptr acl_text( acl_to_text(acl.get(), NULL), acl_free);
+	check_error();
+	return string((char*)acl_text.get());
+}
+
 static
 std::string get_acl_internal(const std::filesystem::path &path, acl_type_t type)
 {
 	try{
-		errno = 0;
-		acl_ptr acl( acl_get_file(path.c_str(), type), acl_free);
-		if (errno == ENOTSUP or errno == ENODATA)
-			return string();
-		check_error();
-		acl_txt_ptr acl_text( acl_to_text(acl.get(), NULL), acl_free);
-		check_error();
-		return string((char*)acl_text.get());
+		return read_acl(path.c_str(), type);
 	}
 	catch(...){
 		throw_with_nested( Exception("Can't get ACL for {0}")(path) );
 	}
 }
 
+static
+std::string get_acl_at_internal(int dir_fd, const char *name, acl_type_t type)
+{
+	try{
+		errno = 0;
+		Fd fd(openat(dir_fd, name, O_PATH | O_NOFOLLOW | O_CLOEXEC));
+		if (!fd)
+			check_error();
+		// acl_get_fd() doesn't take O_PATH descriptors and has no default ACL, so through /proc
+		auto fd_path = "/proc/self/fd/" + to_string(fd.get());
+		return read_acl(fd_path.c_str(), type);
+	}
+	catch(...){
+		throw_with_nested( Exception("Can't get ACL for {0}")(name) );
+	}
+}
+
 std::string get_acl(const std::filesystem::path &path)
 {
 	return get_acl_internal(path, ACL_TYPE_ACCESS);
@@ -50,6 +77,16 @@ string get_default_acl(const std::filesystem::path &path)
 	return get_acl_internal(path, ACL_TYPE_DEFAULT);
 }
 
+std::string get_acl_at(int dir_fd, const char *name)
+{
+	return get_acl_at_internal(dir_fd, name, ACL_TYPE_ACCESS);
+}
+
+std::string get_default_acl_at(int dir_fd, const char *name)
+{
+	return get_acl_at_internal(dir_fd, name, ACL_TYPE_DEFAULT);
+}
+
 void set_acl_internal(std::filesystem::path &path, const char* acl_txt, acl_type_t type)
 {
 	try{
@@ -122,5 +159,124 @@ void fs_sync()
 	sync();
 }
 
+void Fd::reset(int fd)
+{
+	if (fd_ >= 0){
+		[[maybe_unused]]
+		auto ret = close(fd_);
+		ASSERT(ret >= 0);
+	}
+	fd_ = fd;
+}
+
+Fd open_dir(const std::filesystem::path &path)
+{
+	Fd ret(open(path.c_str(), O_RDONLY | O_DIRECTORY | O_CLOEXEC));
+	if (!ret)
+		check_error();
+	return ret;
+}
+
+Dir_reader::Dir_reader(const Fd &dir) : fd_(dir.get())
+{
+	ASSERT(dir);
+}
+
+bool Dir_reader::next(Entry &e)
+{
+	// the kernel guarantees the layout
+	struct Linux_dirent64{
+		ino64_t        d_ino;
+		off64_t        d_off;
+		unsigned short d_reclen;
+		unsigned char  d_type;
+		char           d_name[];
+	};
+	static constexpr size_t buf_size = 64*1024;
+	while (true){
+		if (pos_ >= size_){
+			if (!buf_)
+				buf_.reset(new u8[buf_size]);
+			errno = 0;
+			auto res = syscall(SYS_getdents64, fd_, buf_.get(), buf_size);
+			if (res < 0)
+				check_error();
+			if (res == 0)
+				return false;
+			size_ = res;
+			pos_ = 0;
+		}
+		auto de = reinterpret_cast<Linux_dirent64*>(buf_.get() + pos_);
+		pos_ += de->d_reclen;
+		if (de->d_name[0] == '.' and (de->d_name[1] == 0 or (de->d_name[1] == '.' and de->d_name[2] == 0)))
+			continue;
+		e.name = de->d_name;
+		switch (de->d_type){
+		case DT_REG:
+			e.type = REGULAR;
+			break;
+		case DT_DIR:
+			e.type = DIRECTORY;
+			break;
+		case DT_LNK:
+			e.type = SYMLINK;
+			break;
+		case DT_UNKNOWN:
+			e.type = UNKNOWN;
+			break;
+		default:
+			e.type = OTHER;
+		}
+		return true;
+	}
+}
+
+File_stat stat_at(int dir_fd, const char *name)
+{
+	struct statx stx;
+	errno = 0;
+	if (statx(dir_fd, name, AT_SYMLINK_NOFOLLOW | AT_NO_AUTOMOUNT,
+	          STATX_TYPE | STATX_MODE | STATX_MTIME | STATX_CTIME | STATX_SIZE | STATX_INO | STATX_BLOCKS, &stx))
+		check_error();
+	File_stat ret;
+	switch (stx.stx_mode & S_IFMT){
+	case S_IFREG:
+		ret.type = fs::file_type::regular;
+		break;
+	case S_IFDIR:
+		ret.type = fs::file_type::directory;
+		break;
+	case S_IFLNK:
+		ret.type = fs::file_type::symlink;
+		break;
+	default:
+		ret.type = fs::file_type::unknown;
+	}
+	ret.permissions = stx.stx_mode & 07777;
+	ret.mod_time = stx.stx_mtime.tv_sec * (s64)Time_accuracy::period::den + stx.stx_mtime.tv_nsec;
+	ret.change_time = stx.stx_ctime.tv_sec * (s64)Time_accuracy::period::den + stx.stx_ctime.tv_nsec;
+	ret.size = stx.stx_size;
+	ret.allocated = stx.stx_blocks * 512;
+	ret.device = makedev(stx.stx_dev_major, stx.stx_dev_minor);
+	ret.inode = stx.stx_ino;
+	return ret;
+}
+
+std::filesystem::path read_link_at(int dir_fd, const char *name)
+{
+	string ret(256, 0);
+	while (true){
+		errno = 0;
+		auto len = readlinkat(dir_fd, name, ret.data(), ret.size());
+		if (len < 0)
+			check_error();
+		if ((size_t)len < ret.size()){
+			ret.resize(len);
+			return ret;
+		}
+		ret.resize(ret.size() * 2);
+	}
+}
+
 
 }
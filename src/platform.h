@@ -6,6 +6,9 @@ namespace archi{
 
 std::string get_acl(const std::filesystem::path &path);
 std::string get_default_acl(const std::filesystem::path &path);
+/// same, for `name` in the directory `dir_fd`. the path is not resolved again, so no races with renames
+std::string get_acl_at(int dir_fd, const char *name);
+std::string get_default_acl_at(int dir_fd, const char *name);
 void set_acl(std::filesystem::path &path, std::string &acl_txt);
 void set_default_acl(std::filesystem::path &path, std::string &acl_txt);
 
@@ -22,5 +25,75 @@ std::unique_ptr<File_lock> lock(std::filesystem::path &path);
 
 void fs_sync();
 
+/// owns a file descriptor
+class Fd{
+public:
+	Fd() = default;
+	explicit
+	Fd(int fd): fd_(fd) {}
+	Fd(Fd &) = delete;
+	Fd(Fd &&a): fd_(std::exchange(a.fd_, -1)) {}
+	Fd & operator =(Fd &&a){
+		reset(std::exchange(a.fd_, -1));
+		return *this;
+	}
+	~Fd(){
+		reset();
+	}
+	int get() const{
+		return fd_;
+	}
+	void reset(int fd = -1);
+	explicit
+	operator bool() const{
+		return fd_ >= 0;
+	}
+private:
+	int fd_ = -1;
+};
+
+/// opens directory for reading its entries, and for lookups relative to it
+Fd open_dir(const std::filesystem::path &path);
+
+/// reads directory entries in big batches directly with getdents64
+class Dir_reader{
+public:
+	enum Type: u8{
+		UNKNOWN, // file system doesn't report types. has to be stat'ed
+		REGULAR,
+		DIRECTORY,
+		SYMLINK,
+		OTHER,   // fifos, sockets, devices
+	};
+	struct Entry{
+		const char *name; // valid till the next call to next()
+		Type type;
+	};
+	explicit
+	Dir_reader(const Fd &dir);
+	/// skips "." and "..". returns false when there are no more entries
+	bool next(Entry &e);
+private:
+	int fd_;
+	std::unique_ptr<u8[]> buf_;
+	size_t size_ = 0;
+	size_t pos_ = 0;
+};
+
+struct File_stat{
+	std::filesystem::file_type type;
+	u16  permissions;
+	Time mod_time;
+	Time change_time;
+	u64  size;
+	u64  allocated; // bytes taken on disk
+	u64  device;
+	u64  inode;
+};
+/// all the needed attributes with a single statx() call. doesn't follow symlinks
+/// @param dir_fd directory `name` is relative to, or AT_FDCWD
+File_stat stat_at(int dir_fd, const char *name);
+std::filesystem::path read_link_at(int dir_fd, const char *name);
+
 
 }
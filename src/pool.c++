@@ -0,0 +1,160 @@
+#include "pool.h"
+#include "exception.h"
+
+using namespace std;
+
+namespace archi::pool{
+
+
+// sizes are rounded up to powers of 2, from 4K. the bigger ones are not kept
+static const size_t min_class = 12;
+static const size_t max_class = 30;
+static const align_val_t alignment{4096};
+// memory kept, when nobody uses it. buffers and zstd contexts share it
+static const size_t max_kept_bytes = 256*1024*1024;
+static const size_t max_kept_contexts = 64;
+
+namespace{
+
+atomic<size_t> kept_bytes = 0;
+
+/// counts size against max_kept_bytes. false if there is not enough left
+bool keep(size_t size)
+{
+	auto was = kept_bytes.load();
+	do{
+		if (was + size > max_kept_bytes)
+			return false;
+	}while (!kept_bytes.compare_exchange_weak(was, was + size));
+	return true;
+}
+
+void unkeep(size_t size)
+{
+	kept_bytes -= size;
+}
+
+struct Memory_pool{
+	mutex mtx;
+	array<vector<u8*>, max_class + 1> free;
+};
+
+Memory_pool &memory_pool(){
+	// never destroyed, so buffers with static storage can be released at exit
+	static auto p = new Memory_pool;
+	return *p;
+}
+
+template<class CTX>
+struct Ctx_pool{
+	mutex mtx;
+	vector<pair<CTX*, size_t>> free; // with the size it was kept at
+};
+
+Ctx_pool<ZSTD_CCtx> &cctx_pool(){
+	static auto p = new Ctx_pool<ZSTD_CCtx>;
+	return *p;
+}
+
+Ctx_pool<ZSTD_DCtx> &dctx_pool(){
+	static auto p = new Ctx_pool<ZSTD_DCtx>;
+	return *p;
+}
+
+template<class CTX>
+CTX *take(Ctx_pool<CTX> &p)
+{
+	lock_guard lk(p.mtx);
+	if (p.free.empty())
+		return nullptr;
+	auto [ret, size] = p.free.back();
+	p.free.pop_back();
+	unkeep(size);
+	return ret;
+}
+
+/// contexts grow with the window and the workers they were used with, so they count against max_kept_bytes
+template<class CTX>
+bool give_back(Ctx_pool<CTX> &p, CTX *c, size_t size)
+{
+	lock_guard lk(p.mtx);
+	if (p.free.size() >= max_kept_contexts or !keep(size))
+		return false;
+	p.free.push_back({c, size});
+	return true;
+}
+
+}
+
+static
+size_t size_class(size_t size)
+{
+	return max<size_t>(bit_width(size - 1), min_class);
+}
+
+void Release_memory::operator()(u8 *p) const
+{
+	auto c = size_class(size);
+	if (c <= max_class){
+		auto &mp = memory_pool();
+		if (keep(size)){
+			lock_guard lk(mp.mtx);
+			mp.free[c].push_back(p);
+			return;
+		}
+	}
+	::operator delete[](p, alignment);
+}
+
+Memory memory(size_t size)
+{
+	auto c = size_class(max<size_t>(size, 1));
+	if (c <= max_class){
+		size = size_t(1) << c;
+		auto &mp = memory_pool();
+		lock_guard lk(mp.mtx);
+		if (!mp.free[c].empty()){
+			auto p = mp.free[c].back();
+			mp.free[c].pop_back();
+			unkeep(size);
+			return Memory(p, Release_memory{size});
+		}
+	}
+	return Memory(static_cast<u8*>(::operator new[](size, alignment)), Release_memory{size});
+}
+
+void Release_cctx::operator()(ZSTD_CCtx *c) const
+{
+	// drops the parameters and the dictionary. the memory of the context stays
+	if (ZSTD_isError(ZSTD_CCtx_reset(c, ZSTD_reset_session_and_parameters)) or !give_back(cctx_pool(), c, ZSTD_sizeof_CCtx(c)))
+		ZSTD_freeCCtx(c);
+}
+
+Cctx cctx()
+{
+	auto c = take(cctx_pool());
+	if (!c)
+		c = ZSTD_createCCtx();
+	if (!c)
+		throw Exception("Can't initialize zstd compressor");
+	return Cctx(c);
+}
+
+void Release_dctx::operator()(ZSTD_DCtx *c) const
+{
+	if (ZSTD_isError(ZSTD_DCtx_reset(c, ZSTD_reset_session_and_parameters)) or !give_back(dctx_pool(), c, ZSTD_sizeof_DCtx(c)))
+		ZSTD_freeDCtx(c);
+}
+
+Dctx dctx()
+{
+	auto c = take(dctx_pool());
+	if (!c)
+		c = ZSTD_createDCtx();
+	if (!c)
+		throw Exception("Can't initialize zstd decompressor");
+	return Dctx(c);
+}
+
+
+}
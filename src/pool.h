@@ -0,0 +1,38 @@
+#pragma once
+#include "precomp.h"
+#include <zstd.h>
+
+namespace archi{
+
+
+/// process-wide pools of big buffers and zstd contexts.
+/// restore and test build filters for every content file, and without the pools would allocate
+/// and fault in the same memory again for each of them. all the functions are thread safe
+namespace pool{
+
+struct Release_memory{
+	size_t size = 0;
+	void operator()(u8 *p) const;
+};
+using Memory = std::unique_ptr<u8[], Release_memory>;
+/// at least `size` bytes, page aligned. the size actually taken is in get_deleter().size
+Memory memory(size_t size);
+
+struct Release_cctx{
+	void operator()(ZSTD_CCtx *c) const;
+};
+using Cctx = std::unique_ptr<ZSTD_CCtx, Release_cctx>;
+/// compression context with the default parameters and no dictionary
+Cctx cctx();
+
+struct Release_dctx{
+	void operator()(ZSTD_DCtx *c) const;
+};
+using Dctx = std::unique_ptr<ZSTD_DCtx, Release_dctx>;
+/// decompression context with the default parameters and no dictionary
+Dctx dctx();
+
+}
+
+
+}
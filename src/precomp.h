@@ -2,11 +2,14 @@
 
 #include <algorithm>
 #include <array>
+#include <atomic>
 #include <cassert>
 #include <charconv>
+#include <condition_variable>
 #include <cstdio>
 #include <cstdlib>
 #include <ctime>
+#include <deque>
 #include <exception>
 #include <filesystem>
 #include <format>
@@ -17,10 +20,12 @@
 #include <iterator>
 #include <list>
 #include <memory>
+#include <mutex>
 #include <optional>
 #include <print>
 #include <ranges>
 #include <string_view>
+#include <thread>
 #include <time.h>
 #include <tuple>
 #include <unordered_map>
@@ -32,9 +37,6 @@
 
 #include <coformat.h>
 
-#define XXH_CPU_LITTLE_ENDIAN 1
-#include "xxhash.h"
-
 #include <google/protobuf/message_lite.h>
 #include <google/protobuf/arena.h>
 
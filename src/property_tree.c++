@@ -110,6 +110,16 @@ uint64_t property_tree::Property::value_u64()
 	}
 }
 
+int64_t property_tree::Property::value_i64()
+{
+	try{
+		return stoll(val_);
+	}
+	catch(...){
+		throw_with_nested(Exception("Value for '{0}' must be integer.\nProperty came from {1} line {2}")(key_, *origin_fn_, origin_ln_));
+	}
+}
+
 void property_tree::Property::add_sub(property_tree::Property &&p)
 {
 	kids_.emplace_back(move(p));
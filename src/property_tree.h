@@ -12,6 +12,7 @@ public:
 	/// doesn't throw
 	std::string_view opt_value_str();
 	uint64_t value_u64();
+	int64_t value_i64();
 	/// raw text, not divided to name and value. gets trimmed inside. might be empty()
 	std::string_view text();
 	/// will be divide to name and value. can be empty()
@@ -9,14 +9,13 @@ void pump(Stream_in &in, u64 to, Stream_out *out, std::string_view fname, Buffer
 {
 	ASSERT(num_already_pumped <= to);
 	while (num_already_pumped < to){
-		auto num_left = to - num_already_pumped;
-		auto to_pump = num_left > tmp.size() ? tmp.size() : num_left;
-		auto ret = in.pump(tmp.raw(), to_pump);
-		if (ret.eof && ret.pumped_size != to_pump)
+		auto to_pump = to - num_already_pumped;
+		auto view = in.pump_view(to_pump, tmp);
+		if (view.size == 0)
 			throw Exception( "Truncated content file {0}" )(fname);
 		if (out)
-			out->pump(tmp.raw(), to_pump);
-		num_already_pumped += to_pump;
+			out->pump(view.data, view.size);
+		num_already_pumped += view.size;
 	}
 	ASSERT(num_already_pumped == to);
 }
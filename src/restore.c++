@@ -6,7 +6,8 @@
 #include "platform.h"
 #include "piping.h"
 #include "checksumer.h"
-#include "pump.h"
+#include "content_reader.h"
+#include "parallel.h"
 
 using namespace std;
 using namespace coformat;
@@ -29,8 +30,6 @@ void apply_attribs(fs::path &target, Filesystem_state::File &attr){
 void Restore_action::restore()
 {
 	try{
-		Buffer tmp;
-		tmp.resize(128*1024);
 		Catalogue cat(archive_path, password, false);
 		auto num_ids = cat.num_states();
 		if (num_ids == 0)
@@ -61,6 +60,13 @@ void Restore_action::restore()
 			if (files.empty())
 				warning(tr_txt("The archive does not contain anything with the given prefix"),"");
 		}
+		// hard links are linked to their first file, if it is restored too. otherwise they get their own copy
+		unordered_set<fs::path> restored_paths;
+		for (Filesystem_state::File &file : files)
+			restored_paths.insert(file.path);
+		auto is_linked = [&](Filesystem_state::File &file){
+			return !file.hard_link.empty() and restored_paths.contains(file.hard_link);
+		};
 		for (Filesystem_state::File &file : files){ // restore dirs
 			if (file.type != Filesystem_state::DIR)
 				continue;
@@ -74,53 +80,89 @@ void Restore_action::restore()
 		}
 		{ // restore non empty files
 			vector<reference_wrapper<Filesystem_state::File>> sorted_by_refs =
-				files | views::filter([](auto &a){return a.get().content_ref.has_value();}) | ranges::to<vector>();
+				files | views::filter([&](auto &a){return a.get().content_ref.has_value() and !is_linked(a);}) | ranges::to<vector>();
 			ranges::sort(sorted_by_refs, [](auto a, auto b){
 				return a.get().content_ref.value() < b.get().content_ref.value();
 			});
-			uint reported_progress = numeric_limits<uint>::max();
-			uint cur_ref_id = 0;
-			File_source in;
-			Stream_in sin;
-			Filtrator_in filters;
-			decltype(File_content_ref::fname) fname;
-			decltype(File_content_ref::from)  num_pumped;
-			Pipe_csum_out cs_out;
-			for (auto fr : sorted_by_refs){
-				uint p = cur_ref_id++ *1000 / sorted_by_refs.size();
-				if (p != reported_progress){
+			auto jobs = split_to_read_jobs(sorted_by_refs.size(), [&](size_t i) -> File_content_ref& {
+				return sorted_by_refs[i].get().content_ref.value();
+			});
+			vector<reference_wrapper<Filesystem_state::File>> chunked =
+				files | views::filter([&](auto &a){return !a.get().chunks.empty() and !is_linked(a);}) | ranges::to<vector>();
+			auto num_files = sorted_by_refs.size() + chunked.size();
+			mutex report_mtx;
+			uint reported_progress = 0;
+			atomic<size_t> next_job = 0;
+			size_t num_restored = 0; // guarded by report_mtx
+			auto report = [&](auto &&...args){
+				lock_guard lk(report_mtx);
+				warning(std::forward<decltype(args)>(args)...);
+			};
+			auto report_restored = [&]{
+				lock_guard lk(report_mtx);
+				uint p = ++num_restored *1000 / num_files;
+				if (p > reported_progress){
 					progress(p);
 					reported_progress = p;
 				}
-				auto &file = fr.get();
-				auto &ref = file.content_ref.value();
-				auto re_path = mk_re_path(file.path);
-				try {
-					if (fname != ref.fname){
-						auto content_path = cat.archive_path() / ref.fname;
-						in = content_path;
-						sin.name(content_path);
-						num_pumped = 0;
-						filters = Filtrator_in(ref.filters);
-						sin << filters << in;
-						cs_out.csumer_for(ref.csum);
-						fname = ref.fname;
+			};
+			run_in_parallel(min<size_t>(threads, jobs.size()), [&]{
+				Content_reader reader(cat.archive_path());
+				Pipe_csum_out cs_out;
+				for (size_t j; (j = next_job++) < jobs.size();){
+					for (size_t i = jobs[j].begin; i < jobs[j].end; i++){
+						auto &file = sorted_by_refs[i].get();
+						auto &ref = file.content_ref.value();
+						auto re_path = mk_re_path(file.path);
+						try {
+							File_sink out(re_path);
+							out.skip(file.holes);
+							Stream_out sout;
+							cs_out.csumer_for(ref.csum, ref.filters.encryption());
+							sout >> cs_out >> out;
+							reader.read(ref, sout);
+							if (ref.csum != cs_out.csumer()->checksum())
+								report(cformat(tr_txt("Control sums do not match for {0}"), re_path), "" );
+							sout.finish();
+						}
+						catch(std::exception &e){
+							/* TRANSLATORS: This is about path from and to  */
+							report(cformat(tr_txt("Can't restore {0} to {1}: "), file.path, re_path), message(e));
+						}
+						report_restored();
 					}
-					pump(sin, ref.from, nullptr, ref.fname, tmp, num_pumped);
-					File_sink out(re_path);
-					Stream_out sout;
-					cs_out.csumer()->reset();
-					sout >> cs_out >> out;
-					pump(sin, ref.to, &sout, ref.fname, tmp, num_pumped);
-					if (ref.csum != cs_out.csumer()->checksum())
-						warning(cformat(tr_txt("Control sums do not match for {0}"), re_path), "" );
-					sout.finish();
 				}
-				catch(std::exception &e){
-					/* TRANSLATORS: This is about path from and to  */
-					warning(cformat(tr_txt("Can't restore {0} to {1}: "), file.path, re_path), message(e));
+			});
+			// files split to chunks are restored one by one, chunk after chunk
+			next_job = 0;
+			run_in_parallel(min<size_t>(threads, chunked.size()), [&]{
+				Content_reader reader(cat.archive_path());
+				Pipe_csum_out cs_out;
+				for (size_t i; (i = next_job++) < chunked.size();){
+					auto &file = chunked[i].get();
+					auto re_path = mk_re_path(file.path);
+					try {
+						File_sink out(re_path);
+						out.skip(file.holes);
+						Stream_out sout;
+						bool csums_match = true;
+						for (auto &chunk : file.chunks){
+							cs_out.csumer_for(chunk.csum, chunk.filters.encryption());
+							sout >> cs_out >> out;
+							reader.read(chunk, sout);
+							csums_match = csums_match and chunk.csum == cs_out.csumer()->checksum();
+						}
+						if (!csums_match)
+							report(cformat(tr_txt("Control sums do not match for {0}"), re_path), "" );
+						sout.finish();
+					}
+					catch(std::exception &e){
+						/* TRANSLATORS: This is about path from and to  */
+						report(cformat(tr_txt("Can't restore {0} to {1}: "), file.path, re_path), message(e));
+					}
+					report_restored();
 				}
-			}
+			});
 		}
 		for (Filesystem_state::File &file : files){ // restore links and empty files
 			if (file.type == Filesystem_state::DIR)
@@ -128,9 +170,11 @@ void Restore_action::restore()
 			auto re_path = mk_re_path(file.path);
 			try{
 				if (file.type == Filesystem_state::FILE){
-					if (file.content_ref)
+					if (file.content_ref or !file.chunks.empty() or is_linked(file))
 						continue;
 					File_sink out(re_path);
+					if (!file.holes.empty()) // nothing but holes
+						fs::resize_file(re_path, file.holes.back().offset + file.holes.back().size);
 				}
 				else if (file.type == Filesystem_state::SYMLINK){
 					std::filesystem::create_symlink(file.symlink_target, re_path);
@@ -141,6 +185,18 @@ void Restore_action::restore()
 				warning(cformat(tr_txt("Can't restore {0} to {1}: "), file.path, re_path), message(e));
 			}
 		}
+		for (Filesystem_state::File &file : files){ // restore hard links, now all the files they link to are there
+			if (!is_linked(file))
+				continue;
+			auto re_path = mk_re_path(file.path);
+			try{
+				fs::create_hard_link(mk_re_path(file.hard_link), re_path);
+			}
+			catch(std::exception &e){
+				/* TRANSLATORS: This is about path from and to  */
+				warning(cformat(tr_txt("Can't restore {0} to {1}: "), file.path, re_path), message(e));
+			}
+		}
 		sort(files.begin(), files.end(), [](auto a, auto b){
 			return a.get().path > b.get().path;
 		});
@@ -10,6 +10,7 @@ struct Restore_action{
 	std::filesystem::path to;
 	std::string password;
 	std::filesystem::path prefix; // optional
+	uint threads = 1; // content files are restored in parallel by that many threads
 	std::function<void(std::string &&header, std::string &&warning_message)> warning;
 	std::function<void(uint progress_in_permil)> progress;
 
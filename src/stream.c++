@@ -16,36 +16,109 @@ Stream_in::Stream_in(string &&name)
 	name_ = move(name);
 }
 
+void Stream_in::next_linked()
+{
+	buff_.clear();
+	buff_pos_ = 0;
+	eof_ = false;
+}
+
+size_t Stream_in::fill(size_t size)
+{
+	if (buffered() >= size or eof_)
+		return buffered();
+	try{
+		buff_.erase(buff_.begin(), buff_.begin() + buff_pos_);
+		buff_pos_ = 0;
+		auto was = buff_.size();
+		buff_.resize(max(size, read_ahead_size));
+		auto res = pump_next(buff_.data() + was, buff_.size() - was);
+		buff_.resize(was + res.pumped_size);
+		eof_ = res.eof;
+	}
+	catch(...){
+		throw_with_nested( Exception("Can't read the file {0}")(name_));
+	}
+	return buffered();
+}
+
 u64 Stream_in::get_uint()
 {
+	// a varint takes up to 10 bytes
+	auto available = fill(10);
 	u64 v = 0;
 	u8 sv;
 	size_t shift = 0;
+	auto p = buff_.data() + buff_pos_;
 	do{
-		Source::Pump_result read = pump(&sv, 1);
-		if (read.pumped_size != 1)
+		if (available-- == 0)
 			throw Exception( "Malformed file: {0}" )(name_);
 		if (shift > sizeof(v) * 8 - 7)
 			throw Exception( "Too big varint. Malformed file {0}" )(name_);
-		v |= (sv &127) << shift;
+		sv = *p++;
+		v |= u64(sv &127) << shift;
 		shift += 7;
 	}while(sv &128);
+	buff_pos_ = p - buff_.data();
 	return v;
 }
 
 u64 Stream_in::get_uint64()
 {
 	u64 v;
-	auto res = pump((u8*) &v, sizeof(v));
-	if (res.pumped_size != sizeof(v))
+	if (fill(sizeof(v)) < sizeof(v))
 		throw Exception( "Malformed file: {0}" )(name_);
+	memcpy(&v, buff_.data() + buff_pos_, sizeof(v));
+	buff_pos_ += sizeof(v);
 	return v;
 }
 
 Source::Pump_result Stream_in::pump(u8 *to, u64 size)
 {
+	Source::Pump_result res{min<u64>(size, buffered()), false};
+	copy_n(buff_.data() + buff_pos_, res.pumped_size, to);
+	buff_pos_ += res.pumped_size;
+	if (res.pumped_size == size){
+		res.eof = eof_ and buffered() == 0;
+		return res;
+	}
+	if (eof_){
+		res.eof = true;
+		return res;
+	}
+	try{
+		auto next = pump_next(to + res.pumped_size, size - res.pumped_size);
+		res.pumped_size += next.pumped_size;
+		res.eof = next.eof;
+		return res;
+	}
+	catch(...){
+		throw_with_nested( Exception("Can't read the file {0}")(name_));
+	}
+}
+
+Source::Pump_view Stream_in::pump_view(u64 max_size, Buffer &scratch)
+{
+	if (buffered() or eof_){
+		Source::Pump_view ret{buff_.data() + buff_pos_, min<u64>(max_size, buffered()), false};
+		buff_pos_ += ret.size;
+		ret.eof = eof_ and buffered() == 0;
+		return ret;
+	}
+	try{
+		return pump_next_view(max_size, scratch);
+	}
+	catch(...){
+		throw_with_nested( Exception("Can't read the file {0}")(name_));
+	}
+}
+
+Source::Pump_result Stream_in::pump_buffer(Buffer &buf, u64 max_size)
+{
+	if (buffered() or eof_)
+		return Source::pump_buffer(buf, max_size); // what's read ahead is copied
 	try{
-		return pump_next(to, size);
+		return pump_next_buffer(buf, max_size);
 	}
 	catch(...){
 		throw_with_nested( Exception("Can't read the file {0}")(name_));
@@ -73,6 +146,17 @@ void Stream_out::pump(u8 *from, u64 size)
 	}
 }
 
+void Stream_out::pump_buffer(Buffer &buf)
+{
+	try{
+		if (buf.size())
+			pump_next_buffer(buf);
+	}
+	catch(exception &){
+		throw_default_error();
+	}
+}
+
 void Stream_out::finish()
 {
 	try{
@@ -110,10 +194,12 @@ void read_message(Buffer &message, Stream_in &in, Checksumer_xxhash &cs)
 {
 	auto msize = in.get_uint();
 	message.resize(msize);
-	cs.reset();
 	auto res = in.pump(message.raw(), msize);
 	if (res.pumped_size != msize)
 		throw Exception("Malformed file: {0}")(in.name());
+	// the stream reads ahead, so the checksum is taken over the message itself
+	cs.reset();
+	cs.update(message.raw(), msize);
 	auto cs_now = cs.checksum();
 	auto cs_was = in.get_uint64();
 	if (cs_now != cs_was)
@@ -8,6 +8,10 @@
 namespace archi{
 
 
+/// the small reads of get_uint(), get_uint64() and read_message() are served from a read-ahead buffer.
+/// bigger pumps take what's buffered, and go to the next stage directly for the rest.
+/// to switch to another chain in the middle of a file, link this stream as the source of the new chain,
+/// so it hands over what it read ahead. linking another source to this stream drops it
 class Stream_in: public Pipe_in
 {
 public:
@@ -23,9 +27,23 @@ public:
 	/// not var length version. always takes 8 bytes in the stream
 	u64 get_uint64(); // ... or die trying
 	Source::Pump_result pump(u8 *to, u64 size) override;
+	/// saves copying, when the last stage keeps the data in a buffer of its own. see Source::pump_view()
+	Source::Pump_view pump_view(u64 max_size, Buffer &scratch) override;
+	/// saves copying, when the last stage keeps the data in buffers of its own. see Source::pump_buffer()
+	Source::Pump_result pump_buffer(Buffer &buf, u64 max_size) override;
 private:
 	std::string name_;
 	std::vector<u8> buff_;
+	size_t buff_pos_ = 0;
+	bool eof_ = false; // the next stage reached eof. then buff_ holds all that's left
+	static constexpr size_t read_ahead_size = 64*1024;
+
+	/// makes at least `size` bytes buffered, if the input has as much. returns the number of buffered bytes
+	size_t fill(size_t size);
+	size_t buffered(){
+		return buff_.size() - buff_pos_;
+	}
+	void next_linked() override;
 };
 
 class Stream_out: public Pipe_out
@@ -43,6 +61,8 @@ public:
 	/// puts as is. e.g. always 8 bytes
 	void put_uint64(u64 v);
 	void pump(u8 *from, u64 size) override;
+	/// saves copying, when the next stage queues the data. see Sink::pump_buffer()
+	void pump_buffer(Buffer &buf) override;
 	void finish() override;
 
 	// will be added to all the exceptions thrown from this class
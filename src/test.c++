@@ -3,87 +3,243 @@
 #include "precomp.h"
 #include "globals.h"
 #include "exception.h"
-#include "pump.h"
+#include "content_reader.h"
 #include "catalogue.h"
 #include "checksumer.h"
+#include "checksumer_xxhash.h"
+#include "parallel.h"
 
 namespace archi{
 
 using namespace std;
 using namespace coformat;
 
+namespace{
+
+/// counts refs found in the states. can be filled from several threads
+class Ref_tally{
+public:
+	void add(const std::string &fname, u64 from){
+		auto &s = shard(fname, from);
+		lock_guard lk(s.mtx);
+		++s.refs[{fname, from}];
+	}
+	/// removes the ref and returns how many times it was added. nullopt if never
+	optional<u64> take(const std::string &fname, u64 from){
+		auto &s = shard(fname, from);
+		lock_guard lk(s.mtx);
+		auto it = s.refs.find({fname, from});
+		if (it == s.refs.end())
+			return nullopt;
+		auto ret = it->second;
+		s.refs.erase(it);
+		return ret;
+	}
+	bool empty(){
+		return ranges::all_of(shards_, [](auto &s){ return s.refs.empty(); });
+	}
+private:
+	struct Shard{
+		std::mutex mtx;
+		std::map<tuple<string, u64>, u64> refs;
+	};
+	std::array<Shard, 64> shards_;
+
+	Shard &shard(const std::string &fname, u64 from){
+		return shards_[(hash<string>{}(fname) + from) % shards_.size()];
+	}
+};
+
+}
+
+/// throws if the file on disk doesn't match its checksums
+static
+void check_storage(const filesystem::path &path, const Block_csums &bc, Buffer &buf)
+{
+	if (auto size = filesystem::file_size(path); size != bc.size)
+		throw Exception("Size is {0}, while it must be {1}")(size, bc.size);
+	File_source src(path);
+	Stream_in sin(path);
+	sin << src;
+	buf.resize(bc.block_size);
+	Checksumer_xxhash csumer;
+	for (size_t i = 0; i < bc.csums.size(); i++){
+		auto res = sin.pump(buf.raw(), buf.size());
+		csumer.reset();
+		csumer.update(buf.raw(), res.pumped_size);
+		if (get<Xx_hash>(csumer.checksum()) != bc.csums[i])
+			throw Exception("Checksum of block {0} does not match")(i);
+	}
+}
+
 void Test_action::test()
 {
 	try{
-		Buffer tmp;
-		tmp.resize(128*1024);
 		Catalogue cat(archive_path, password, false);
-		typedef tuple<string, u64> Discovered_key;
-		std::map<Discovered_key, u64> discovered_refs;
-		progress_status(tr_txt("Checking versions."));
-		for (size_t i = 0; i < cat.num_states(); i++){
-			progress(i * 1000 / cat.num_states());
-			auto fs = cat.fs_state(i);
-			for (auto &f: fs.files()){
-				if (f.content_ref.has_value())
-					++discovered_refs[{f.content_ref->fname, f.content_ref->from}];
+		mutex report_mtx;
+		uint reported_progress = 0;
+		// counts one more done, and reports progress, if it has grown
+		auto report_progress = [&](size_t &num_done, size_t total){
+			lock_guard lk(report_mtx);
+			uint p = ++num_done *1000 / total;
+			if (p > reported_progress){
+				progress(p);
+				reported_progress = p;
 			}
+		};
+		auto report = [&](auto &&...args){
+			lock_guard lk(report_mtx);
+			warning(std::forward<decltype(args)>(args)...);
+		};
+
+		progress_status(tr_txt("Checking versions."));
+		Ref_tally discovered_refs;
+		{
+			auto num_states = cat.num_states();
+			atomic<size_t> next_state = 0;
+			size_t num_loaded = 0; // guarded by report_mtx
+			run_in_parallel(min<size_t>(threads, num_states), [&]{
+				for (size_t i; (i = next_state++) < num_states;){
+					auto fs = cat.fs_state(i);
+					fs.for_each_ref([&](File_content_ref &r){
+						discovered_refs.add(r.fname, r.from);
+					});
+					report_progress(num_loaded, num_states);
+				}
+			});
 		}
 		progress_status(tr_txt("Checking references consistency."));
 		for (auto &cf : cat.content_refs()){
-			Discovered_key t = {cf.fname, cf.from};
-			if (!discovered_refs.contains(t)){
+			auto r = discovered_refs.take(cf.fname, cf.from);
+			if (!r){
 				warning(tr_txt("A useless ref is still in catalog."), cf.fname +":"+ to_string(cf.from));
 				continue;
 			}
-			auto &r = discovered_refs[t];
-			r -= cf.ref_count_;
-			if (r)
+			if (*r != cf.ref_count_)
 				warning(tr_txt("Factual ref count doesnt match with catalog."), cf.fname +":"+ to_string(cf.from));
-			discovered_refs.erase(t);
 		}
 		if (!discovered_refs.empty())
 			warning(tr_txt("Some refs are used but are not in catalog."), "");
 
-		progress_status(tr_txt("Checking files content."));
-		auto total_refs = cat.content_refs().size();
-		uint reported_progress = numeric_limits<uint>::max();
-		File_source in;
-		Stream_in sin;
-		Stream_out sout;
-		Filtrator_in filters;
-		Pipe_csum_out cs;
-		decltype(File_content_ref::fname) fname;
-		decltype(File_content_ref::from)  num_pumped;
-		for (decltype(total_refs) i = 0; auto ref : cat.content_refs()){
-			ASSERT(total_refs);
-			uint p = i++ *1000 / total_refs;
-			if (p != reported_progress){
-				progress(p);
-				reported_progress = p;
+		// content files are checked starting from the least recently verified ones
+		struct Content_file_check{
+			const string *fname;
+			const Block_csums *storage; // only the storage is checked, if set
+			Time last_verified;
+			size_t refs_begin;
+			size_t refs_end;
+			size_t jobs_left = 0;
+			bool ok = true;
+		};
+		vector<Content_file_check> files;
+		vector<const File_content_ref*> refs;
+		for (auto &ref : cat.content_refs()){
+			if (files.empty() or *files.back().fname != ref.fname){
+				auto &f = files.emplace_back();
+				f.fname = &ref.fname;
+				f.storage = mode == STORAGE ? cat.storage_csums(ref.fname) : nullptr;
+				f.last_verified = cat.last_verified(ref.fname).value_or(0);
+				f.refs_begin = refs.size();
+			}
+			refs.push_back(&ref);
+			files.back().refs_end = refs.size();
+		}
+		auto num_content_files = files.size();
+		ranges::stable_sort(files, {}, &Content_file_check::last_verified);
+		if (budget_bytes){
+			u64 total = 0;
+			size_t n = 0;
+			for (; n < files.size(); n++){
+				error_code ec;
+				u64 size = files[n].storage ? files[n].storage->size : file_size(cat.archive_path() / *files[n].fname, ec);
+				if (ec)
+					size = 0;
+				if (n and total + size > *budget_bytes)
+					break;
+				total += size;
 			}
-			try {
-				if (fname != ref.fname){
-					auto content_path = cat.archive_path() / ref.fname;
-					in = content_path;
-					sin.name(content_path);
-					num_pumped = 0;
-					fname = ref.fname;
-					filters = Filtrator_in(ref.filters);
-					sin << filters << in;
-					cs.csumer_for(ref.csum);
+			files.resize(n);
+		}
+		struct Job{
+			Content_file_check *file;
+			Read_job refs; // empty for storage checks
+		};
+		vector<Job> jobs;
+		for (auto &f : files){
+			if (f.storage){
+				jobs.push_back({&f, {0, 0}});
+				f.jobs_left = 1;
+				continue;
+			}
+			auto file_jobs = split_to_read_jobs(f.refs_end - f.refs_begin, [&](size_t i) -> const File_content_ref& {
+				return *refs[f.refs_begin + i];
+			});
+			for (auto &j : file_jobs)
+				jobs.push_back({&f, {f.refs_begin + j.begin, f.refs_begin + j.end}});
+			f.jobs_left = file_jobs.size();
+		}
+
+		progress_status(tr_txt("Checking files content."));
+		optional<chrono::steady_clock::time_point> deadline;
+		if (budget_time)
+			deadline = chrono::steady_clock::now() + *budget_time;
+		vector<const string*> verified;
+		reported_progress = 0;
+		atomic<size_t> next_job = 0;
+		size_t num_checked = 0; // guarded by report_mtx
+		run_in_parallel(min<size_t>(threads, jobs.size()), [&]{
+			Content_reader reader(cat.archive_path());
+			Stream_out sout;
+			Pipe_csum_out cs;
+			Buffer buf;
+			for (size_t j; (j = next_job++) < jobs.size();){
+				if (deadline and chrono::steady_clock::now() >= *deadline)
+					break;
+				auto &job = jobs[j];
+				bool ok = true;
+				if (job.file->storage){
+					auto &fname = *job.file->fname;
+					try{
+						check_storage(cat.archive_path() / fname, *job.file->storage, buf);
+					}
+					catch(std::exception &e){
+						ok = false;
+						report(cformat(tr_txt("File {0} is broken."), fname), message(e));
+					}
+				}
+				for (size_t i = job.refs.begin; i < job.refs.end; i++){
+					auto &ref = *refs[i];
+					try {
+						cs.csumer_for(ref.csum, ref.filters.encryption());
+						sout >> cs;
+						reader.read(ref, sout);
+						if (ref.csum != cs.csumer()->checksum()){
+							ok = false;
+							report( cformat(tr_txt("File {0} is broken."), ref.fname), "Control sums do not match." );
+						}
+					}
+					catch(std::exception &e){
+						ok = false;
+						/* TRANSLATORS: This is about path from and to  */
+						report(cformat(tr_txt("Problem with {0}"), ref.fname), message(e));
+					}
 				}
-				pump(sin, ref.from, nullptr, fname, tmp, num_pumped);
-				cs.csumer()->reset();
-				sout >> cs;
-				pump(sin, ref.to, &sout, fname, tmp, num_pumped);
-				if (ref.csum != cs.csumer()->checksum())
-					warning( cformat(tr_txt("File {0} is broken."), fname), "Control sums do not match." );
+				report_progress(num_checked, jobs.size());
+				lock_guard lk(report_mtx);
+				job.file->ok = job.file->ok and ok;
+				if (--job.file->jobs_left == 0 and job.file->ok)
+					verified.push_back(job.file->fname);
 			}
-			catch(std::exception &e){
-				/* TRANSLATORS: This is about path from and to  */
-				warning(cformat(tr_txt("Problem with {0}"), ref.fname), message(e));
+		});
+		if (budget_bytes or budget_time){
+			// the times go to a side file, the catalogue itself stays untouched
+			if (!verified.empty()){
+				auto now = to_posix_time(filesystem::file_time_type::clock::now());
+				for (auto fname : verified)
+					cat.verified(*fname, now);
+				cat.save_verified();
 			}
+			progress_status(cformat(tr_txt("{0} of {1} content files were verified."), verified.size(), num_content_files));
 		}
 	}
 	catch(std::exception &e){
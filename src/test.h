@@ -5,9 +5,19 @@ namespace archi{
 
 
 struct Test_action{
+	enum Mode{
+		DEEP,    // decrypts and decompresses the content, and checks it against the files checksums
+		STORAGE, // checks the content files as they are on disk. DEEP for the ones without storage checksums
+	};
 	std::string name; //optional
 	std::filesystem::path archive_path;
 	std::string password;
+	Mode mode = DEEP;
+	uint threads = 1; // states are loaded, and content files are checked, by that many threads in parallel
+	// if any of them is set, only a part of the content files is checked, the least recently verified first.
+	// the time of verification is stored in the "verified" file of the archive, the catalogue is not rewritten
+	std::optional<u64> budget_bytes;
+	std::optional<std::chrono::seconds> budget_time; // checking stops when it is over. partly checked files are not marked as verified
 	std::function<void(std::string &&header, std::string &&warning_message)> warning;
 	std::function<void(std::string &&status_text)> progress_status;
 	std::function<void(uint progress_in_permil)> progress;
@@ -4,6 +4,8 @@
 #include "platform.h"
 #include "coformat.h"
 #include "testing.h"
+#include "checksumer_blake3.h"
+#include "checksumer_blake2b.h"
 
 /*
 Directory structure:
@@ -12,6 +14,7 @@ Directory structure:
 ~/temp/atest/add/ - from this dir files in working dir will be updated gradually, with each test step
 ~/temp/atest/rmv  - list of the files, which will be removed with each test step one by one
 ~/temp/atest/arc/ - archive will be stored here
+~/temp/atest/arc-chunked/ - and here, with big files split to chunks
 */
 
 int run(int argc, const char *argv[]);
@@ -164,6 +167,83 @@ void extract(size_t i, fs::path arc, fs::path to){
 	run(params);
 }
 
+/// BLAKE3 against digests of the reference implementation, and its speed against BLAKE2b
+static
+void test_checksumers()
+{
+	const u8 key[] = "whats the Elephant we are talking";
+	struct Vector{
+		size_t size; // of input bytes 0, 1, ... 250, 0, 1, ...
+		const char *keyed;
+		const char *derived; // with the context "archivarius test vectors"
+	};
+	// sizes around the chunk boundaries and the numbers of chunks hashed at once
+	const Vector vectors[] = {
+		{0, "53c039c7fb55f8c97773134d3fb79e6bc1ab49fd8b2bde818bee0e82c03f6544",
+		    "efcd5f4dce9a9f061d05bebd129c2ff927e32d5d4b8c010437f71292659f367a"},
+		{1, "65903888cca83b9e816336fa70d3fcd50cef2385e0acc6b867d4910935284683",
+		    "e74daa2d4ae4715dc80b814b816f75481d7cabce686bc42f00856e84954e78c9"},
+		{1023, "e06427c5f4c042b654645063d271dda24b5407d0ef7a26acc59fae674a8ebfea",
+		       "a00c10faa10829a2273ebd124c99568db56d93379b32ae7dcb7138257efd950e"},
+		{1024, "e541ee9ecbfcdba7efb90beecba4fe3274d9fb7d675fd85134ef66ec5829be66",
+		       "05f95b21bdc9787639b7916c115dfdeeeb8d6ab3ef0d30ce5b0bcfda2dc7fdfa"},
+		{1025, "22d63479a8028a54aa9973c28cd2ccb1d9ebcf41ea36bcad9e0ba50b0c8a0003",
+		       "46240c2f31b4ec53367047cad61e673ae239bfcd6e6548f545699b9bb2a9e7f0"},
+		{2048, "d9a2b548957e027ce2cc047460170535e24f33aed2b7cf336d10be6c4bc017e6",
+		       "c21826b4e9ae6ceb9fa8ea776e307d317bac758beb269c29f455d08331b85164"},
+		{3073, "23f2f0280abbb553f75a3086f2584a7661c922af5524677a1ac343d645671d54",
+		       "2244e98ac188b99fdc138e6d33a620fc65522b84a230b0c3fa8e3714c7988db8"},
+		{8193, "848f7d2fef6b7988fcf9bd646a382606409f412d5756cac8ddfc4b8c9e1c2107",
+		       "eaa300999c9fa10fdaa50bc1e872c1b5088d42882fa977d0ebb41dc0070b98c2"},
+		{16385, "fa3c295760c2c18212633f811aa0b7379175b83554e960109deb3ea646a3fdc4",
+		        "172f711337aeeefc2a229688b790a8d908407008672d98db8f975a7ec4b29d45"},
+		{17409, "4bfb3561508771fc2ed0de59890def9cf0d9cdb1ac4aaf75030b5d7da35cc9ac",
+		        "9743961ffe3f5867ae066e8bfea00f81e6ae5a9b8c905c7dc8a85de19e64d614"},
+		{102400, "e25802dfd33c9b8d963a5abc7ee78e647eba3be23053fb4ef35447636c85e96c",
+		         "336b71af4dc2dffcc1ccd89661589bdd1f63518e428234727665911896507c3c"},
+	};
+	auto to_hex = [](const auto &hash){
+		string ret;
+		for (auto b : hash)
+			ret += format("{:02x}", b);
+		return ret;
+	};
+	for (auto &v : vectors){
+		vector<u8> data(v.size);
+		for (size_t i = 0; i < data.size(); i++)
+			data[i] = i % 251;
+		Checksumer_blake3 whole(key);
+		whole.update(data.data(), data.size());
+		// in pieces of varying sizes, so the input is buffered and hashed in place in turns
+		Checksumer_blake3 pieces(key);
+		for (size_t pos = 0, step = 7; pos < data.size(); step = step*3 % 5000 + 1){
+			auto n = min(step, data.size() - pos);
+			pieces.update(data.data() + pos, n);
+			pos += n;
+		}
+		auto derived = Checksumer_blake3::derive_key("archivarius test vectors", data.data(), data.size());
+		if (to_hex(get<Blake3_hash>(whole.checksum())) != v.keyed or
+		    to_hex(get<Blake3_hash>(pieces.checksum())) != v.keyed or
+		    to_hex(derived) != v.derived){
+			ASSERT(0);
+			throw runtime_error(format("BLAKE3 of {} bytes is wrong", v.size));
+		}
+	}
+	vector<u8> data(1024*1024);
+	for (size_t i = 0; i < data.size(); i++)
+		data[i] = i * 131;
+	auto gb_per_second = [&](Checksumer &&cs){
+		auto start = chrono::steady_clock::now();
+		for (int i = 0; i < 256; i++)
+			cs.update(data.data(), data.size());
+		cs.checksum();
+		chrono::duration<double> took = chrono::steady_clock::now() - start;
+		return 256.0 * data.size() / took.count() / 1e9;
+	};
+	println("BLAKE3 {:.2f} GB/s{}, BLAKE2b {:.2f} GB/s", gb_per_second(Checksumer_blake3(key)),
+	        Checksumer_blake3::vectorized() ? "" : " (no SIMD)", gb_per_second(Checksumer_blake2b()));
+}
+
 static
 void run_command(std::string &&cmd){
 	println("{}", cmd);
@@ -172,6 +252,7 @@ void run_command(std::string &&cmd){
 
 void test()
 {
+	test_checksumers();
 	fs::path hf = getenv("HOME");
 	ASSERT(!hf.empty());
 	fs::path atest_src = hf / "temp/atest/src";
@@ -179,8 +260,10 @@ void test()
 	fs::path atest_add = hf / "temp/atest/add";
 	fs::path atest_rmv = hf / "temp/atest/rmv";
 	fs::path atest_arc = hf / "temp/atest/arc";
+	fs::path atest_arc_chunked = hf / "temp/atest/arc-chunked";
 	fs::remove_all(atest_tmp);
 	fs::remove_all(atest_arc);
+	fs::remove_all(atest_arc_chunked);
 	fs::create_directory(atest_tmp);
 	run_command(format("cp --reflink -a {}/* {}", atest_src, atest_tmp));
 	vector<string> rmv_list;
@@ -215,39 +298,79 @@ void test()
 			quit = false;
 		}
 	}
-	println("extract and check");
 	auto last_state = states.back();
-	for (size_t i = 0; i < states.size(); i++){
-		println("{}%", i * 100 /states.size());
-		auto j = states.size() - 1 - i;
-		extract(j, atest_arc, atest_tmp);
-		auto fs = state_for(atest_tmp);
-		compare(fs, states[i]);
-		clear_previous_line();
+	for (auto arc : {atest_arc, atest_arc_chunked}){
+		println("extract and check {}", arc.string());
+		for (size_t i = 0; i < states.size(); i++){
+			println("{}%", i * 100 /states.size());
+			auto j = states.size() - 1 - i;
+			extract(j, arc, atest_tmp);
+			auto fs = state_for(atest_tmp);
+			compare(fs, states[i]);
+			clear_previous_line();
+		}
+	}
+	// a renamed file is found by its inode, and its content isn't stored again.
+	// the files were just extracted to new inodes, so they are archived once before renaming
+	run({"archive", "cfg-file=test/test.conf"});
+	fs::path renamed;
+	for (auto &[path, f] : last_state){
+		if (f.type == File::FILE and f.size != 0){
+			renamed = path;
+			break;
+		}
+	}
+	ASSERT(!renamed.empty());
+	auto renamed_to = renamed;
+	renamed_to += ".renamed";
+	fs::rename(renamed, renamed_to);
+	run({"archive", "cfg-file=test/test.conf"});
+	for (auto arc : {atest_arc, atest_arc_chunked}){
+		Catalogue cat(arc, password, false);
+		auto was = cat.fs_state(1);
+		auto now = cat.fs_state(0);
+		auto a = was.get(renamed.lexically_relative(atest_tmp));
+		auto b = now.get(renamed_to.lexically_relative(atest_tmp));
+		auto same_ref = [](const File_content_ref &x, const File_content_ref &y){
+			return x.fname == y.fname and x.from == y.from;
+		};
+		bool same = a and b and a->content_ref.has_value() == b->content_ref.has_value() and a->chunks.size() == b->chunks.size();
+		if (same and a->content_ref)
+			same = same_ref(*a->content_ref, *b->content_ref);
+		for (size_t i = 0; same and i < a->chunks.size(); i++)
+			same = same_ref(a->chunks[i], b->chunks[i]);
+		ASSERT(same);
+		if (!same)
+			throw runtime_error(format("renamed {} is stored again", renamed.string()));
 	}
+	fs::rename(renamed_to, renamed);
+	run({"archive", "cfg-file=test/test.conf"});
 	this_thread::sleep_for(2s);
 	run({"archive", "cfg-file=test/test-1s.conf"});
-	{
-		Catalogue cat(atest_arc, password, false);
-		ASSERT(cat.num_states() == 1);
-		if (cat.num_states() != 1)
-			throw runtime_error("GC test failed");
-		// lock test
-		bool failed = false;
-		try{
-			Catalogue cat1(atest_arc, password, false);
-		}
-		catch(...){
-			failed = true;
+	for (auto arc : {atest_arc, atest_arc_chunked}){
+		{
+			Catalogue cat(arc, password, false);
+			ASSERT(cat.num_states() == 1);
+			if (cat.num_states() != 1)
+				throw runtime_error("GC test failed");
+			// lock test
+			bool failed = false;
+			try{
+				Catalogue cat1(arc, password, false);
+			}
+			catch(...){
+				failed = true;
+			}
+			ASSERT(failed);
+			if (!failed)
+				throw runtime_error("lock test failed");
 		}
-		ASSERT(failed);
-		if (!failed)
-			throw runtime_error("lock test failed");
+		extract(0, arc, atest_tmp);
+		auto fs = state_for(atest_tmp);
+		compare(fs, last_state);
 	}
-	extract(0, atest_arc, atest_tmp);
-	auto fs = state_for(atest_tmp);
-	compare(fs, last_state);
 	cprint("{fg}All green! All shiny!{fd}\n");
 	fs::remove_all(atest_tmp);
 	fs::remove_all(atest_arc);
+	fs::remove_all(atest_arc_chunked);
 }